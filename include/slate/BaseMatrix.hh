@@ -219,6 +219,20 @@ public:
         return storage_->tileDevice(globalIndex(i, j));
     }
 
+    /// Returns host NUMA domain of tile {i, j} of op(A),
+    /// in [0, numNumaDomains()).
+    int tileNumaDomain(int64_t i, int64_t j) const
+    {
+        return storage_->tileNumaDomain(globalIndex(i, j));
+    }
+
+    /// Returns number of host NUMA domains that local tiles are distributed
+    /// over, initially numa_domains().
+    int numNumaDomains() const
+    {
+        return storage_->numNumaDomains();
+    }
+
     /// Returns whether tile {i, j} of op(A) is local.
     bool tileIsLocal(int64_t i, int64_t j) const
     {
@@ -544,6 +558,36 @@ public:
     template <Target target = Target::Host>
     void listReduce(ReduceList& reduce_list, Layout layout, int tag = 0);
 
+    //--------------------------------------------------------------------------
+    // one-sided (MPI RMA) communication
+    void tileWindowCreate();
+
+    /// Frees the RMA window created by tileWindowCreate().
+    /// Collective over mpiComm().
+    /// WARNING: this applies to the entire parent matrix,
+    /// not just a sub-matrix.
+    void tileWindowFree()
+    {
+        storage_->tileWindowFree();
+    }
+
+    /// @return true if local tiles are exposed for tileFetch().
+    bool tileWindowIsOpen() const
+    {
+        return storage_->tileWindowIsOpen();
+    }
+
+    void tileFetch(int64_t i, int64_t j);
+
+    /// @return tile messages and bytes sent and received, counted while
+    /// perf::Perf is enabled.
+    /// WARNING: this applies to the entire parent matrix,
+    /// not just a sub-matrix.
+    perf::Counters commCounters() const
+    {
+        return storage_->commCounters();
+    }
+
     //--------------------------------------------------------------------------
     // LAYOUT
 public:
@@ -611,6 +655,7 @@ protected:
     void tileIbcastToSet(int64_t i, int64_t j, std::set<int> const& bcast_set,
                         int radix, int tag, Layout layout,
                         std::vector<MPI_Request>& send_requests,
+                        std::vector< std::vector<uint16_t> >& send_buffers,
                         Target target);
 
 public:
@@ -662,6 +707,104 @@ public:
         storage_->clearWorkspace();
     }
 
+    //--------------------------------------------------------------------------
+    /// Enables out-of-core storage: host tiles allocated by SLATE are backed
+    /// by a memory-mapped scratch file in scratch_dir, one per MPI rank,
+    /// so the matrix can exceed the node's RAM.
+    /// Must be called before inserting tiles, e.g., before insertLocalTiles.
+    /// WARNING: this applies to the entire parent matrix,
+    /// not just a sub-matrix.
+    void setOutOfCore( std::string const& scratch_dir )
+    {
+        storage_->setOutOfCore( scratch_dir );
+    }
+
+    /// @return true if host tiles are backed by a memory-mapped file.
+    bool outOfCore() const
+    {
+        return storage_->outOfCore();
+    }
+
+    //--------------------------------------------------------------------------
+    /// Sets the precision in which tiles are communicated.
+    /// With TilePrecision::Half or BFloat16, tile broadcasts (tileBcast,
+    /// listBcast, etc.) from host memory send each real value as 16 bits,
+    /// converted in software, halving the message volume for float.
+    /// The root rounds its tile to the same values before sending, so all
+    /// copies of a broadcast tile agree.
+    /// Tiles are still stored in the working precision, so this does not
+    /// reduce memory use.
+    /// WARNING: this applies to the entire parent matrix,
+    /// not just a sub-matrix.
+    void setTilePrecision( TilePrecision precision )
+    {
+        storage_->setTilePrecision( precision );
+    }
+
+    /// @return precision in which tiles are communicated.
+    TilePrecision tilePrecision() const
+    {
+        return storage_->tilePrecision();
+    }
+
+    //--------------------------------------------------------------------------
+    /// @return host slab holding the local tiles, if inserted with
+    /// Matrix::insertLocalTiles( TileAlloc::Slab or TileAlloc::ScaLAPACK ),
+    /// else nullptr. For TileAlloc::ScaLAPACK, the slab is this rank's
+    /// ScaLAPACK local array, with leading dimension hostSlabStride(),
+    /// which can be passed to ScaLAPACK without copying.
+    /// WARNING: this applies to the entire parent matrix,
+    /// not just a sub-matrix.
+    scalar_t* hostSlab() const
+    {
+        return storage_->hostSlab();
+    }
+
+    /// @return leading dimension of hostSlab() as a ScaLAPACK local array,
+    /// or 0 if it is not one.
+    int64_t hostSlabStride() const
+    {
+        return storage_->hostSlabStride();
+    }
+
+    //--------------------------------------------------------------------------
+    /// Sets the host NUMA domain of each tile, overriding the default
+    /// 1d block cyclic assignment over numa_domains() domains.
+    /// Must be called before inserting tiles, e.g., before insertLocalTiles,
+    /// so tiles are first touched in their domain.
+    /// WARNING: this applies to the entire parent matrix,
+    /// not just a sub-matrix.
+    ///
+    /// @param[in] num_domains
+    ///     Number of host NUMA domains, at least 1.
+    ///
+    /// @param[in] tileNumaDomain
+    ///     Function mapping global tile index {i, j} to a domain
+    ///     in [0, num_domains).
+    ///
+    void setTileNumaDomain(
+        int num_domains, std::function<int (ij_tuple ij)> const& tileNumaDomain)
+    {
+        storage_->setTileNumaDomain( num_domains, tileNumaDomain );
+    }
+
+    /// Hints that local tile {i, j} will be used soon.
+    /// In out-of-core mode, starts reading it in; otherwise does nothing.
+    void tilePrefetch( int64_t i, int64_t j )
+    {
+        storage_->tilePrefetch( globalIndex( i, j ) );
+    }
+
+    /// Hints that local tile {i, j} will not be used soon.
+    /// In out-of-core mode, drops it from RAM; otherwise does nothing.
+    void tileEvict( int64_t i, int64_t j )
+    {
+        storage_->tileEvict( globalIndex( i, j ) );
+    }
+
+    void prefetchLocalTiles();
+    void evictLocalTiles();
+
     /// Allocates batch arrays and BLAS++ queues for all devices.
     /// Matrix classes override this with versions that can also allocate based
     /// on the number of local tiles.
@@ -1764,6 +1907,8 @@ void BaseMatrix<scalar_t>::tileSend(
 {
     MPI_Request request;
     tileIsend( i, j, dst_rank, tag, &request );
+
+    perf::MpiWait perf_wait;
     slate_mpi_call( MPI_Wait( &request, MPI_STATUS_IGNORE ) );
 }
 
@@ -1818,6 +1963,7 @@ void BaseMatrix<scalar_t>::tileIsend(
         }
 
         at(i, j, send_dev).isend(dst_rank, mpiComm(), tag, request);
+        storage_->countSend( tileMb( i ) * tileNb( j ) * sizeof(scalar_t) );
     }
     else {
         *request = MPI_REQUEST_NULL;
@@ -1859,7 +2005,10 @@ void BaseMatrix<scalar_t>::tileRecv(
 {
     MPI_Request request;
     tileIrecv<target>( i, j, src_rank, layout, tag, &request );
-    slate_mpi_call( MPI_Wait( &request, MPI_STATUS_IGNORE ) );
+    {
+        perf::MpiWait perf_wait;
+        slate_mpi_call( MPI_Wait( &request, MPI_STATUS_IGNORE ) );
+    }
 
     // Copy to devices if not using GPU-aware MPI.
     if (target == Target::Devices) {
@@ -1921,6 +2070,7 @@ void BaseMatrix<scalar_t>::tileIrecv(
 
         // Receive data.
         at(i, j, recv_dev).irecv(src_rank, mpiComm(), layout, tag, request);
+        storage_->countRecv( tileMb( i ) * tileNb( j ) * sizeof(scalar_t) );
 
         tileModified( i, j, recv_dev, true );
 
@@ -1931,6 +2081,62 @@ void BaseMatrix<scalar_t>::tileIrecv(
     }
 }
 
+//------------------------------------------------------------------------------
+/// Exposes the host instances of all local tiles in an MPI RMA window,
+/// so other ranks can pull them with tileFetch() without a matching send.
+/// Local tiles are first made valid on host.
+/// Collective over mpiComm(); must be matched by tileWindowFree()
+/// before the matrix is destroyed.
+///
+/// While the window is open, local tiles must not be erased, reallocated,
+/// or converted to another layout. The owner's updates to a tile must be
+/// ordered before other ranks fetch it by some other synchronization,
+/// e.g., a barrier or message after the updating tasks complete.
+///
+/// WARNING: this applies to the entire parent matrix,
+/// not just a sub-matrix.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::tileWindowCreate()
+{
+    tileGetAllForReading( HostNum, LayoutConvert::None );
+    storage_->tileWindowCreate( mpiComm() );
+}
+
+//------------------------------------------------------------------------------
+/// Fetches remote tile {i, j} of op(A) from its owner with one-sided
+/// MPI_Rget, using the window opened by tileWindowCreate().
+/// Unlike tileRecv(), the owner does not participate, so it can be called
+/// whenever the consuming task becomes ready, without agreeing on tags.
+/// Tile is allocated as workspace if it doesn't yet exist, and has the
+/// same layout as on the owner.
+/// If the tile is local, this is a no-op.
+///
+/// @param[in] i
+///     Tile's block row index. 0 <= i < mt.
+///
+/// @param[in] j
+///     Tile's block column index. 0 <= j < nt.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::tileFetch(int64_t i, int64_t j)
+{
+    int src_rank = tileRank( i, j );
+    if (src_rank != mpiRank()) {
+        auto const& src = storage_->tileWindowAt( globalIndex( i, j ) );
+
+        storage_->tilePrepareToReceive( globalIndex( i, j ), HostNum,
+                                        src.layout );
+        tileAcquire( i, j, HostNum, src.layout );
+
+        at( i, j ).get( src_rank, src.disp, src.stride, src.layout,
+                        storage_->tileWindow() );
+        storage_->countRecv( tileMb( i ) * tileNb( j ) * sizeof(scalar_t) );
+
+        tileModified( i, j, HostNum, true );
+    }
+}
+
 //------------------------------------------------------------------------------
 /// Send tile {i, j} of op(A) to all MPI ranks in matrix B.
 /// If target is Devices, also copies tile to all devices on each MPI rank.
@@ -2017,6 +2223,7 @@ void BaseMatrix<scalar_t>::listBcast(
     MPI_Comm_size(mpiComm(), &mpi_size);
 
     std::vector<MPI_Request> send_requests;
+    std::vector< std::vector<uint16_t> > send_buffers;
 
     for (auto bcast : bcast_list) {
 
@@ -2042,7 +2249,8 @@ void BaseMatrix<scalar_t>::listBcast(
             // Send across MPI ranks.
             // Previous used MPI bcast: tileBcastToSet(i, j, bcast_set);
             // Currently uses 2D hypercube p2p send.
-            tileIbcastToSet(i, j, bcast_set, 2, tag, layout, send_requests, target);
+            tileIbcastToSet(i, j, bcast_set, 2, tag, layout,
+                            send_requests, send_buffers, target);
         }
 
         // Copy to devices.
@@ -2096,8 +2304,7 @@ void BaseMatrix<scalar_t>::listBcast(
             }
         }
     }
-    slate_mpi_call(
-        MPI_Waitall(send_requests.size(), send_requests.data(), MPI_STATUSES_IGNORE));
+    internal::waitAll( send_requests );
 }
 
 //------------------------------------------------------------------------------
@@ -2287,9 +2494,11 @@ void BaseMatrix<scalar_t>::tileBcastToSet(
 {
     std::vector<MPI_Request> requests;
     requests.reserve(radix);
+    std::vector< std::vector<uint16_t> > buffers;
 
-    tileIbcastToSet(i, j, bcast_set, radix, tag, layout, requests, target);
-    slate_mpi_call(MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE));
+    tileIbcastToSet(i, j, bcast_set, radix, tag, layout, requests, buffers,
+                    target);
+    internal::waitAll( requests );
 }
 
 //------------------------------------------------------------------------------
@@ -2322,11 +2531,17 @@ void BaseMatrix<scalar_t>::tileBcastToSet(
 /// @param[in,out] send_requests
 ///     Vector where requests for this bcast are appended.
 ///
+/// @param[in,out] send_buffers
+///     Vector where packed buffers of reduced-precision sends
+///     (see setTilePrecision) are appended. They must be kept until
+///     send_requests complete.
+///
 template <typename scalar_t>
 void BaseMatrix<scalar_t>::tileIbcastToSet(
     int64_t i, int64_t j, std::set<int> const& bcast_set,
     int radix, int tag, Layout layout,
     std::vector<MPI_Request>& send_requests,
+    std::vector< std::vector<uint16_t> >& send_buffers,
     Target target)
 {
     // Quit if only root in the broadcast set.
@@ -2363,12 +2578,64 @@ void BaseMatrix<scalar_t>::tileIbcastToSet(
         device = tileDevice( i, j );
     }
 
+    // Reduced-precision tiles are converted on the host.
+    TilePrecision precision = tilePrecision();
+    if (precision != TilePrecision::Working && device == HostNum) {
+        using real_t = blas::real_type<scalar_t>;
+        int64_t count = tileMb( i ) * tileNb( j )
+                      * (sizeof(scalar_t) / sizeof(real_t));
+        int64_t bytes = count * sizeof(uint16_t);
+        std::vector<uint16_t> buffer( count );
+
+        // Receive the packed tile, then expand it.
+        if (! recv_from.empty()) {
+            std::vector<MPI_Request> recv_request( 1 );
+            slate_mpi_call(
+                MPI_Irecv( buffer.data(), count, MPI_UINT16_T,
+                           new_vec[recv_from.front()], tag, mpi_comm_,
+                           &recv_request[ 0 ] ) );
+            tileAcquire(i, j, device, layout);
+            internal::waitAll( recv_request );
+            storage_->countRecv( bytes );
+            tile::unpack16( precision, buffer.data(), at(i, j, device) );
+            tileModified(i, j, device, true);
+        }
+        else if (! send_to.empty()) {
+            // Round the root's tile, so it holds the same values as the
+            // receivers' copies.
+            tileGetForWriting(i, j, device, LayoutConvert(layout));
+            auto Aij = at(i, j, device);
+            tile::round16( precision, Aij );
+            tile::pack16( precision, Aij, buffer.data() );
+        }
+
+        // Forward the packed tile. The caller keeps the buffer until
+        // the sends complete.
+        if (! send_to.empty()) {
+            for (int dst : send_to) {
+                MPI_Request request;
+                slate_mpi_call(
+                    MPI_Isend( buffer.data(), count, MPI_UINT16_T,
+                               new_vec[dst], tag, mpi_comm_, &request ) );
+                send_requests.push_back(request);
+                storage_->countSend( bytes );
+            }
+            // Moving the vector keeps its data in place.
+            send_buffers.push_back( std::move( buffer ) );
+        }
+        return;
+    }
+
     // Receive.
     if (! recv_from.empty()) {
         // read tile
         tileAcquire(i, j, device, layout);
 
-        at(i, j, device).recv(new_vec[recv_from.front()], mpi_comm_, layout, tag);
+        {
+            perf::MpiWait perf_wait;
+            at(i, j, device).recv(new_vec[recv_from.front()], mpi_comm_, layout, tag);
+        }
+        storage_->countRecv( tileMb( i ) * tileNb( j ) * sizeof(scalar_t) );
         tileModified(i, j, device, true);
     }
 
@@ -2382,6 +2649,7 @@ void BaseMatrix<scalar_t>::tileIbcastToSet(
             MPI_Request request;
             Aij.isend(new_vec[dst], mpi_comm_, tag, &request);
             send_requests.push_back(request);
+            storage_->countSend( tileMb( i ) * tileNb( j ) * sizeof(scalar_t) );
         }
     }
 }
@@ -2439,15 +2707,22 @@ void BaseMatrix<scalar_t>::tileReduceFromSet(
         // Receive, accumulate.
         for (int src : recv_from) {
             // Receive.
-            tile.recv(new_vec[src], mpi_comm_, layout, tag);
+            {
+                perf::MpiWait perf_wait;
+                tile.recv(new_vec[src], mpi_comm_, layout, tag);
+            }
+            storage_->countRecv( tileMb( i ) * tileNb( j ) * sizeof(scalar_t) );
             tileGetForWriting(i, j, LayoutConvert(layout));
             // Accumulate.
             tile::add( one, tile, Aij );
         }
 
         // Forward.
-        if (! send_to.empty())
+        if (! send_to.empty()) {
+            perf::MpiWait perf_wait;
             Aij.send(new_vec[send_to.front()], mpi_comm_, tag);
+            storage_->countSend( tileMb( i ) * tileNb( j ) * sizeof(scalar_t) );
+        }
     }
 }
 
@@ -3897,6 +4172,42 @@ void BaseMatrix<scalar_t>::releaseLocalWorkspace()
     }
 }
 
+//------------------------------------------------------------------------------
+/// Hints that all local tiles will be used soon.
+/// In out-of-core mode, starts reading them in; otherwise does nothing.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::prefetchLocalTiles()
+{
+    if (! outOfCore())
+        return;
+
+    for (int64_t j = 0; j < this->nt(); ++j) {
+        for (int64_t i = 0; i < this->mt(); ++i) {
+            if (this->tileIsLocal( i, j ))
+                tilePrefetch( i, j );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Hints that no local tiles will be used soon.
+/// In out-of-core mode, drops them from RAM; otherwise does nothing.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::evictLocalTiles()
+{
+    if (! outOfCore())
+        return;
+
+    for (int64_t j = 0; j < this->nt(); ++j) {
+        for (int64_t i = 0; i < this->mt(); ++i) {
+            if (this->tileIsLocal( i, j ))
+                tileEvict( i, j );
+        }
+    }
+}
+
 //------------------------------------------------------------------------------
 /// Erases a given set of local workspace tiles
 /// from all devices including host, if not on hold or modified.
@@ -0,0 +1,268 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef SLATE_COMPACT_BAND_MATRIX_HH
+#define SLATE_COMPACT_BAND_MATRIX_HH
+
+#include "slate/Exception.hh"
+#include "slate/Matrix.hh"
+#include "slate/types.hh"
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+#include "slate/internal/mpi.hh"
+
+namespace slate {
+
+//==============================================================================
+/// Base class for band matrices in compact LAPACK band storage.
+///
+/// BandMatrix and HermitianBandMatrix store the band in full nb-by-nb tiles,
+/// which is mostly zeros when the bandwidth is much smaller than nb.
+/// Compact band matrices instead store only the band, one slab per rank.
+///
+/// Columns are distributed 1D block-column: rank r owns columns
+/// [ r*nb, min( (r+1)*nb, n ) ), so nb * mpi_size >= n and each rank
+/// has at most one block. Besides its own columns, each rank stores a halo
+/// of the next rank's first columns, which receive fill-in and updates
+/// during factorization; the halo is filled in by the factorization.
+///
+/// Right-hand sides use the matching block-row distribution,
+/// which is the 2D block-cyclic Matrix with mb = nb on a
+/// p = mpi_size, q = 1 grid; see emptyRHS().
+///
+template <typename scalar_t>
+class BaseCompactBandMatrix {
+public:
+    using value_type = scalar_t;
+
+    /// @return number of rows and columns.
+    int64_t n() const { return n_; }
+
+    /// @return number of columns per rank.
+    int64_t nb() const { return nb_; }
+
+    /// @return first column owned by this rank.
+    int64_t colBegin() const { return col_begin_; }
+
+    /// @return one past the last column owned by this rank.
+    int64_t colEnd() const { return col_end_; }
+
+    /// @return one past the last column stored by this rank,
+    /// including the halo.
+    int64_t haloEnd() const { return halo_end_; }
+
+    /// @return rank that owns column j.
+    int colRank(int64_t j) const { return int( j / nb_ ); }
+
+    /// @return number of ranks that own at least one column.
+    int numRanks() const { return int( ceildiv( n_, nb_ ) ); }
+
+    /// @return leading dimension of the band storage.
+    int64_t stride() const { return ldab_; }
+
+    /// @return pointer to the band storage of local column colBegin().
+    scalar_t* data() { return data_.data(); }
+    scalar_t const* data() const { return data_.data(); }
+
+    MPI_Comm mpiComm() const { return mpi_comm_; }
+    int      mpiRank() const { return mpi_rank_; }
+    int      mpiSize() const { return mpi_size_; }
+
+    /// @return an empty n-by-nrhs matrix distributed to match the columns
+    /// of this matrix, for right-hand sides of solves.
+    /// Tiles must be inserted, e.g., with insertLocalTiles().
+    Matrix<scalar_t> emptyRHS(int64_t nrhs) const
+    {
+        return Matrix<scalar_t>( n_, nrhs, nb_, mpi_size_, 1, mpi_comm_ );
+    }
+
+protected:
+    BaseCompactBandMatrix(int64_t n, int64_t nb, int64_t halo, int64_t ldab,
+                          MPI_Comm mpi_comm);
+
+    int64_t n_;
+    int64_t nb_;
+    int64_t ldab_;
+    int64_t col_begin_;
+    int64_t col_end_;
+    int64_t halo_end_;
+
+    MPI_Comm mpi_comm_;
+    int mpi_rank_;
+    int mpi_size_;
+
+    std::vector<scalar_t> data_;
+};
+
+//------------------------------------------------------------------------------
+/// Allocates and zeros the local slab of columns [colBegin, haloEnd).
+///
+/// @param[in] n
+///     Number of rows and columns. n >= 0.
+///
+/// @param[in] nb
+///     Number of columns per rank. nb * mpi_size >= n, and
+///     nb >= halo unless a single rank owns all columns.
+///
+/// @param[in] halo
+///     Number of the next rank's columns to store.
+///
+/// @param[in] ldab
+///     Leading dimension of the band storage.
+///
+/// @param[in] mpi_comm
+///     MPI communicator to distribute matrix across.
+///
+template <typename scalar_t>
+BaseCompactBandMatrix<scalar_t>::BaseCompactBandMatrix(
+    int64_t n, int64_t nb, int64_t halo, int64_t ldab, MPI_Comm mpi_comm)
+    : n_( n ),
+      nb_( nb ),
+      ldab_( ldab ),
+      mpi_comm_( mpi_comm )
+{
+    slate_mpi_call( MPI_Comm_rank( mpi_comm_, &mpi_rank_ ) );
+    slate_mpi_call( MPI_Comm_size( mpi_comm_, &mpi_size_ ) );
+
+    slate_assert( n >= 0 );
+    slate_assert( nb > 0 );
+    slate_assert( nb * mpi_size_ >= n );
+    slate_assert( nb >= halo || nb >= n );
+
+    col_begin_ = std::min( mpi_rank_ * nb, n );
+    col_end_   = std::min( col_begin_ + nb, n );
+    halo_end_  = col_end_ == col_begin_
+               ? col_end_
+               : std::min( col_end_ + halo, n );
+    data_.assign( ldab_ * (halo_end_ - col_begin_), scalar_t( 0 ) );
+}
+
+//==============================================================================
+/// General n-by-n band matrix in compact LAPACK band storage,
+/// as used by lapack::gbtrf, with kl extra rows for fill-in:
+/// element (i, j) is at data()[ (kl + ku + i - j) + (j - colBegin())*stride() ]
+/// for max( 0, j - ku ) <= i <= min( n-1, j + kl ), and stride() = 2 kl + ku + 1.
+/// The halo is kl + ku columns.
+///
+template <typename scalar_t>
+class CompactBandMatrix: public BaseCompactBandMatrix<scalar_t> {
+public:
+    //--------------------------------------------------------------------------
+    /// Constructor creates an n-by-n band matrix with zero band.
+    ///
+    /// @param[in] n
+    ///     Number of rows and columns. n >= 0.
+    ///
+    /// @param[in] kl
+    ///     Number of subdiagonals within band. kl >= 0.
+    ///
+    /// @param[in] ku
+    ///     Number of superdiagonals within band. ku >= 0.
+    ///
+    /// @param[in] nb
+    ///     Number of columns per rank. nb * mpi_size >= n, and nb >= kl + ku.
+    ///
+    /// @param[in] mpi_comm
+    ///     MPI communicator to distribute matrix across.
+    ///
+    CompactBandMatrix(int64_t n, int64_t kl, int64_t ku, int64_t nb,
+                      MPI_Comm mpi_comm)
+        : BaseCompactBandMatrix<scalar_t>( n, nb, kl + ku, 2*kl + ku + 1,
+                                           mpi_comm ),
+          kl_( kl ),
+          ku_( ku )
+    {
+        slate_assert( kl >= 0 );
+        slate_assert( ku >= 0 );
+    }
+
+    /// @return number of subdiagonals within band.
+    int64_t lowerBandwidth() const { return kl_; }
+
+    /// @return number of superdiagonals within band, before factorization;
+    /// the factor U has kl + ku superdiagonals.
+    int64_t upperBandwidth() const { return ku_; }
+
+    /// @return element (i, j), for local column j in
+    /// [ colBegin(), haloEnd() ), and row i within the band,
+    /// including the kl rows of fill-in above it.
+    scalar_t& at(int64_t i, int64_t j)
+    {
+        assert( this->col_begin_ <= j && j < this->halo_end_ );
+        assert( j - kl_ - ku_ <= i && i <= j + kl_ );
+        return this->data_[ (kl_ + ku_ + i - j)
+                            + (j - this->col_begin_)*this->ldab_ ];
+    }
+
+    scalar_t at(int64_t i, int64_t j) const
+    {
+        return const_cast< CompactBandMatrix* >( this )->at( i, j );
+    }
+
+private:
+    int64_t kl_;
+    int64_t ku_;
+};
+
+//==============================================================================
+/// Hermitian positive definite n-by-n band matrix in compact LAPACK band
+/// storage of its lower triangle, as used by lapack::pbtrf with Uplo::Lower:
+/// element (i, j) is at data()[ (i - j) + (j - colBegin())*stride() ]
+/// for j <= i <= min( n-1, j + kd ), and stride() = kd + 1.
+/// The halo is kd columns.
+///
+template <typename scalar_t>
+class CompactHermitianBandMatrix: public BaseCompactBandMatrix<scalar_t> {
+public:
+    //--------------------------------------------------------------------------
+    /// Constructor creates an n-by-n Hermitian band matrix with zero band.
+    ///
+    /// @param[in] n
+    ///     Number of rows and columns. n >= 0.
+    ///
+    /// @param[in] kd
+    ///     Number of subdiagonals within band. kd >= 0.
+    ///
+    /// @param[in] nb
+    ///     Number of columns per rank. nb * mpi_size >= n, and nb >= kd.
+    ///
+    /// @param[in] mpi_comm
+    ///     MPI communicator to distribute matrix across.
+    ///
+    CompactHermitianBandMatrix(int64_t n, int64_t kd, int64_t nb,
+                               MPI_Comm mpi_comm)
+        : BaseCompactBandMatrix<scalar_t>( n, nb, kd, kd + 1, mpi_comm ),
+          kd_( kd )
+    {
+        slate_assert( kd >= 0 );
+    }
+
+    /// @return number of subdiagonals within band.
+    int64_t bandwidth() const { return kd_; }
+
+    /// @return element (i, j) of the lower triangle, for local column j in
+    /// [ colBegin(), haloEnd() ), and j <= i <= j + kd.
+    scalar_t& at(int64_t i, int64_t j)
+    {
+        assert( this->col_begin_ <= j && j < this->halo_end_ );
+        assert( j <= i && i <= j + kd_ );
+        return this->data_[ (i - j) + (j - this->col_begin_)*this->ldab_ ];
+    }
+
+    scalar_t at(int64_t i, int64_t j) const
+    {
+        return const_cast< CompactHermitianBandMatrix* >( this )->at( i, j );
+    }
+
+private:
+    int64_t kd_;
+};
+
+} // namespace slate
+
+#endif // SLATE_COMPACT_BAND_MATRIX_HH
@@ -162,6 +162,7 @@ public:
     void reserveDeviceWorkspace();
     void gather(scalar_t* A, int64_t lda);
     void insertLocalTiles(Target origin=Target::Host);
+    void insertLocalTiles(TileAlloc alloc);
 };
 
 //------------------------------------------------------------------------------
@@ -824,6 +825,14 @@ void Matrix<scalar_t>::gather(scalar_t* A, int64_t lda)
 //------------------------------------------------------------------------------
 /// Inserts all local tiles into an empty matrix.
 ///
+/// On the host, with more than one NUMA domain (see numNumaDomains),
+/// each tile is first touched (zeroed) by a thread of its domain
+/// (see tileNumaDomain), so the OS places its pages in that domain.
+/// This uses one thread per domain, bound with proc_bind( spread ).
+/// Threads find their domain from their place (internal::thread_numa_domain),
+/// as numa_tasks does, since thread d need not be on domain d when the
+/// primary thread is not on place 0.
+///
 /// @param[in] target
 ///     - if target = Devices, inserts tiles on appropriate GPU devices, or
 ///     - if target = Host,    inserts tiles on CPU host.
@@ -846,6 +855,145 @@ void Matrix<scalar_t>::insertLocalTiles(Target origin)
             }
         }
     }
+
+    int num_domains = this->numNumaDomains();
+    if (! on_devices && num_domains > 1 && ! this->outOfCore()) {
+        // owner[ d ] is the thread that touches domain d's tiles: the first
+        // thread bound to domain d, else thread d mod num_threads.
+        std::vector<int> owner( num_domains, -1 );
+        #pragma omp parallel num_threads( num_domains ) proc_bind( spread ) \
+            shared( owner )
+        {
+            int num_threads = omp_get_num_threads();
+            int thread = omp_get_thread_num();
+            int home = internal::thread_numa_domain( num_domains );
+            #pragma omp critical( slate_first_touch )
+            {
+                if (owner[ home ] < 0)
+                    owner[ home ] = thread;
+            }
+            #pragma omp barrier
+
+            for (int d = 0; d < num_domains; ++d) {
+                int t = (owner[ d ] >= 0 ? owner[ d ] : d % num_threads);
+                if (t != thread)
+                    continue;
+                for (int64_t j = 0; j < this->nt(); ++j) {
+                    for (int64_t i = 0; i < this->mt(); ++i) {
+                        if (this->tileIsLocal( i, j )
+                            && this->tileNumaDomain( i, j ) == d) {
+                            auto T = (*this)( i, j );
+                            for (int64_t jj = 0; jj < T.nb(); ++jj)
+                                std::fill_n( &T.at( 0, jj ), T.mb(), scalar_t( 0 ) );
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Inserts all local tiles into an empty matrix, on the host, with the
+/// given allocation:
+/// - TileAlloc::Individual: as insertLocalTiles( Target::Host ).
+/// - TileAlloc::Slab: tiles are carved from one host slab per rank,
+///   huge-page backed and first touched in parallel
+///   (see Memory::allocHostSlab), in column-major tile order, each tile
+///   contiguous with stride mb.
+/// - TileAlloc::ScaLAPACK: as Slab, but the slab is this rank's
+///   column-major ScaLAPACK local array, with tiles at their ScaLAPACK
+///   positions and stride hostSlabStride(). Every local block row must have
+///   a local tile in every local block column, as in 2D block-cyclic
+///   distributions.
+///
+/// Slab tiles are user owned, i.e., not freed individually; the slab is
+/// freed with the matrix storage. In out-of-core mode, tiles are allocated
+/// individually from the out-of-core pool instead.
+///
+/// @param[in] alloc
+///     How to allocate the host tiles.
+///
+template <typename scalar_t>
+void Matrix<scalar_t>::insertLocalTiles(TileAlloc alloc)
+{
+    if (alloc == TileAlloc::Individual || this->outOfCore()) {
+        insertLocalTiles( Target::Host );
+        return;
+    }
+    slate_assert( this->op() == Op::NoTrans );
+
+    this->origin_ = Target::Host;
+
+    int64_t mt = this->mt();
+    int64_t nt = this->nt();
+
+    if (alloc == TileAlloc::Slab) {
+        // Start each tile on a cache line.
+        int64_t align = std::max( int64_t( 64 / sizeof(scalar_t) ), int64_t( 1 ) );
+        int64_t count = 0;
+        for (int64_t j = 0; j < nt; ++j) {
+            for (int64_t i = 0; i < mt; ++i) {
+                if (this->tileIsLocal( i, j ))
+                    count += roundup( this->tileMb( i ) * this->tileNb( j ), align );
+            }
+        }
+        scalar_t* slab = this->storage_->allocHostSlab( count, 0 );
+
+        int64_t offset = 0;
+        for (int64_t j = 0; j < nt; ++j) {
+            for (int64_t i = 0; i < mt; ++i) {
+                if (this->tileIsLocal( i, j )) {
+                    int64_t mb = this->tileMb( i );
+                    this->tileInsert( i, j, HostNum, &slab[ offset ], mb );
+                    offset += roundup( mb * this->tileNb( j ), align );
+                }
+            }
+        }
+    }
+    else {
+        // Offsets of local block rows and cols in the local array, or -1.
+        std::vector<int64_t> row_offset( mt, -1 ), col_offset( nt, -1 );
+        int64_t num_tiles = 0;
+        for (int64_t j = 0; j < nt; ++j) {
+            for (int64_t i = 0; i < mt; ++i) {
+                if (this->tileIsLocal( i, j )) {
+                    row_offset[ i ] = 0;
+                    col_offset[ j ] = 0;
+                    ++num_tiles;
+                }
+            }
+        }
+        int64_t mlocal = 0, nlocal = 0, mtlocal = 0, ntlocal = 0;
+        for (int64_t i = 0; i < mt; ++i) {
+            if (row_offset[ i ] >= 0) {
+                row_offset[ i ] = mlocal;
+                mlocal += this->tileMb( i );
+                ++mtlocal;
+            }
+        }
+        for (int64_t j = 0; j < nt; ++j) {
+            if (col_offset[ j ] >= 0) {
+                col_offset[ j ] = nlocal;
+                nlocal += this->tileNb( j );
+                ++ntlocal;
+            }
+        }
+        slate_error_if( num_tiles != mtlocal * ntlocal );
+
+        int64_t lld = std::max( mlocal, int64_t( 1 ) );
+        scalar_t* slab = this->storage_->allocHostSlab( lld * nlocal, lld );
+
+        for (int64_t j = 0; j < nt; ++j) {
+            for (int64_t i = 0; i < mt; ++i) {
+                if (this->tileIsLocal( i, j )) {
+                    this->tileInsert( i, j, HostNum,
+                                      &slab[ row_offset[ i ]
+                                             + col_offset[ j ]*lld ], lld );
+                }
+            }
+        }
+    }
 }
 
 } // namespace slate
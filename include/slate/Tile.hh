@@ -133,6 +133,8 @@ public:
     void recv(int src, MPI_Comm mpi_comm, Layout layout, int tag = 0);
     void irecv(int src, MPI_Comm mpi_comm, Layout layout, int tag, MPI_Request *req);
     void bcast(int bcast_root, MPI_Comm mpi_comm);
+    void get(int src, MPI_Aint src_disp, int64_t src_stride, Layout layout,
+             MPI_Win win);
 
     /// Returns shallow copy of tile that is transposed.
     template <typename TileType>
@@ -1139,6 +1141,63 @@ void Tile<scalar_t>::irecv(int src, MPI_Comm mpi_comm, Layout layout,
     // by receiving less / compacted data
 }
 
+//------------------------------------------------------------------------------
+/// Fetches tile from MPI rank src using one-sided MPI_Rget on window win.
+/// The window must be in a passive-target epoch (MPI_Win_lock_all),
+/// so rank src does not participate in the transfer.
+///
+/// @param[in] src
+///     Source MPI rank in the window's communicator.
+///
+/// @param[in] src_disp
+///     Address of the source tile's data on rank src, as returned by
+///     MPI_Get_address; win must be a dynamic window with that memory
+///     attached.
+///
+/// @param[in] src_stride
+///     Leading dimension of the source tile.
+///
+/// @param[in] layout
+///     Indicates the Layout (ColMajor/RowMajor) of the source tile.
+///
+/// @param[in] win
+///     MPI RMA window.
+///
+template <typename scalar_t>
+void Tile<scalar_t>::get(
+    int src, MPI_Aint src_disp, int64_t src_stride, Layout layout, MPI_Win win)
+{
+    trace::Block trace_block("MPI_Rget");
+
+    this->setLayout( layout );
+
+    int count = layout_ == Layout::ColMajor ? nb_ : mb_;
+    int blocklength = layout_ == Layout::ColMajor ? mb_ : nb_;
+    MPI_Datatype origin_type, target_type;
+
+    slate_mpi_call(
+        MPI_Type_vector(
+            count, blocklength, stride_, mpi_type<scalar_t>::value,
+            &origin_type));
+    slate_mpi_call(
+        MPI_Type_vector(
+            count, blocklength, src_stride, mpi_type<scalar_t>::value,
+            &target_type));
+    slate_mpi_call(MPI_Type_commit(&origin_type));
+    slate_mpi_call(MPI_Type_commit(&target_type));
+
+    // Request-based get completes locally without flushing other
+    // threads' operations on the same window.
+    MPI_Request request;
+    slate_mpi_call(
+        MPI_Rget(data_, 1, origin_type, src, src_disp, 1, target_type,
+                 win, &request));
+    slate_mpi_call(MPI_Wait(&request, MPI_STATUS_IGNORE));
+
+    slate_mpi_call(MPI_Type_free(&origin_type));
+    slate_mpi_call(MPI_Type_free(&target_type));
+}
+
 //------------------------------------------------------------------------------
 /// Broadcasts tile from MPI rank bcast_root, using given communicator.
 ///
@@ -1163,7 +1222,7 @@ void Tile<scalar_t>::bcast(int bcast_root, MPI_Comm mpi_comm)
     //    // Use simple bcast.
     //    int count = mb_*nb_;
     //
-    //    #pragma omp critical(slate_mpi)
+    //    internal::MpiCriticalGuard guard;
     //    slate_mpi_call(
     //        MPI_Bcast(data_, count, mpi_type<scalar_t>::value,
     //                  bcast_root, mpi_comm));
@@ -1178,28 +1237,28 @@ void Tile<scalar_t>::bcast(int bcast_root, MPI_Comm mpi_comm)
         int stride = stride_;
         MPI_Datatype newtype;
 
-        #pragma omp critical(slate_mpi)
         {
+            internal::MpiCriticalGuard guard;
             slate_mpi_call(
                 MPI_Type_vector(
                     count, blocklength, stride, mpi_type<scalar_t>::value,
                     &newtype));
         }
 
-        #pragma omp critical(slate_mpi)
         {
+            internal::MpiCriticalGuard guard;
             slate_mpi_call(
                 MPI_Type_commit(&newtype));
         }
 
-        #pragma omp critical(slate_mpi)
         {
+            internal::MpiCriticalGuard guard;
             slate_mpi_call(
                 MPI_Bcast(data_, 1, newtype, bcast_root, mpi_comm));
         }
 
-        #pragma omp critical(slate_mpi)
         {
+            internal::MpiCriticalGuard guard;
             slate_mpi_call(
                 MPI_Type_free(&newtype));
         }
@@ -7,6 +7,7 @@
 #define SLATE_TILE_AUX_HH
 
 // #include "slate/Tile.hh"
+#include "slate/enums.hh"
 #include "slate/internal/util.hh"
 #include "slate/internal/device.hh"
 
@@ -410,6 +411,110 @@ void copyRow(int64_t n,
     copyRow(n, V, A, i_offs, j_offs);
 }
 
+//------------------------------------------------------------------------------
+/// Pack tile A into a buffer of 16-bit floating point numbers, converting
+/// the real and imaginary parts of each entry to the given precision.
+/// Entries are packed column by column of op(A), independent of layout.
+/// Host implementation.
+///
+/// @param[in] precision
+///     TilePrecision::Half or TilePrecision::BFloat16.
+///
+/// @param[in] A
+///     The mb-by-nb tile A.
+///
+/// @param[out] buffer
+///     Array of length mb*nb, or 2*mb*nb if scalar_t is complex.
+///
+template <typename scalar_t>
+void pack16(TilePrecision precision, Tile<scalar_t> const& A, uint16_t* buffer)
+{
+    using real_t = blas::real_type<scalar_t>;
+    const int parts = sizeof(scalar_t) / sizeof(real_t);
+    assert(precision != TilePrecision::Working);
+
+    bool bf16 = precision == TilePrecision::BFloat16;
+    for (int64_t j = 0; j < A.nb(); ++j) {
+        for (int64_t i = 0; i < A.mb(); ++i) {
+            real_t const* a = reinterpret_cast<real_t const*>( &A.at(i, j) );
+            for (int k = 0; k < parts; ++k) {
+                *buffer++ = bf16 ? float_to_bfloat16( float( a[ k ] ) )
+                                 : float_to_half( float( a[ k ] ) );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Unpack a buffer of 16-bit floating point numbers, as packed by pack16,
+/// into tile A.
+/// Host implementation.
+///
+template <typename scalar_t>
+void unpack16(TilePrecision precision, uint16_t const* buffer, Tile<scalar_t>& A)
+{
+    using real_t = blas::real_type<scalar_t>;
+    const int parts = sizeof(scalar_t) / sizeof(real_t);
+    assert(precision != TilePrecision::Working);
+
+    bool bf16 = precision == TilePrecision::BFloat16;
+    for (int64_t j = 0; j < A.nb(); ++j) {
+        for (int64_t i = 0; i < A.mb(); ++i) {
+            real_t* a = reinterpret_cast<real_t*>( &A.at(i, j) );
+            for (int k = 0; k < parts; ++k) {
+                a[ k ] = real_t( bf16 ? bfloat16_to_float( *buffer++ )
+                                      : half_to_float( *buffer++ ) );
+            }
+        }
+    }
+}
+
+//-----------------------------------------
+/// Converts rvalue refs to lvalue refs.
+///
+template <typename scalar_t>
+void unpack16(TilePrecision precision, uint16_t const* buffer, Tile<scalar_t>&& A)
+{
+    unpack16(precision, buffer, A);
+}
+
+//------------------------------------------------------------------------------
+/// Round tile A in-place to the given 16-bit precision, so it holds exactly
+/// the values that pack16 and unpack16 would transfer.
+/// Does nothing for TilePrecision::Working.
+/// Host implementation.
+///
+template <typename scalar_t>
+void round16(TilePrecision precision, Tile<scalar_t>& A)
+{
+    using real_t = blas::real_type<scalar_t>;
+    const int parts = sizeof(scalar_t) / sizeof(real_t);
+
+    if (precision == TilePrecision::Working)
+        return;
+
+    bool bf16 = precision == TilePrecision::BFloat16;
+    for (int64_t j = 0; j < A.nb(); ++j) {
+        for (int64_t i = 0; i < A.mb(); ++i) {
+            real_t* a = reinterpret_cast<real_t*>( &A.at(i, j) );
+            for (int k = 0; k < parts; ++k) {
+                a[ k ] = real_t( bf16
+                    ? bfloat16_to_float( float_to_bfloat16( float( a[ k ] ) ) )
+                    : half_to_float( float_to_half( float( a[ k ] ) ) ) );
+            }
+        }
+    }
+}
+
+//-----------------------------------------
+/// Converts rvalue refs to lvalue refs.
+///
+template <typename scalar_t>
+void round16(TilePrecision precision, Tile<scalar_t>&& A)
+{
+    round16(precision, A);
+}
+
 } // namespace tile
 
 } // namespace slate
@@ -42,6 +42,7 @@ typedef char slate_MethodGemm; /* enum */           ///< slate::MethodGemm
 const slate_MethodGemm slate_MethodGemm_Auto = '*'; ///< slate::MethodGemm::Auto
 const slate_MethodGemm slate_MethodGemm_A    = 'A'; ///< slate::MethodGemm::A
 const slate_MethodGemm slate_MethodGemm_C    = 'C'; ///< slate::MethodGemm::C
+const slate_MethodGemm slate_MethodGemm_Strassen = 'S'; ///< slate::MethodGemm::Strassen
 // end slate_MethodGemm
 
 typedef char slate_MethodHemm; /* enum */           ///< slate::MethodHemm
@@ -56,6 +57,8 @@ const slate_MethodCholQR slate_MethodCholQR_GemmA = 'A'; ///< slate::MethodCholQ
 const slate_MethodCholQR slate_MethodCholQR_GemmC = 'C'; ///< slate::MethodCholQR::GemmC
 const slate_MethodCholQR slate_MethodCholQR_HerkA = 'R'; ///< slate::MethodCholQR::HerkA
 const slate_MethodCholQR slate_MethodCholQR_HerkC = 'K'; ///< slate::MethodCholQR::HerkC
+const slate_MethodCholQR slate_MethodCholQR_CholQR2      = '2'; ///< slate::MethodCholQR::CholQR2
+const slate_MethodCholQR slate_MethodCholQR_ShiftCholQR3 = '3'; ///< slate::MethodCholQR::ShiftCholQR3
 // end slate_MethodCholQR
 
 typedef char slate_MethodGels; /* enum */             ///< slate::MethodGels
@@ -79,6 +82,7 @@ const slate_MethodEig slate_MethodEig_QR        = 'Q'; ///< slate::MethodEig::QR
 const slate_MethodEig slate_MethodEig_DC        = 'D'; ///< slate::MethodEig::DC
 const slate_MethodEig slate_MethodEig_Bisection = 'B'; ///< slate::MethodEig::Bisection
 const slate_MethodEig slate_MethodEig_MRRR      = 'M'; ///< slate::MethodEig::MRRR
+const slate_MethodEig slate_MethodEig_QDWH      = 'W'; ///< slate::MethodEig::QDWH
 // end slate_MethodEig
 
 typedef char slate_MethodSVD; /* enum */               ///< slate::MethodSVD
@@ -88,6 +92,18 @@ const slate_MethodSVD slate_MethodSVD_DC        = 'D'; ///< slate::MethodSVD::DC
 const slate_MethodSVD slate_MethodSVD_Bisection = 'B'; ///< slate::MethodSVD::Bisection
 // end slate_MethodSVD
 
+typedef char slate_MethodHesv; /* enum */            ///< slate::MethodHesv
+const slate_MethodHesv slate_MethodHesv_Auto  = '*'; ///< slate::MethodHesv::Auto
+const slate_MethodHesv slate_MethodHesv_Aasen = 'A'; ///< slate::MethodHesv::Aasen
+const slate_MethodHesv slate_MethodHesv_RBT   = 'R'; ///< slate::MethodHesv::RBT
+// end slate_MethodHesv
+
+typedef char slate_TilePrecision; /* enum */                  ///< slate::TilePrecision
+const slate_TilePrecision slate_TilePrecision_Working  = 'W'; ///< slate::TilePrecision::Working
+const slate_TilePrecision slate_TilePrecision_Half     = 'H'; ///< slate::TilePrecision::Half
+const slate_TilePrecision slate_TilePrecision_BFloat16 = 'B'; ///< slate::TilePrecision::BFloat16
+// end slate_TilePrecision
+
 // todo: auto sync with include/slate/enums.hh
 typedef char slate_Option; /* enum */                      ///< slate::Option
 const slate_Option slate_Option_ChunkSize            =  0; ///< slate::Option::ChunkSize
@@ -102,6 +118,8 @@ const slate_Option slate_Option_Depth                =  8; ///< slate::Option::H
 const slate_Option slate_Option_MaxIterations        =  9; ///< slate::Option::HoldLocalWorkspace
 const slate_Option slate_Option_UseFallbackSolver    = 10; ///< slate::Option::HoldLocalWorkspace
 const slate_Option slate_Option_PivotThreshold       = 11; ///< slate::Option::PivotThreshold
+const slate_Option slate_Option_NormEstColumns       = 12; ///< slate::Option::NormEstColumns
+const slate_Option slate_Option_TilePrecision        = 13; ///< slate::Option::TilePrecision
 const slate_Option slate_Option_PrintVerbose         = 50; ///< slate::Option::PrintVerbose
 const slate_Option slate_Option_PrintEdgeItems       = 51; ///< slate::Option::PrintEdgeItems
 const slate_Option slate_Option_PrintWidth           = 52; ///< slate::Option::PrintWidth
@@ -113,6 +131,8 @@ const slate_Option slate_Option_MethodGemm           = 63; ///< slate::Option::M
 const slate_Option slate_Option_MethodHemm           = 64; ///< slate::Option::MethodHemm
 const slate_Option slate_Option_MethodLU             = 65; ///< slate::Option::MethodLU
 const slate_Option slate_Option_MethodTrsm           = 66; ///< slate::Option::MethodTrsm
+const slate_Option slate_Option_MethodSVD            = 67; ///< slate::Option::MethodSVD
+const slate_Option slate_Option_MethodHesv           = 68; ///< slate::Option::MethodHesv
 // end slate_Option
 
 typedef short slate_MOSI_State;
@@ -73,6 +73,191 @@ inline void gpu_aware_mpi( bool value )
     return GPU_Aware_MPI::value( value );
 }
 
+//------------------------------------------------------------------------------
+/// Query whether MPI requests are progressed by a dedicated thread.
+class MPI_Progress
+{
+public:
+    /// @see bool mpi_progress()
+    static bool value()
+    {
+        return instance().mpi_progress_;
+    }
+
+    /// @see void mpi_progress( bool )
+    static void value( bool val )
+    {
+        instance().mpi_progress_ = val;
+    }
+
+private:
+    /// @return MPI_Progress singleton.
+    /// Uses thread-safe Scott Meyers' singleton to query on first call only.
+    static MPI_Progress& instance()
+    {
+        static MPI_Progress instance_;
+        return instance_;
+    }
+
+    /// Constructor checks $SLATE_MPI_PROGRESS.
+    MPI_Progress()
+    {
+        const char* env = getenv( "SLATE_MPI_PROGRESS" );
+        mpi_progress_ = env != nullptr
+                        && (strcmp( env, "" ) == 0
+                            || strcmp( env, "1" ) == 0);
+    }
+
+    //----------------------------------------
+    // Data
+
+    /// Cached value whether to use the MPI progress thread.
+    bool mpi_progress_;
+};
+
+//------------------------------------------------------------------------------
+/// @return true if nonblocking MPI requests are completed by a dedicated
+/// progress thread, letting waiting tasks yield to other OpenMP tasks.
+/// Initially checks if environment variable $SLATE_MPI_PROGRESS is set
+/// and either empty or 1. Can be overridden by mpi_progress( bool ).
+/// Requires MPI_THREAD_MULTIPLE; otherwise it is ignored.
+inline bool mpi_progress()
+{
+    return MPI_Progress::value();
+}
+
+//------------------------------------------------------------------------------
+/// Set whether to use the MPI progress thread. Overrides $SLATE_MPI_PROGRESS.
+/// @param[in] value: true to use the MPI progress thread.
+inline void mpi_progress( bool value )
+{
+    return MPI_Progress::value( value );
+}
+
+//------------------------------------------------------------------------------
+/// Query whether permuteRows aggregates row swaps across block columns.
+class Aggregate_Swaps
+{
+public:
+    /// @see bool aggregate_swaps()
+    static bool value()
+    {
+        return instance().aggregate_swaps_;
+    }
+
+    /// @see void aggregate_swaps( bool )
+    static void value( bool val )
+    {
+        instance().aggregate_swaps_ = val;
+    }
+
+private:
+    /// @return Aggregate_Swaps singleton.
+    /// Uses thread-safe Scott Meyers' singleton to query on first call only.
+    static Aggregate_Swaps& instance()
+    {
+        static Aggregate_Swaps instance_;
+        return instance_;
+    }
+
+    /// Constructor checks $SLATE_AGGREGATE_SWAPS.
+    Aggregate_Swaps()
+    {
+        const char* env = getenv( "SLATE_AGGREGATE_SWAPS" );
+        aggregate_swaps_ = env != nullptr
+                           && (strcmp( env, "" ) == 0
+                               || strcmp( env, "1" ) == 0);
+    }
+
+    //----------------------------------------
+    // Data
+
+    /// Cached value whether to aggregate row swaps.
+    bool aggregate_swaps_;
+};
+
+//------------------------------------------------------------------------------
+/// @return true if the host permuteRows swaps all block columns owned by
+/// the same ranks in one exchange, instead of one exchange per block column.
+/// Initially checks if environment variable $SLATE_AGGREGATE_SWAPS is set
+/// and either empty or 1. Can be overridden by aggregate_swaps( bool ).
+inline bool aggregate_swaps()
+{
+    return Aggregate_Swaps::value();
+}
+
+//------------------------------------------------------------------------------
+/// Set whether to aggregate row swaps. Overrides $SLATE_AGGREGATE_SWAPS.
+/// @param[in] value: true to aggregate row swaps across block columns.
+inline void aggregate_swaps( bool value )
+{
+    return Aggregate_Swaps::value( value );
+}
+
+//------------------------------------------------------------------------------
+/// Query the number of host NUMA domains that tiles are distributed over.
+class NumaDomains
+{
+public:
+    /// @see int numa_domains()
+    static int value()
+    {
+        return instance().numa_domains_;
+    }
+
+    /// @see void numa_domains( int )
+    static void value( int val )
+    {
+        instance().numa_domains_ = val < 1 ? 1 : val;
+    }
+
+private:
+    /// @return NumaDomains singleton.
+    /// Uses thread-safe Scott Meyers' singleton to query on first call only.
+    static NumaDomains& instance()
+    {
+        static NumaDomains instance_;
+        return instance_;
+    }
+
+    /// Constructor checks $SLATE_NUMA_DOMAINS.
+    NumaDomains()
+    {
+        const char* env = getenv( "SLATE_NUMA_DOMAINS" );
+        numa_domains_ = env != nullptr ? atoi( env ) : 1;
+        if (numa_domains_ < 1)
+            numa_domains_ = 1;
+    }
+
+    //----------------------------------------
+    // Data
+
+    /// Cached number of host NUMA domains.
+    int numa_domains_;
+};
+
+//------------------------------------------------------------------------------
+/// @return number of host NUMA domains per rank that local tiles are
+/// distributed over, for matrices created afterwards. With more than one,
+/// host tiles are first touched by threads of their owning domain and
+/// HostTask routines run tile tasks on threads of that domain,
+/// see BaseMatrix::tileNumaDomain().
+/// Initially $SLATE_NUMA_DOMAINS, or 1 if unset. Can be overridden by
+/// numa_domains( int ). Threads are assigned to domains by their OpenMP
+/// place, so OMP_PLACES (e.g., cores) and OMP_PROC_BIND should be set.
+inline int numa_domains()
+{
+    return NumaDomains::value();
+}
+
+//------------------------------------------------------------------------------
+/// Set number of host NUMA domains. Overrides $SLATE_NUMA_DOMAINS.
+/// @param[in] value: number of NUMA domains, at least 1.
+inline void numa_domains( int value )
+{
+    return NumaDomains::value( value );
+}
+
 }  // namespace slate
 
 #endif // SLATE_CONFIG_HH
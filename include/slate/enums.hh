@@ -109,6 +109,7 @@ enum class MethodGemm : char {
     Auto      = '*',    ///< Let SLATE decide
     A         = 'A',    ///< Matrix A is stationary, C is sent; use when C is small
     C         = 'C',    ///< Matrix C is stationary, A is sent; use when C is large
+    Strassen  = 'S',    ///< Strassen-Winograd recursion; fewer flops, less accurate
     GemmA [[deprecated("Use A. To be removed 2025-05.")]] = 'A',
     GemmC [[deprecated("Use C. To be removed 2025-05.")]] = 'C',
 };
@@ -122,6 +123,7 @@ inline const char* to_c_string( MethodGemm value )
         case MethodGemm::Auto: return "auto";
         case MethodGemm::A:    return "A";
         case MethodGemm::C:    return "C";
+        case MethodGemm::Strassen: return "Strassen";
     }
     return "?";
 }
@@ -144,6 +146,8 @@ inline void from_string( std::string const& str, MethodGemm* val )
         *val = MethodGemm::A;
     else if (str_ == "c" || str_ == "gemmc")
         *val = MethodGemm::C;
+    else if (str_ == "s" || str_ == "strassen")
+        *val = MethodGemm::Strassen;
     else
         throw Exception( "unknown gemm method: " + str );
 }
@@ -205,6 +209,8 @@ enum class MethodCholQR : char {
     GemmC     = 'C',    ///< Use gemm-C algorithm to compute A^H A
     HerkA     = 'R',    ///< Use herk-A algorithm to compute A^H A; not yet implemented
     HerkC     = 'K',    ///< Use herk-C algorithm to compute A^H A
+    CholQR2   = '2',    ///< Two CholQR passes (CholeskyQR2)
+    ShiftCholQR3 = '3', ///< Shifted CholQR pass, then CholQR2 (shifted CholeskyQR3)
 };
 
 extern const char* MethodCholQR_help;
@@ -218,6 +224,8 @@ inline const char* to_c_string( MethodCholQR value )
         case MethodCholQR::GemmC: return "gemmC";
         case MethodCholQR::HerkA: return "herkA";
         case MethodCholQR::HerkC: return "herkC";
+        case MethodCholQR::CholQR2: return "cholQR2";
+        case MethodCholQR::ShiftCholQR3: return "sCholQR3";
     }
     return "?";
 }
@@ -244,6 +252,10 @@ inline void from_string( std::string const& str, MethodCholQR* val )
         *val = MethodCholQR::HerkA;
     else if (str_ == "herkc")
         *val = MethodCholQR::HerkC;
+    else if (str_ == "cholqr2" || str_ == "2")
+        *val = MethodCholQR::CholQR2;
+    else if (str_ == "scholqr3" || str_ == "3")
+        *val = MethodCholQR::ShiftCholQR3;
     else
         throw Exception( "unknown Cholesky QR method: " + str );
 }
@@ -362,6 +374,7 @@ enum class MethodEig : char {
     DC        = 'D',    ///< Divide and conquer
     Bisection = 'B',    ///< Bisection; not yet implemented
     MRRR      = 'M',    ///< Multiple Relatively Robust Representations (MRRR); not yet implemented
+    QDWH      = 'W',    ///< QDWH-based spectral divide and conquer, without tridiagonal reduction
 };
 
 extern const char* MethodEig_help;
@@ -375,6 +388,7 @@ inline const char* to_c_string( MethodEig value )
         case MethodEig::DC:        return "DC";
         case MethodEig::Bisection: return "Bisection";
         case MethodEig::MRRR:      return "MRRR";
+        case MethodEig::QDWH:      return "QDWH";
     }
     return "?";
 }
@@ -401,6 +415,8 @@ inline void from_string( std::string const& str, MethodEig* val )
         *val = MethodEig::Bisection;
     else if (str_ == "mrrr")
         *val = MethodEig::MRRR;
+    else if (str_ == "qdwh")
+        *val = MethodEig::QDWH;
     else
         throw Exception( "unknown eig method: " + str );
 }
@@ -454,6 +470,99 @@ inline void from_string( std::string const& str, MethodSVD* val )
         throw Exception( "unknown SVD method: " + str );
 }
 
+//------------------------------------------------------------------------------
+/// Algorithm to use for Hermitian indefinite factorization and solve (hesv).
+/// @ingroup method
+///
+enum class MethodHesv : char {
+    Auto  = '*',        ///< Let SLATE decide
+    Aasen = 'A',        ///< Aasen's 2-stage LTL^H with pivoting
+    RBT   = 'R',        ///< Random Butterfly Transform (RBT) with LDL^H, no pivoting
+};
+
+extern const char* MethodHesv_help;
+
+//-----------------------------------
+inline const char* to_c_string( MethodHesv value )
+{
+    switch (value) {
+        case MethodHesv::Auto:  return "auto";
+        case MethodHesv::Aasen: return "Aasen";
+        case MethodHesv::RBT:   return "RBT";
+    }
+    return "?";
+}
+
+//-----------------------------------
+inline std::string to_string( MethodHesv value )
+{
+    return to_c_string( value );
+}
+
+//-----------------------------------
+inline void from_string( std::string const& str, MethodHesv* val )
+{
+    std::string str_ = str;
+    std::transform( str_.begin(), str_.end(), str_.begin(), ::tolower );
+
+    if (str_ == "auto")
+        *val = MethodHesv::Auto;
+    else if (str_ == "aasen")
+        *val = MethodHesv::Aasen;
+    else if (str_ == "rbt")
+        *val = MethodHesv::RBT;
+    else
+        throw Exception( "unknown hesv method: " + str );
+}
+
+//------------------------------------------------------------------------------
+/// Precision in which a matrix's tiles are communicated,
+/// relative to the working precision of its scalar type.
+/// The 16-bit formats are converted in software on the CPU host;
+/// storage and computation are always in the working precision.
+/// @ingroup enum
+///
+enum class TilePrecision : char {
+    Working  = 'W',     ///< Working precision of the scalar type
+    Half     = 'H',     ///< IEEE half precision (fp16)
+    BFloat16 = 'B',     ///< bfloat16: 8-bit exponent, 8-bit significand
+};
+
+extern const char* TilePrecision_help;
+
+//-----------------------------------
+inline const char* to_c_string( TilePrecision value )
+{
+    switch (value) {
+        case TilePrecision::Working:  return "working";
+        case TilePrecision::Half:     return "fp16";
+        case TilePrecision::BFloat16: return "bf16";
+    }
+    return "?";
+}
+
+//-----------------------------------
+inline std::string to_string( TilePrecision value )
+{
+    return to_c_string( value );
+}
+
+//-----------------------------------
+inline void from_string( std::string const& str, TilePrecision* val )
+{
+    std::string str_ = str;
+    std::transform( str_.begin(), str_.end(), str_.begin(), ::tolower );
+
+    if (str_ == "w" || str_ == "working")
+        *val = TilePrecision::Working;
+    else if (str_ == "h" || str_ == "half" || str_ == "fp16")
+        *val = TilePrecision::Half;
+    else if (str_ == "b" || str_ == "bfloat16" || str_ == "bf16")
+        *val = TilePrecision::BFloat16;
+    else
+        throw Exception( "unknown tile precision: " + str );
+}
+
 //------------------------------------------------------------------------------
 /// Keys for options to pass to SLATE routines.
 /// @ingroup enum
@@ -468,10 +577,13 @@ enum class Option : char {
     Target,             ///< computation method (@see Target)
     HoldLocalWorkspace, ///< do not erase local workspace tiles for enabling
                         ///< resue of the tiles by the next routine
-    Depth,              ///< depth for the RBT solver
+    Depth,              ///< depth for the RBT solver and Strassen gemm
     MaxIterations,      ///< maximum iteration count
     UseFallbackSolver,  ///< whether to fallback to a robust solver if iterations do not converge
     PivotThreshold,     ///< threshold for pivoting, >= 0, <= 1
+    NormEstColumns,     ///< number of columns t for 1-norm estimation, >= 1
+    TilePrecision,      ///< precision to store and communicate low-precision
+                        ///< factors in mixed-precision solvers (@see TilePrecision)
 
     // Printing parameters
     PrintVerbose = 50,  ///< verbose, 0: no printing,
@@ -495,6 +607,7 @@ enum class Option : char {
     MethodLU,           ///< Select the LU (getrf) algorithm
     MethodTrsm,         ///< Select the trsm algorithm
     MethodSVD,          ///< Select the algorithm to compute singular values of bidiagonal matrix
+    MethodHesv,         ///< Select the Hermitian indefinite (hesv) algorithm
 };
 
 //------------------------------------------------------------------------------
@@ -527,6 +640,16 @@ enum class GridOrder : char {
     Unknown  = 'U',     ///< Unknown (e.g., if using lambda functions)
 };
 
+//------------------------------------------------------------------------------
+/// Host allocation of local tiles by Matrix::insertLocalTiles.
+/// @ingroup enum
+///
+enum class TileAlloc : char {
+    Individual = 'I',   ///< Each tile allocated separately
+    Slab       = 'S',   ///< One slab per rank, each tile contiguous
+    ScaLAPACK  = 'L',   ///< One slab per rank, as a ScaLAPACK local array
+};
+
 //------------------------------------------------------------------------------
 const int HostNum = -1;
 const int AllDevices = -2;
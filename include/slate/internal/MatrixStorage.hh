@@ -6,8 +6,10 @@
 #ifndef SLATE_STORAGE_HH
 #define SLATE_STORAGE_HH
 
+#include "slate/config.hh"
 #include "slate/func.hh"
 #include "slate/internal/Memory.hh"
+#include "slate/internal/Perf.hh"
 #include "slate/Tile.hh"
 #include "slate/types.hh"
 #include "slate/internal/util.hh"
@@ -17,7 +19,9 @@
 #include "lapack/device.hh"
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
+#include <map>
 #include <memory>
 #include <set>
 #include <utility>
@@ -187,6 +191,7 @@ protected:
     // used in constructor and destructor
     void initQueues();
     void destroyQueues();
+    void initNumaDomains(int64_t q);
 
 public:
     static int num_devices() { return Memory::num_devices_; };
@@ -255,6 +260,136 @@ public:
     scalar_t* allocWorkspaceBuffer(int device, int size);
     void      releaseWorkspaceBuffer(scalar_t* data, int device);
 
+    //--------------------------------------------------------------------------
+    // out-of-core
+
+    /// Backs host tiles allocated by SLATE with a memory-mapped scratch file
+    /// in scratch_dir. Must be called before inserting host tiles.
+    void setOutOfCore(std::string const& scratch_dir)
+    {
+        memory_.setOutOfCore( scratch_dir );
+    }
+
+    /// @return true if host tiles are backed by a memory-mapped file.
+    bool outOfCore() const { return memory_.outOfCore(); }
+
+    void tilePrefetch(ij_tuple ij);
+    void tileEvict(ij_tuple ij);
+
+    //--------------------------------------------------------------------------
+    // reduced-precision tile communication
+
+    /// Sets the precision in which tiles are broadcast.
+    void setTilePrecision(TilePrecision precision)
+    {
+        tile_precision_ = precision;
+    }
+
+    /// @return precision in which tiles are broadcast.
+    TilePrecision tilePrecision() const { return tile_precision_; }
+
+    //--------------------------------------------------------------------------
+    // host slab for local tiles
+
+    /// Allocates a host slab of count elements for the local tiles.
+    /// @see Memory::allocHostSlab
+    ///
+    /// @param[in] ld
+    ///     Leading dimension if the slab is a ScaLAPACK local array, else 0.
+    ///
+    scalar_t* allocHostSlab(int64_t count, int64_t ld)
+    {
+        slate_assert( host_slab_ == nullptr );
+        host_slab_ = (scalar_t*) memory_.allocHostSlab( sizeof(scalar_t) * count );
+        host_slab_stride_ = ld;
+        return host_slab_;
+    }
+
+    /// @return host slab holding the local tiles, or nullptr.
+    scalar_t* hostSlab() const { return host_slab_; }
+
+    /// @return leading dimension of the host slab as a ScaLAPACK local
+    /// array, or 0.
+    int64_t hostSlabStride() const { return host_slab_stride_; }
+
+    //--------------------------------------------------------------------------
+    // host NUMA domains of local tiles
+
+    /// Sets the host NUMA domain of each tile, in [0, num_domains).
+    void setTileNumaDomain(
+        int num_domains, std::function<int (ij_tuple ij)> const& inTileNumaDomain)
+    {
+        slate_assert( num_domains >= 1 );
+        num_numa_domains_ = num_domains;
+        tileNumaDomain = inTileNumaDomain;
+    }
+
+    /// @return number of host NUMA domains that tiles are distributed over.
+    int numNumaDomains() const { return num_numa_domains_; }
+
+    //--------------------------------------------------------------------------
+    // one-sided (MPI RMA) tile access
+
+    /// Location of a tile's host data on its owning rank,
+    /// as exposed in the RMA window.
+    struct WindowTile {
+        MPI_Aint disp;      ///< address of the data on the owner
+        int64_t  stride;    ///< leading dimension
+        Layout   layout;    ///< layout of the data
+    };
+
+    void tileWindowCreate(MPI_Comm mpi_comm);
+    void tileWindowFree();
+
+    /// @return true if the RMA window exposing local tiles is open.
+    bool tileWindowIsOpen() const { return tile_window_open_; }
+
+    /// @return RMA window exposing local tiles.
+    MPI_Win tileWindow() const { return tile_window_; }
+
+    /// @return location of remote tile {i, j} in the RMA window.
+    /// Throws exception if the window isn't open or the tile wasn't exposed.
+    WindowTile const& tileWindowAt(ij_tuple ij) const
+    {
+        slate_assert( tileWindowIsOpen() );
+        return tile_window_map_.at( ij );
+    }
+
+    //--------------------------------------------------------------------------
+    // communication counters
+
+    /// Counts one tile message sent, while perf::Perf is enabled.
+    void countSend(int64_t bytes)
+    {
+        if (perf::Perf::enabled()) {
+            bytes_sent_ += bytes;
+            msgs_sent_  += 1;
+            perf::Perf::send( bytes );
+        }
+    }
+
+    /// Counts one tile message received, while perf::Perf is enabled.
+    void countRecv(int64_t bytes)
+    {
+        if (perf::Perf::enabled()) {
+            bytes_recv_ += bytes;
+            msgs_recv_  += 1;
+            perf::Perf::recv( bytes );
+        }
+    }
+
+    /// @return tile messages and bytes this matrix sent and received;
+    /// other counters are zero.
+    perf::Counters commCounters() const
+    {
+        perf::Counters counters;
+        counters.bytes_sent = bytes_sent_;
+        counters.bytes_recv = bytes_recv_;
+        counters.msgs_sent  = msgs_sent_;
+        counters.msgs_recv  = msgs_recv_;
+        return counters;
+    }
+
 private:
     // Iterator routines should be called only within a Tiles Map LockGuard.
     // Otherwise, there may be race conditions with the returned iterator.
@@ -340,6 +475,7 @@ public:
     std::function<int64_t (int64_t j)> tileNb;
     std::function<int (ij_tuple ij)> tileRank;
     std::function<int (ij_tuple ij)> tileDevice;
+    std::function<int (ij_tuple ij)> tileNumaDomain;
 
     //--------------------------------------------------------------------------
     /// @return whether tile {i, j} is local.
@@ -472,6 +608,29 @@ private:
 
     // device pointers arrays for batch GEMM
     std::vector< std::vector< scalar_t** > > array_dev_;
+
+    // RMA window exposing local host tiles, the memory regions attached to
+    // it, and the location of every exposed remote tile.
+    MPI_Win tile_window_ = MPI_WIN_NULL;
+    bool tile_window_open_ = false;
+    std::vector<char*> tile_window_regions_;
+    std::map< ij_tuple, WindowTile > tile_window_map_;
+
+    // precision of tiles on the wire, for setTilePrecision()
+    TilePrecision tile_precision_ = TilePrecision::Working;
+
+    // host slab of the local tiles, owned by memory_, for allocHostSlab()
+    scalar_t* host_slab_ = nullptr;
+    int64_t host_slab_stride_ = 0;
+
+    // number of host NUMA domains, for tileNumaDomain
+    int num_numa_domains_ = 1;
+
+    // tile messages and bytes sent and received, for commCounters()
+    std::atomic<int64_t> bytes_sent_{ 0 };
+    std::atomic<int64_t> bytes_recv_{ 0 };
+    std::atomic<int64_t> msgs_sent_{ 0 };
+    std::atomic<int64_t> msgs_recv_{ 0 };
 };
 
 //------------------------------------------------------------------------------
@@ -509,6 +668,7 @@ MatrixStorage<scalar_t>::MatrixStorage(
             return HostNum;
         };
     }
+    initNumaDomains( q );
 
     initQueues();
     omp_init_nest_lock(&lock_);
@@ -536,17 +696,43 @@ MatrixStorage<scalar_t>::MatrixStorage(
     slate_mpi_call(
         MPI_Comm_rank(mpi_comm, &mpi_rank_));
 
+    // Cycle over domains by local block column, as for ScaLAPACK-like
+    // 2D block cyclic distributions; else by block column.
+    int q = 1;
+    if (numa_domains() > 1) {
+        GridOrder order;
+        int p;
+        if (! func::is_2d_cyclic_grid( mt, nt, tileRank, &order, &p, &q ))
+            q = 1;
+    }
+    initNumaDomains( q );
+
     initQueues();
     omp_init_nest_lock(&lock_);
 }
 
 //------------------------------------------------------------------------------
 /// Destructor deletes all tiles and frees workspace buffers.
+/// An RMA window from tileWindowCreate() must be freed first with the
+/// collective tileWindowFree(), which the destructor can't call.
 ///
 template <typename scalar_t>
 MatrixStorage<scalar_t>::~MatrixStorage()
 {
     try {
+        assert( ! tileWindowIsOpen() );
+        if (tileWindowIsOpen() && tile_window_ != MPI_WIN_NULL) {
+            // Without asserts, detach the exposed regions locally,
+            // so the window doesn't reference freed memory.
+            // The window itself is leaked.
+            MPI_Win_unlock_all( tile_window_ );
+            for (char* region : tile_window_regions_) {
+                MPI_Win_detach( tile_window_, region );
+            }
+            tile_window_regions_.clear();
+            tile_window_open_ = false;
+        }
+
         clear();
         clearBatchArrays();
         // Clear all host and device memory allocations
@@ -589,6 +775,30 @@ void MatrixStorage<scalar_t>::initQueues()
     array_dev_ .at(0).resize(num_devices(), nullptr);
 }
 
+//------------------------------------------------------------------------------
+/// Initializes the host NUMA domains of tiles: numa_domains() domains,
+/// assigned 1d block cyclic like tileDevice, so the local tiles of a
+/// 2D block cyclic distribution cycle over domains by local block column.
+/// Called in constructor.
+///
+/// @param[in] q
+///     The number of columns in the process grid.
+///
+template <typename scalar_t>
+void MatrixStorage<scalar_t>::initNumaDomains(int64_t q)
+{
+    num_numa_domains_ = numa_domains();
+    if (num_numa_domains_ > 1) {
+        tileNumaDomain = func::device_1d_grid( GridOrder::Row, q,
+                                               num_numa_domains_ );
+    }
+    else {
+        tileNumaDomain = []( ij_tuple ij ) {
+            return 0;
+        };
+    }
+}
+
 //------------------------------------------------------------------------------
 /// Destroys BLAS++ compute and communication queues on each device.
 /// As this is called in the destructor, it should NOT throw exceptions.
@@ -727,6 +937,167 @@ void MatrixStorage<scalar_t>::clearBatchArrays()
     batch_array_size_ = 0;
 }
 
+//------------------------------------------------------------------------------
+/// Hints that the host instance of tile {i, j} will be used soon,
+/// so that, in out-of-core mode, it is read in asynchronously.
+/// Does nothing if the host instance doesn't exist or isn't out-of-core.
+template <typename scalar_t>
+void MatrixStorage<scalar_t>::tilePrefetch(ij_tuple ij)
+{
+    LockGuard guard(getTilesMapLock());
+    auto iter = find( {std::get<0>(ij), std::get<1>(ij), HostNum} );
+    if (iter != end()) {
+        Tile<scalar_t>* tile = iter->second->at( HostNum );
+        memory_.prefetchHost( tile->data(), tile->bytes() );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Hints that the host instance of tile {i, j} will not be used soon,
+/// so that, in out-of-core mode, it is dropped from RAM, after being
+/// written back to the scratch file if Modified. The tile's MOSI state
+/// is unchanged, since the file keeps a valid copy.
+/// Does nothing if the host instance doesn't exist, is on hold,
+/// or isn't out-of-core.
+template <typename scalar_t>
+void MatrixStorage<scalar_t>::tileEvict(ij_tuple ij)
+{
+    LockGuard guard(getTilesMapLock());
+    auto iter = find( {std::get<0>(ij), std::get<1>(ij), HostNum} );
+    if (iter != end()) {
+        Tile<scalar_t>* tile = iter->second->at( HostNum );
+        if (! tile->stateOn( MOSI::OnHold )) {
+            memory_.evictHost( tile->data(), tile->bytes(),
+                               tile->stateOn( MOSI::Modified ) );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Creates an MPI RMA window exposing the host instances of all local tiles,
+/// and exchanges their locations, so any rank can fetch them with MPI_Rget
+/// without the owner participating. The window is held in a passive-target
+/// epoch (MPI_Win_lock_all) until tileWindowFree().
+/// Collective over mpi_comm.
+///
+/// While the window is open, exposed tiles must not be erased,
+/// reallocated, or converted to another layout, and the matrix storage
+/// must not be destroyed: call tileWindowFree() before the last matrix
+/// sharing this storage goes out of scope. Updates made by the owner
+/// must be ordered before remote fetches by other synchronization,
+/// e.g., task dependencies completed before a barrier or message.
+///
+template <typename scalar_t>
+void MatrixStorage<scalar_t>::tileWindowCreate(MPI_Comm mpi_comm)
+{
+    slate_assert( ! tileWindowIsOpen() );
+    tile_window_open_ = true;
+
+    // With one rank there is nothing to fetch. Skipping the window also
+    // avoids MPI implementations whose shared-memory RMA component lacks
+    // dynamic windows.
+    int mpi_size;
+    slate_mpi_call( MPI_Comm_size( mpi_comm, &mpi_size ) );
+    if (mpi_size == 1)
+        return;
+
+    slate_mpi_call(
+        MPI_Win_create_dynamic( MPI_INFO_NULL, mpi_comm, &tile_window_ ));
+
+    // Each local tile is described by 5 int64: i, j, address, stride, layout.
+    const int entry_size = 5;
+    std::vector<int64_t> local_entries;
+    // Memory ranges [begin, end) spanned by local tiles. Tiles of a matrix
+    // created from user data may interleave, so ranges are merged below
+    // before being attached, since attached regions may not overlap.
+    std::vector< std::pair<char*, char*> > ranges;
+    {
+        LockGuard guard( getTilesMapLock() );
+        for (auto iter = begin(); iter != end(); ++iter) {
+            ij_tuple ij = iter->first;
+            if (tileIsLocal( ij ) && iter->second->existsOn( HostNum )) {
+                Tile<scalar_t>* tile = iter->second->at( HostNum );
+                int64_t extent = tile->layout() == Layout::ColMajor
+                    ? (tile->nb() - 1)*tile->stride() + tile->mb()
+                    : (tile->mb() - 1)*tile->stride() + tile->nb();
+                char* data = (char*) tile->data();
+                ranges.push_back( { data, data + extent*sizeof(scalar_t) } );
+
+                MPI_Aint disp;
+                slate_mpi_call( MPI_Get_address( tile->data(), &disp ) );
+                local_entries.insert( local_entries.end(), {
+                    std::get<0>( ij ), std::get<1>( ij ), int64_t( disp ),
+                    tile->stride(), int64_t( tile->layout() ) } );
+            }
+        }
+    }
+
+    std::sort( ranges.begin(), ranges.end() );
+    for (size_t k = 0; k < ranges.size(); ) {
+        char* range_begin = ranges[ k ].first;
+        char* range_end   = ranges[ k ].second;
+        for (++k; k < ranges.size() && ranges[ k ].first < range_end; ++k) {
+            range_end = std::max( range_end, ranges[ k ].second );
+        }
+        slate_mpi_call(
+            MPI_Win_attach( tile_window_, range_begin,
+                            MPI_Aint( range_end - range_begin ) ));
+        tile_window_regions_.push_back( range_begin );
+    }
+
+    // Exchange locations of all local tiles.
+    int local_count = int( local_entries.size() );
+    std::vector<int> counts( mpi_size ), displs( mpi_size );
+    slate_mpi_call(
+        MPI_Allgather( &local_count, 1, MPI_INT,
+                       counts.data(), 1, MPI_INT, mpi_comm ));
+    int total = 0;
+    for (int rank = 0; rank < mpi_size; ++rank) {
+        displs[ rank ] = total;
+        total += counts[ rank ];
+    }
+    std::vector<int64_t> entries( total );
+    slate_mpi_call(
+        MPI_Allgatherv( local_entries.data(), local_count, MPI_INT64_T,
+                        entries.data(), counts.data(), displs.data(),
+                        MPI_INT64_T, mpi_comm ));
+
+    for (int k = 0; k < total; k += entry_size) {
+        ij_tuple ij = { entries[ k ], entries[ k+1 ] };
+        if (! tileIsLocal( ij )) {
+            tile_window_map_[ ij ] = WindowTile {
+                MPI_Aint( entries[ k+2 ] ), entries[ k+3 ],
+                Layout( entries[ k+4 ] ) };
+        }
+    }
+
+    slate_mpi_call( MPI_Win_lock_all( MPI_MODE_NOCHECK, tile_window_ ) );
+}
+
+//------------------------------------------------------------------------------
+/// Closes the passive-target epoch and frees the RMA window created by
+/// tileWindowCreate(). Does nothing if the window isn't open.
+/// Collective over the communicator the window was created with.
+///
+template <typename scalar_t>
+void MatrixStorage<scalar_t>::tileWindowFree()
+{
+    if (! tileWindowIsOpen())
+        return;
+
+    tile_window_open_ = false;
+    if (tile_window_ == MPI_WIN_NULL)
+        return;
+
+    slate_mpi_call( MPI_Win_unlock_all( tile_window_ ) );
+    for (char* region : tile_window_regions_) {
+        slate_mpi_call( MPI_Win_detach( tile_window_, region ) );
+    }
+    slate_mpi_call( MPI_Win_free( &tile_window_ ) );
+    tile_window_regions_.clear();
+    tile_window_map_.clear();
+}
+
 //------------------------------------------------------------------------------
 /// Reserves num_tiles on host in allocator.
 template <typename scalar_t>
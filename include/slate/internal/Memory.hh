@@ -12,8 +12,10 @@
 #include <iostream>
 #include <iomanip>
 
+#include <atomic>
 #include <map>
 #include <stack>
+#include <string>
 
 #include "blas.hh"
 
@@ -26,6 +28,17 @@ namespace slate {
 /// Allocates workspace blocks for host and GPU devices.
 /// Currently assumes a fixed-size block of block_size bytes,
 /// e.g., block_size = sizeof(scalar_t) * mb * nb.
+///
+/// By default, host blocks are allocated individually with new[].
+/// If out-of-core mode is enabled with setOutOfCore(), host blocks are
+/// instead carved from segments of a memory-mapped scratch file, so the
+/// host memory can exceed the physical RAM. The kernel's page cache then
+/// acts as the residency manager: clean pages are dropped and dirty pages
+/// are written back under memory pressure. prefetchHost() and evictHost()
+/// give hints to that manager based on the algorithm's lookahead.
+///
+/// allocHostSlab() allocates one large, huge-page backed host region,
+/// from which a matrix can carve all its local tiles.
 class Memory {
 public:
     friend class Debug;
@@ -41,12 +54,22 @@ public:
     ~Memory();
 
     // todo: change add* to reserve*?
-    void addHostBlocks(int64_t num_blocks) { /* No host pool currently */ }
+    void addHostBlocks(int64_t num_blocks);
     void addDeviceBlocks(int device, int64_t num_blocks, blas::Queue *queue);
 
-    void clearHostBlocks() { /* No host pool currently */ }
+    void clearHostBlocks();
     void clearDeviceBlocks(int device, blas::Queue *queue);
 
+    void setOutOfCore(std::string const& scratch_dir);
+
+    /// @return true if host blocks are backed by a memory-mapped file.
+    bool outOfCore() const { return host_fd_ >= 0; }
+
+    void* allocHostSlab(size_t size);
+
+    void prefetchHost(void const* ptr, size_t size) const;
+    void evictHost(void const* ptr, size_t size, bool modified) const;
+
     void* alloc(int device, size_t size, blas::Queue *queue);
     void free(void* block, int device);
 
@@ -55,7 +78,7 @@ public:
     size_t available(int device) const
     {
         if (device == HostNum)
-            return 0;
+            return host_free_blocks_.size();
         else
             return free_blocks_.at(device).size();
     }
@@ -65,7 +88,7 @@ public:
     size_t capacity(int device) const
     {
         if (device == HostNum)
-            return 0;
+            return host_capacity_;
         else
             return capacity_.at(device);
     }
@@ -90,6 +113,8 @@ private:
     void freeHostMemory(void* host_mem);
     void freeDeviceMemory(int device, void* dev_mem, blas::Queue *queue);
 
+    bool isHostBlock(void const* ptr) const;
+
     // ----------------------------------------
     // member variables
     size_t block_size_;
@@ -98,6 +123,26 @@ private:
     std::vector< std::stack<void*> > free_blocks_;
     std::vector< std::stack<void*> > allocated_mem_;
     std::vector< size_t > capacity_;
+
+    // number of blocks to grow the out-of-core host pool by, when empty
+    static constexpr int64_t host_blocks_per_segment = 64;
+
+    // out-of-core host pool: scratch file and its mapped segments,
+    // keyed by segment address, with segment size in bytes
+    int host_fd_;
+    size_t host_file_size_;
+    std::stack<void*> host_free_blocks_;
+    std::map<char*, size_t> host_segments_;
+    size_t host_capacity_;
+
+    // host slabs, keyed by slab address, with slab size in bytes
+    std::map<char*, size_t> host_slabs_;
+
+    // blocks allocated while perf::Perf was enabled, with requested size
+    // in bytes, so free() can report the same size; and their count, so
+    // free() skips the lookup when there are none
+    std::map<void*, size_t> perf_sizes_;
+    std::atomic<int64_t> perf_blocks_;
 };
 
 } // namespace slate
@@ -0,0 +1,63 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef SLATE_MPI_PROGRESS_HH
+#define SLATE_MPI_PROGRESS_HH
+
+#include "slate/internal/mpi.hh"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Progress engine: a dedicated thread that drives nonblocking MPI requests
+/// to completion, so communication keeps moving while OpenMP threads are
+/// busy in long BLAS calls, and waiting tasks can yield instead of blocking
+/// in MPI_Wait.
+///
+/// Groups of requests are handed to the thread through a lock-free queue
+/// by post(). The thread polls them with MPI_Testsome and decrements the
+/// group's completion counter as each one finishes. If a request fails,
+/// its group's counter is set to the negated error code, which wait()
+/// reports, and the group's other requests are dropped; other groups are
+/// unaffected. The engine keeps no error state.
+/// The thread makes no MPI calls while it has no requests.
+///
+class MpiProgress {
+public:
+    static MpiProgress* engine();
+
+    ~MpiProgress();
+
+    void post(std::vector<MPI_Request>& requests, std::atomic<int>* pending);
+    void wait(std::atomic<int>* pending);
+
+private:
+    MpiProgress();
+    void run();
+
+    /// Queued group of requests and its completion counter.
+    struct Node {
+        std::vector<MPI_Request> requests;
+        std::atomic<int>* pending;
+        Node* next;
+    };
+
+    /// Head of the lock-free queue: a Treiber stack that post() pushes to
+    /// and the progress thread empties in one exchange.
+    std::atomic<Node*> incoming_;
+
+    std::atomic<bool> stop_;
+    std::thread thread_;
+};
+
+} // namespace internal
+} // namespace slate
+
+#endif // SLATE_MPI_PROGRESS_HH
@@ -0,0 +1,71 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef SLATE_PANEL_TEAM_HH
+#define SLATE_PANEL_TEAM_HH
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Persistent team of threads for multi-threaded panel factorizations.
+///
+/// A factorization creates one team, sized for Option::MaxPanelThreads,
+/// and hands every panel to it with run(), instead of opening a nested
+/// OpenMP parallel region per panel. The calling thread is thread 0 of the
+/// team, so MPI calls made by thread 0 stay on the calling thread.
+///
+/// Between panels, workers spin briefly with backoff, then sleep on a
+/// condition variable, so an idle team doesn't take cores from the
+/// trailing update tasks. With OpenMP places, each worker is bound to its
+/// own place, following the creating thread's place. Workers limit BLAS
+/// they call to one thread, as each worker is one thread of the panel.
+///
+class PanelTeam {
+public:
+    explicit PanelTeam(int size);
+    ~PanelTeam();
+
+    PanelTeam(PanelTeam const&) = delete;
+    PanelTeam& operator = (PanelTeam const&) = delete;
+
+    /// @return number of threads in the team, including the caller of run().
+    int size() const { return size_; }
+
+    void run(int num_threads, std::function<void (int thread_rank)> const& body);
+
+private:
+    void worker(int thread_rank);
+
+    int size_;
+    std::vector<std::thread> workers_;
+
+    // Current job, published by incrementing generation_.
+    std::function<void (int)> const* body_;
+    int num_threads_;
+    std::atomic<int64_t> generation_;
+    std::atomic<int> remaining_;
+    std::atomic<bool> stop_;
+
+    // Sleeping workers wait on wakeup_ for a new generation.
+    std::mutex mutex_;
+    std::condition_variable wakeup_;
+
+    // First exception thrown by a worker, rethrown by run().
+    std::exception_ptr exception_;
+};
+
+} // namespace internal
+} // namespace slate
+
+#endif // SLATE_PANEL_TEAM_HH
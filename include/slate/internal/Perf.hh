@@ -0,0 +1,151 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef SLATE_PERF_HH
+#define SLATE_PERF_HH
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <string>
+
+#include <blas.hh>
+
+#include "slate/internal/mpi.hh"
+
+namespace slate {
+namespace perf {
+
+//------------------------------------------------------------------------------
+/// Performance counters accumulated for one region.
+///
+struct Counters {
+    int64_t calls         = 0;  ///< number of times the region was entered
+    double  time          = 0;  ///< inclusive wall time, in seconds
+    double  mpi_wait      = 0;  ///< time blocked waiting on MPI, in seconds
+    double  flops         = 0;  ///< floating point operations
+    int64_t bytes_sent    = 0;  ///< tile bytes sent
+    int64_t bytes_recv    = 0;  ///< tile bytes received
+    int64_t msgs_sent     = 0;  ///< tile messages sent
+    int64_t msgs_recv     = 0;  ///< tile messages received
+    int64_t workspace_hwm = 0;  ///< high-water mark of Memory use, in bytes
+
+    /// Adds other's counters; takes max of the high-water marks.
+    Counters& operator += (Counters const& other)
+    {
+        calls      += other.calls;
+        time       += other.time;
+        mpi_wait   += other.mpi_wait;
+        flops      += other.flops;
+        bytes_sent += other.bytes_sent;
+        bytes_recv += other.bytes_recv;
+        msgs_sent  += other.msgs_sent;
+        msgs_recv  += other.msgs_recv;
+        workspace_hwm = std::max( workspace_hwm, other.workspace_hwm );
+        return *this;
+    }
+};
+
+/// Counters keyed by region path. Nested regions are joined by "::",
+/// e.g., "gesv::getrf::gemm" is internal gemm inside getrf inside gesv.
+using Report = std::map< std::string, Counters >;
+
+//------------------------------------------------------------------------------
+/// Per-call performance counters, a structured and thread-safe replacement
+/// for the slate::timers map. Disabled by default; when off, each hook is
+/// a single relaxed atomic load.
+///
+/// Each thread records into its own counters, which report() merges,
+/// so concurrent SLATE calls from different threads do not race.
+/// Counters are attributed to the innermost Region open on the calling
+/// thread. OpenMP tasks usually run on threads without an open Region;
+/// their counters go to the Region most recently opened, and still open,
+/// at an enclosing OpenMP nesting level, which for a single SLATE call is
+/// the driver's innermost region. With concurrent calls from threads at
+/// the same OpenMP level, such task counters may be attributed to either
+/// call. Regions may close in any order across threads.
+///
+/// The workspace high-water mark counts the bytes requested from Memory
+/// while enabled. Each open region keeps its own peak of the bytes in use,
+/// by any thread, while it is open.
+///
+class Perf {
+public:
+    static void on()  { enabled_.store( true ); }
+    static void off() { enabled_.store( false ); }
+    static bool enabled() { return enabled_.load( std::memory_order_relaxed ); }
+
+    static void clear();
+    static Report report();
+    static Report reduce(Report const& local, MPI_Comm comm, int root);
+
+    static void flops(double flops);
+    static void mpiWait(double seconds);
+    static void send(int64_t bytes);
+    static void recv(int64_t bytes);
+    static void memoryAlloc(int64_t bytes);
+    static void memoryFree(int64_t bytes);
+
+private:
+    static std::atomic<bool> enabled_;
+};
+
+//------------------------------------------------------------------------------
+/// Scoped region: from construction to destruction, time is added to the
+/// region's counters, nested under the calling thread's current region.
+///
+class Region {
+public:
+    Region(const char* name);
+    ~Region();
+
+    // not copyable
+    Region(Region const&) = delete;
+    Region& operator = (Region const&) = delete;
+
+    /// Adds flops performed by this region.
+    void flops(double flops) { flops_ += flops; }
+
+private:
+    bool active_;
+    int level_;
+    double start_;
+    double flops_;
+    std::string const* path_;
+};
+
+//------------------------------------------------------------------------------
+/// Scoped timer that charges its duration to the current region's
+/// mpi_wait counter. Wraps blocking waits such as MPI_Wait and MPI_Waitall.
+///
+class MpiWait {
+public:
+    MpiWait()
+        : start_( Perf::enabled() ? MPI_Wtime() : -1 )
+    {}
+
+    ~MpiWait()
+    {
+        if (start_ >= 0)
+            Perf::mpiWait( MPI_Wtime() - start_ );
+    }
+
+private:
+    double start_;
+};
+
+//------------------------------------------------------------------------------
+/// @return factor to convert real flops to flops for scalar_t:
+/// a complex multiply-add is 4 real multiply-adds.
+template <typename scalar_t>
+constexpr double flop_factor()
+{
+    return blas::is_complex<scalar_t>::value ? 4.0 : 1.0;
+}
+
+} // namespace perf
+} // namespace slate
+
+#endif // SLATE_PERF_HH
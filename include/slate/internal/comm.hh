@@ -11,6 +11,7 @@
 
 #include <list>
 #include <set>
+#include <vector>
 
 #include "slate/internal/mpi.hh"
 
@@ -27,6 +28,8 @@ void cubeBcastPattern(int size, int rank, int radix,
 void cubeReducePattern(int size, int rank, int radix,
                        std::list<int>& recv_from, std::list<int>& send_to);
 
+void waitAll(std::vector<MPI_Request>& requests);
+
 } // namespace internal
 } // namespace slate
 
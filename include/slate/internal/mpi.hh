@@ -52,6 +52,41 @@ public:
                 #call, slate_mpi_call_, __func__, __FILE__, __LINE__); \
     } while(0)
 
+namespace internal {
+
+bool mpi_thread_multiple();
+void mpi_critical_lock();
+void mpi_critical_unlock();
+
+//------------------------------------------------------------------------------
+/// Serializes MPI calls made from OpenMP threads, if MPI provides less than
+/// MPI_THREAD_MULTIPLE. With MPI_THREAD_MULTIPLE, it does nothing, so a
+/// blocking call such as the MPI_Bcast in Tile::bcast doesn't stall other
+/// threads' MPI calls, and broadcasts progress concurrently with the MPI
+/// progress thread (see mpi_progress()).
+/// Like LockGuard, the destructor unlocks if an exception is thrown.
+///
+class MpiCriticalGuard {
+public:
+    MpiCriticalGuard()
+        : locked_( ! mpi_thread_multiple() )
+    {
+        if (locked_)
+            mpi_critical_lock();
+    }
+
+    ~MpiCriticalGuard()
+    {
+        if (locked_)
+            mpi_critical_unlock();
+    }
+
+private:
+    bool locked_;
+};
+
+} // namespace internal
+
 } // namespace slate
 
 #endif // SLATE_MPI_HH
@@ -33,4 +33,28 @@
 // Defines a small class to wrap omp_set_max_active_levels()
 #include "slate/internal/OmpSetMaxActiveLevels.hh"
 
+#include <cstdint>
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// @return host NUMA domain, in [0, num_domains), of the calling thread.
+/// Assumes the OpenMP places (OMP_PLACES, e.g., cores) list the places of
+/// each domain consecutively, as proc_bind( spread ) does in
+/// Matrix::insertLocalTiles. Without places, threads are dealt cyclically.
+///
+inline int thread_numa_domain( int num_domains )
+{
+    int num_places = omp_get_num_places();
+    int place = omp_get_place_num();
+    if (num_places > 0 && place >= 0)
+        return int( int64_t( place ) * num_domains / num_places );
+    else
+        return omp_get_thread_num() % num_domains;
+}
+
+} // namespace internal
+} // namespace slate
+
 #endif // SLATE_OPENMP_HH
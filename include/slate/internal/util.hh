@@ -12,9 +12,12 @@
 #include "slate/internal/mpi.hh"
 
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 
 #include <blas.hh>
 #include <atomic>
+#include <thread>
 
 namespace slate {
 
@@ -143,6 +146,140 @@ inline /*constexpr*/ double cabs1(std::complex<double> x)
 }
 
 //------------------------------------------------------------------------------
+/// Converts float to bfloat16 (upper 16 bits of an IEEE single),
+/// rounding to nearest, ties to even. NaN stays a (quiet) NaN.
+/// @return bfloat16 bit pattern.
+inline uint16_t float_to_bfloat16( float x )
+{
+    uint32_t u;
+    std::memcpy( &u, &x, sizeof(u) );
+    if ((u & 0x7fffffff) > 0x7f800000)
+        return uint16_t( (u >> 16) | 0x0040 );
+    u += 0x7fff + ((u >> 16) & 1);
+    return uint16_t( u >> 16 );
+}
+
+//------------------------------------------------------------------------------
+/// Converts bfloat16 bit pattern to float; exact.
+inline float bfloat16_to_float( uint16_t h )
+{
+    uint32_t u = uint32_t( h ) << 16;
+    float x;
+    std::memcpy( &x, &u, sizeof(x) );
+    return x;
+}
+
+//------------------------------------------------------------------------------
+/// Converts float to IEEE half precision (fp16),
+/// rounding to nearest, ties to even. Values that round beyond the
+/// largest half, 65504, overflow to infinity; small values round to
+/// subnormal halves or zero.
+/// @return fp16 bit pattern.
+inline uint16_t float_to_half( float x )
+{
+    uint32_t u;
+    std::memcpy( &u, &x, sizeof(u) );
+    uint16_t sign = uint16_t( (u >> 16) & 0x8000 );
+    uint32_t absu = u & 0x7fffffff;
+
+    if (absu > 0x7f800000)          // NaN
+        return sign | 0x7e00;
+    if (absu >= 0x477ff000)         // >= 65520 rounds to inf
+        return sign | 0x7c00;
+    if (absu < 0x38800000) {        // < 2^-14, subnormal half
+        // Scaling by 2^24 is exact; nearbyint rounds ties to even.
+        float absx;
+        std::memcpy( &absx, &absu, sizeof(absx) );
+        return sign | uint16_t( std::nearbyint( absx * 16777216.0f ) );
+    }
+    // Normal: rebias exponent from 127 to 15, round 23 to 10 bits.
+    // A carry out of the significand correctly bumps the exponent.
+    uint32_t h = ((absu >> 13) - (112 << 10));
+    uint32_t rest = absu & 0x1fff;
+    if (rest > 0x1000 || (rest == 0x1000 && (h & 1)))
+        ++h;
+    return sign | uint16_t( h );
+}
+
+//------------------------------------------------------------------------------
+/// Converts fp16 bit pattern to float; exact.
+inline float half_to_float( uint16_t h )
+{
+    uint32_t sign = uint32_t( h & 0x8000 ) << 16;
+    uint32_t exp  = (h >> 10) & 0x1f;
+    uint32_t mant = h & 0x3ff;
+    uint32_t u;
+    if (exp == 0) {
+        // zero or subnormal: mant * 2^-24
+        float x = std::ldexp( float( mant ), -24 );
+        return sign ? -x : x;
+    }
+    else if (exp == 31)
+        u = sign | 0x7f800000 | (mant << 13);   // inf or NaN
+    else
+        u = sign | ((exp + 112) << 23) | (mant << 13);
+    float x;
+    std::memcpy( &x, &u, sizeof(x) );
+    return x;
+}
+
+//------------------------------------------------------------------------------
+/// Hints to the CPU that the caller is in a spin-wait loop.
+inline void spin_pause()
+{
+    #if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+    #elif defined(__aarch64__)
+        asm volatile( "yield" );
+    #endif
+}
+
+//------------------------------------------------------------------------------
+/// Hints to the CPU to load [ptr, ptr + bytes) into cache, one 64-byte
+/// cache line at a time, to be written if for_write. A hint only: it never
+/// faults, so ptr may be stale.
+inline void cache_prefetch( void const* ptr, size_t bytes, bool for_write )
+{
+    #if defined(__GNUC__)
+        char const* p = (char const*) ptr;
+        for (size_t k = 0; k < bytes; k += 64) {
+            if (for_write)
+                __builtin_prefetch( p + k, 1, 3 );
+            else
+                __builtin_prefetch( p + k, 0, 3 );
+        }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+/// Exponential backoff for spin-wait loops: each pause() spins for twice as
+/// many spin_pause() calls as the previous one, up to max_spins, after which
+/// it yields the CPU. This keeps short waits fast, while long waits don't
+/// starve other threads when there are more threads than cores.
+class SpinBackoff {
+public:
+    void pause()
+    {
+        if (spins_ <= max_spins) {
+            for (int i = 0; i < spins_; ++i)
+                spin_pause();
+            spins_ *= 2;
+        }
+        else {
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    static constexpr int max_spins = 64;
+    int spins_ = 1;
+};
+
+//------------------------------------------------------------------------------
+/// Sense-reversing barrier for a fixed team of threads, e.g., the threads of
+/// a panel factorization. The last thread to arrive resets the count and
+/// flips the sense, by incrementing passed_, which releases the others.
+/// Waiting threads back off (see SpinBackoff).
 class ThreadBarrier {
 public:
     ThreadBarrier()
@@ -155,10 +292,37 @@ public:
         int passed_old = passed_;
 
         __sync_fetch_and_add(&count_, 1);
-        if (__sync_bool_compare_and_swap(&count_, size, 0))
+        if (__sync_bool_compare_and_swap(&count_, size, 0)) {
             ++passed_;
-        else
-            while (passed_ == passed_old) {}
+        }
+        else {
+            SpinBackoff backoff;
+            while (passed_ == passed_old) { backoff.pause(); }
+        }
+    }
+
+    /// Waits until all size threads arrive; then thread 0 runs serial()
+    /// before any thread is released. This replaces a barrier, a section
+    /// by thread 0, and a second barrier: the arrival gathers the threads'
+    /// results for serial(), and the release publishes its results.
+    template <typename Function>
+    void wait(int size, int thread_rank, Function&& serial)
+    {
+        int passed_old = passed_;
+
+        __sync_fetch_and_add(&count_, 1);
+        SpinBackoff backoff;
+        if (thread_rank == 0) {
+            while (__atomic_load_n(&count_, __ATOMIC_ACQUIRE) != size) {
+                backoff.pause();
+            }
+            serial();
+            __atomic_store_n(&count_, 0, __ATOMIC_RELAXED);
+            ++passed_;
+        }
+        else {
+            while (passed_ == passed_old) { backoff.pause(); }
+        }
     }
 
 private:
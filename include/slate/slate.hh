@@ -14,6 +14,7 @@
 #include "slate/BandMatrix.hh"
 #include "slate/TriangularBandMatrix.hh"
 #include "slate/HermitianBandMatrix.hh"
+#include "slate/CompactBandMatrix.hh"
 
 #include "slate/func.hh"
 #include "slate/types.hh"
@@ -173,6 +174,12 @@ template<typename scalar_t>
 void gerbt(Matrix<scalar_t>& U,
            Matrix<scalar_t>& A);
 
+//-----------------------------------------
+// herbt()
+template<typename scalar_t>
+void herbt(Matrix<scalar_t>& U,
+           HermitianMatrix<scalar_t>& A);
+
 //-----------------------------------------
 // gbmm()
 template <typename scalar_t>
@@ -209,6 +216,15 @@ void gemmC(
     scalar_t beta,  Matrix<scalar_t>& C,
     Options const& opts = Options());
 
+//-----------------------------------------
+// gemm_strassen()
+template <typename scalar_t>
+void gemm_strassen(
+    scalar_t alpha, Matrix<scalar_t>& A,
+                    Matrix<scalar_t>& B,
+    scalar_t beta,  Matrix<scalar_t>& C,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // hbmm()
 template <typename scalar_t>
@@ -499,6 +515,20 @@ int64_t gbsv(
         Matrix<scalar_t>& B,
     Options const& opts = Options());
 
+template <typename scalar_t>
+int64_t gbsv(
+    CompactBandMatrix<scalar_t>& A, std::vector<int64_t>& pivots,
+               Matrix<scalar_t>& B,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// gbsv_spike()
+template <typename scalar_t>
+int64_t gbsv_spike(
+    CompactBandMatrix<scalar_t>& A,
+               Matrix<scalar_t>& B,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // gesv()
 template <typename scalar_t>
@@ -569,6 +599,11 @@ int64_t gbtrf(
     BandMatrix<scalar_t>& A, Pivots& pivots,
     Options const& opts = Options());
 
+template <typename scalar_t>
+int64_t gbtrf(
+    CompactBandMatrix<scalar_t>& A, std::vector<int64_t>& pivots,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // getrf()
 template <typename scalar_t>
@@ -598,6 +633,12 @@ void gbtrs(
         Matrix<scalar_t>& B,
     Options const& opts = Options());
 
+template <typename scalar_t>
+void gbtrs(
+    CompactBandMatrix<scalar_t>& A, std::vector<int64_t>& pivots,
+               Matrix<scalar_t>& B,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // getrs()
 template <typename scalar_t>
@@ -641,6 +682,20 @@ int64_t pbsv(
                  Matrix<scalar_t>& B,
     Options const& opts = Options());
 
+template <typename scalar_t>
+int64_t pbsv(
+    CompactHermitianBandMatrix<scalar_t>& A,
+                        Matrix<scalar_t>& B,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// pbsv_spike()
+template <typename scalar_t>
+int64_t pbsv_spike(
+    CompactHermitianBandMatrix<scalar_t>& A,
+                        Matrix<scalar_t>& B,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // posv()
 template <typename scalar_t>
@@ -709,6 +764,11 @@ int64_t pbtrf(
     HermitianBandMatrix<scalar_t>& A,
     Options const& opts = Options());
 
+template <typename scalar_t>
+int64_t pbtrf(
+    CompactHermitianBandMatrix<scalar_t>& A,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // potrf()
 template <typename scalar_t>
@@ -736,6 +796,12 @@ void pbtrs(
                  Matrix<scalar_t>& B,
     Options const& opts = Options());
 
+template <typename scalar_t>
+void pbtrs(
+    CompactHermitianBandMatrix<scalar_t>& A,
+                        Matrix<scalar_t>& B,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // potrs()
 template <typename scalar_t>
@@ -798,6 +864,16 @@ int64_t sysv(
     return hesv( AH, pivots, T, pivots2, H, B, opts );
 }
 
+//-----------------------------------------
+// hesv_rbt()
+template <typename scalar_t>
+int64_t hesv_rbt(
+    HermitianMatrix<scalar_t>& A,
+             Matrix<scalar_t>& B,
+             Matrix<scalar_t>& X,
+    int& iter,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // hetrf()
 template <typename scalar_t>
@@ -848,6 +924,21 @@ void sytrs(
     hetrs(AH, pivots, T, pivots2, B, opts);
 }
 
+//-----------------------------------------
+// hetrf_nopiv()
+template <typename scalar_t>
+int64_t hetrf_nopiv(
+    HermitianMatrix<scalar_t>& A,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// hetrs_nopiv()
+template <typename scalar_t>
+void hetrs_nopiv(
+    HermitianMatrix<scalar_t>& A,
+             Matrix<scalar_t>& B,
+    Options const& opts = Options());
+
 //------------------------------------------------------------------------------
 // QR
 
@@ -962,6 +1053,34 @@ void svd_vals(
     svd( A, Sigma, opts );
 }
 
+//-----------------------------------------
+// rsvd()
+template <typename scalar_t>
+void rsvd(
+    Matrix<scalar_t>& A,
+    int64_t k,
+    int64_t oversample,
+    int64_t power_iters,
+    std::vector< blas::real_type<scalar_t> >& Sigma,
+    Matrix<scalar_t>& U,
+    Matrix<scalar_t>& VT,
+    Options const& opts = Options());
+
+/// Without U and VT, compute only the k largest singular values.
+template <typename scalar_t>
+void rsvd(
+    Matrix<scalar_t>& A,
+    int64_t k,
+    int64_t oversample,
+    int64_t power_iters,
+    std::vector< blas::real_type<scalar_t> >& Sigma,
+    Options const& opts = Options())
+{
+    Matrix<scalar_t> U;
+    Matrix<scalar_t> VT;
+    rsvd( A, k, oversample, power_iters, Sigma, U, VT, opts );
+}
+
 template <typename scalar_t>
 [[deprecated( "Use svd instead. To be removed 2024-07." )]]
 void gesvd(
@@ -1026,6 +1145,15 @@ void bdsqr(
     Matrix<scalar_t>& VT,
     Options const& opts = Options());
 
+//-----------------------------------------
+// polar()
+template <typename scalar_t>
+int64_t polar(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& U,
+    Matrix<scalar_t>& H,
+    Options const& opts = Options());
+
 //------------------------------------------------------------------------------
 // Symmetric/Hermitian eigenvalues
 
@@ -1047,6 +1175,15 @@ void heev(
     heev( A, Lambda, Z, opts );
 }
 
+//-----------------------------------------
+// heev_qdwh()
+template <typename scalar_t>
+void heev_qdwh(
+    HermitianMatrix<scalar_t>& A,
+    std::vector< blas::real_type<scalar_t> >& Lambda,
+    Matrix<scalar_t>& Z,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // forward real-symmetric matrices to heev;
 // disabled for complex
@@ -1197,6 +1334,30 @@ void unmtr_hb2st(
     Matrix<scalar_t>& C,
     Options const& opts = Options());
 
+//------------------------------------------------------------------------------
+// Non-symmetric eigenvalues
+// First stage, reduction to band Hessenberg form, and its back-transform.
+// The second stage, a distributed multishift QR on the band, isn't
+// implemented yet, so there is no geev driver.
+
+//-----------------------------------------
+// ge2hb()
+template <typename scalar_t>
+void ge2hb(
+    Matrix<scalar_t>& A,
+    TriangularFactors<scalar_t>& T,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// unmhr_ge2hb()
+template <typename scalar_t>
+void unmhr_ge2hb(
+    Side side, Op op,
+    Matrix<scalar_t>& A,
+    TriangularFactors<scalar_t>& T,
+    Matrix<scalar_t>& C,
+    Options const& opts = Options());
+
 //------------------------------------------------------------------------------
 // Tridiagonal Symmetric eigenvalue solvers
 
@@ -46,6 +46,9 @@ public:
     OptionValue(Target t) : i_(int(t))
     {}
 
+    OptionValue( TilePrecision p ) : i_( int( p ) )
+    {}
+
     //----- Methods, alphabetical
     OptionValue( MethodCholQR m ) : i_( int( m ) )
     {}
@@ -71,6 +74,9 @@ public:
     OptionValue( MethodSVD m ) : i_( int( m ) )
     {}
 
+    OptionValue( MethodHesv m ) : i_( int( m ) )
+    {}
+
     union {
         int64_t i_;
         double d_;
@@ -251,6 +257,8 @@ template<> struct OptValueType<Option::Depth>              { using T = int64_t;
 template<> struct OptValueType<Option::MaxIterations>      { using T = int64_t; };
 template<> struct OptValueType<Option::UseFallbackSolver>  { using T = bool; };
 template<> struct OptValueType<Option::PivotThreshold>     { using T = double; };
+template<> struct OptValueType<Option::NormEstColumns>     { using T = int64_t; };
+template<> struct OptValueType<Option::TilePrecision>      { using T = TilePrecision; };
 template<> struct OptValueType<Option::PrintVerbose>       { using T = int; };
 template<> struct OptValueType<Option::PrintEdgeItems>     { using T = int; };
 template<> struct OptValueType<Option::PrintWidth>         { using T = int; };
@@ -263,6 +271,7 @@ template<> struct OptValueType<Option::MethodHemm>         { using T = MethodHem
 template<> struct OptValueType<Option::MethodLU>           { using T = MethodLU; };
 template<> struct OptValueType<Option::MethodTrsm>         { using T = MethodTrsm; };
 template<> struct OptValueType<Option::MethodSVD>          { using T = MethodSVD; };
+template<> struct OptValueType<Option::MethodHesv>         { using T = MethodHesv; };
 
 template <slate::Option option>
 auto get_option( Options opts, typename OptValueType<option>::T defval )
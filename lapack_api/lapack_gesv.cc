@@ -78,14 +78,19 @@ void slate_gesv(const int n, const int nrhs, scalar_t* a, const int lda, int* ip
     auto A = slate::Matrix<scalar_t>::fromLAPACK(Am, An, a, lda, nb, p, q, MPI_COMM_WORLD);
     auto B = slate::Matrix<scalar_t>::fromLAPACK(Bm, Bn, b, ldb, nb, p, q, MPI_COMM_WORLD);
 
+    // for large matrices, optionally factor a copy in contiguous tiles
+    auto Ap = slate_lapack_pack(A, Am, target);
+
     // computes the solution to the system of linear equations with a square coefficient matrix A and multiple right-hand sides.
-    slate::gesv(A, pivots, B, {
+    slate::gesv(Ap, pivots, B, {
         {slate::Option::Lookahead, lookahead},
         {slate::Option::Target, target},
         {slate::Option::MaxPanelThreads, panel_threads},
         {slate::Option::InnerBlocking, ib}
     });
 
+    slate_lapack_unpack(Ap, A);
+
     // extract pivots from SLATE's Pivots structure into LAPACK ipiv array
     {
         int64_t p_count = 0;
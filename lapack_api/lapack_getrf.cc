@@ -88,14 +88,19 @@ void slate_getrf(const int m, const int n, scalar_t* a, const int lda, int* ipiv
     // create SLATE matrices from the Lapack layouts
     auto A = slate::Matrix<scalar_t>::fromLAPACK(Am, An, a, lda, nb, p, q, MPI_COMM_WORLD);
 
+    // for large matrices, optionally factor a copy in contiguous tiles
+    auto Ap = slate_lapack_pack(A, std::min(Am, An), target);
+
     // factorize using slate
-    slate::getrf(A, pivots, {
+    slate::getrf(Ap, pivots, {
         {slate::Option::Lookahead, lookahead},
         {slate::Option::Target, target},
         {slate::Option::MaxPanelThreads, panel_threads},
         {slate::Option::InnerBlocking, ib}
     });
 
+    slate_lapack_unpack(Ap, A);
+
     // extract pivots from SLATE's Pivots structure into LAPACK ipiv array
     {
         int64_t p_count = 0;
@@ -101,6 +101,54 @@ inline int64_t slate_lapack_set_nb(slate::Target target)
     return 256;
 }
 
+inline int64_t slate_lapack_set_pack()
+{
+    // set the minimum size to pack matrices into contiguous tiles
+    int64_t pack = 0; // default, no packing
+    char* packstr = std::getenv("SLATE_LAPACK_PACK");
+    if (packstr)
+        pack = std::max((int64_t)strtol(packstr, NULL, 0), int64_t(0));
+    return pack;
+}
+
+//------------------------------------------------------------------------------
+/// Tiles from fromLAPACK alias the caller's array, with stride lda, so tile
+/// kernels touch lda-strided columns, and converting tiles to row-major
+/// needs extended buffers. For factorizations with inner dimension k at
+/// least SLATE_LAPACK_PACK, copies A, in parallel tasks, into a new matrix
+/// with the same tiles, each stored contiguously in one host slab
+/// (TileAlloc::Slab). The copy is O(mn) against O(mnk) flops.
+/// Devices copy tiles to contiguous GPU tiles anyway, so are not packed.
+/// @see slate_lapack_unpack
+///
+/// @return the packed copy, or A itself if not packed.
+///
+template <typename scalar_t>
+slate::Matrix<scalar_t> slate_lapack_pack(
+    slate::Matrix<scalar_t>& A, int64_t k, slate::Target target)
+{
+    static int64_t pack = slate_lapack_set_pack();
+    if (pack <= 0 || k < pack || target == slate::Target::Devices)
+        return A;
+
+    auto Ap = A.emptyLike();
+    Ap.insertLocalTiles(slate::TileAlloc::Slab);
+    slate::copy(A, Ap, {{slate::Option::Target, slate::Target::HostTask}});
+    return Ap;
+}
+
+//------------------------------------------------------------------------------
+/// Copies the packed matrix Ap from slate_lapack_pack back into A.
+/// Does nothing if A was not packed.
+///
+template <typename scalar_t>
+void slate_lapack_unpack(
+    slate::Matrix<scalar_t>& Ap, slate::Matrix<scalar_t>& A)
+{
+    if (Ap.hostSlab() != nullptr && Ap.hostSlab() != A.hostSlab())
+        slate::copy(Ap, A, {{slate::Option::Target, slate::Target::HostTask}});
+}
+
 } // namespace lapack_api
 } // namespace slate
 
@@ -99,7 +99,8 @@ void slate_pgecon(const char* normstr, int n, scalar_t* a, int ia, int ja, int*
     int64_t lookahead = LookaheadConfig::value();
     int64_t panel_threads = PanelThreadsConfig::value();
     int64_t ib = IBConfig::value();
-    slate::GridOrder grid_order = slate_scalapack_blacs_grid_order();
+    slate::GridOrder grid_order = slate_scalapack_blacs_grid_order(desc_CTXT(desca));
+    MPI_Comm mpi_comm = slate_scalapack_blacs_comm(desc_CTXT(desca));
 
     // todo: extract the real info from getrf
     *info = 0;
@@ -125,7 +126,7 @@ void slate_pgecon(const char* normstr, int n, scalar_t* a, int ia, int ja, int*
     int64_t An = n;
 
     // create SLATE matrices from the ScaLAPACK layouts
-    auto A = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(desca), desc_N(desca), a, desc_LLD(desca), desc_MB(desca), desc_NB(desca), grid_order, nprow, npcol, MPI_COMM_WORLD);
+    auto A = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(desca), desc_N(desca), a, desc_LLD(desca), desc_MB(desca), desc_NB(desca), grid_order, nprow, npcol, mpi_comm);
     A = slate_scalapack_submatrix(Am, An, A, ia, ja, desca);
 
     *rcond = slate::gecondest(norm, A, anorm, {
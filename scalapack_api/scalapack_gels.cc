@@ -109,7 +109,8 @@ void slate_pgels(const char* transstr, int m, int n, int nrhs, scalar_t* a, int
     int64_t panel_threads = PanelThreadsConfig::value();
     int64_t inner_blocking = IBConfig::value();
     int64_t lookahead = LookaheadConfig::value();
-    slate::GridOrder grid_order = slate_scalapack_blacs_grid_order();
+    slate::GridOrder grid_order = slate_scalapack_blacs_grid_order(desc_CTXT(desca));
+    MPI_Comm mpi_comm = slate_scalapack_blacs_comm(desc_CTXT(desca));
 
     // A is m-by-n, BX is max(m, n)-by-nrhs.
     // If op == NoTrans, op(A) is m-by-n, B is m-by-nrhs
@@ -122,11 +123,11 @@ void slate_pgels(const char* transstr, int m, int n, int nrhs, scalar_t* a, int
     // create SLATE matrices from the ScaLAPACK layouts
     int nprow, npcol, myprow, mypcol;
     Cblacs_gridinfo(desc_CTXT(desca), &nprow, &npcol, &myprow, &mypcol);
-    auto A = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(desca), desc_N(desca), a, desc_LLD(desca), desc_MB(desca), desc_NB(desca), grid_order, nprow, npcol, MPI_COMM_WORLD);
+    auto A = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(desca), desc_N(desca), a, desc_LLD(desca), desc_MB(desca), desc_NB(desca), grid_order, nprow, npcol, mpi_comm);
     A = slate_scalapack_submatrix(Am, An, A, ia, ja, desca);
 
     Cblacs_gridinfo(desc_CTXT(descb), &nprow, &npcol, &myprow, &mypcol);
-    auto B = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(descb), desc_N(descb), b, desc_LLD(descb), desc_MB(descb), desc_NB(descb), grid_order, nprow, npcol, MPI_COMM_WORLD);
+    auto B = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(descb), desc_N(descb), b, desc_LLD(descb), desc_MB(descb), desc_NB(descb), grid_order, nprow, npcol, mpi_comm);
     B = slate_scalapack_submatrix(Bm, Bn, B, ib, jb, descb);
 
     // Apply transpose
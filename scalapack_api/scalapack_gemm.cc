@@ -124,7 +124,8 @@ void slate_pgemm(const char* transastr, const char* transbstr, int m, int n, int
     slate::Target target = TargetConfig::value();
     int verbose = VerboseConfig::value();
     int64_t lookahead = LookaheadConfig::value();
-    slate::GridOrder grid_order = slate_scalapack_blacs_grid_order();
+    slate::GridOrder grid_order = slate_scalapack_blacs_grid_order(desc_CTXT(desca));
+    MPI_Comm mpi_comm = slate_scalapack_blacs_comm(desc_CTXT(desca));
 
     // sizes of A and B
     int64_t Am = (transA == blas::Op::NoTrans ? m : k);
@@ -136,17 +137,35 @@ void slate_pgemm(const char* transastr, const char* transbstr, int m, int n, int
 
     // create SLATE matrices from the ScaLAPACK layouts
     int nprow, npcol, myprow, mypcol;
-    Cblacs_gridinfo(desc_CTXT(desca), &nprow, &npcol, &myprow, &mypcol);
-    auto A = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(desca), desc_N(desca), a, desc_LLD(desca), desc_MB(desca), desc_NB(desca), grid_order, nprow, npcol, MPI_COMM_WORLD);
-    A = slate_scalapack_submatrix(Am, An, A, ia, ja, desca);
-
-    Cblacs_gridinfo(desc_CTXT(descb), &nprow, &npcol, &myprow, &mypcol);
-    auto B = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(descb), desc_N(descb), b, desc_LLD(descb), desc_MB(descb), desc_NB(descb), grid_order, nprow, npcol, MPI_COMM_WORLD);
-    B = slate_scalapack_submatrix(Bm, Bn, B, ib, jb, descb);
-
     Cblacs_gridinfo(desc_CTXT(descc), &nprow, &npcol, &myprow, &mypcol);
-    auto C = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(descc), desc_N(descc), c, desc_LLD(descc), desc_MB(descc), desc_NB(descc), grid_order, nprow, npcol, MPI_COMM_WORLD);
-    C = slate_scalapack_submatrix(Cm, Cn, C, ic, jc, descc);
+
+    // Small ScaLAPACK blocks are optionally re-blocked to nb_reblock,
+    // if all three matrices can be. The size conditions hold for any smaller
+    // block size, so the smallest of the three suits all.
+    int64_t nb_reblock = std::min({
+        slate_scalapack_reblock_nb(Am, An, k, desca, nprow, npcol),
+        slate_scalapack_reblock_nb(Bm, Bn, k, descb, nprow, npcol),
+        slate_scalapack_reblock_nb(Cm, Cn, k, descc, nprow, npcol) });
+    std::vector<scalar_t> A_reblock, B_reblock, C_reblock;
+    slate::Matrix<scalar_t> A, B, C;
+    if (nb_reblock > 0) {
+        A = slate_scalapack_reblock(Am, An, a, ia, ja, desca, nb_reblock, A_reblock, grid_order, nprow, npcol, myprow, mypcol, mpi_comm);
+        B = slate_scalapack_reblock(Bm, Bn, b, ib, jb, descb, nb_reblock, B_reblock, grid_order, nprow, npcol, myprow, mypcol, mpi_comm);
+        C = slate_scalapack_reblock(Cm, Cn, c, ic, jc, descc, nb_reblock, C_reblock, grid_order, nprow, npcol, myprow, mypcol, mpi_comm, beta != scalar_t(0));
+    }
+    else {
+        Cblacs_gridinfo(desc_CTXT(desca), &nprow, &npcol, &myprow, &mypcol);
+        A = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(desca), desc_N(desca), a, desc_LLD(desca), desc_MB(desca), desc_NB(desca), grid_order, nprow, npcol, mpi_comm);
+        A = slate_scalapack_submatrix(Am, An, A, ia, ja, desca);
+
+        Cblacs_gridinfo(desc_CTXT(descb), &nprow, &npcol, &myprow, &mypcol);
+        B = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(descb), desc_N(descb), b, desc_LLD(descb), desc_MB(descb), desc_NB(descb), grid_order, nprow, npcol, mpi_comm);
+        B = slate_scalapack_submatrix(Bm, Bn, B, ib, jb, descb);
+
+        Cblacs_gridinfo(desc_CTXT(descc), &nprow, &npcol, &myprow, &mypcol);
+        C = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(descc), desc_N(descc), c, desc_LLD(descc), desc_MB(descc), desc_NB(descc), grid_order, nprow, npcol, mpi_comm);
+        C = slate_scalapack_submatrix(Cm, Cn, C, ic, jc, descc);
+    }
 
     if (transA == blas::Op::Trans)
         A = transpose(A);
@@ -165,6 +184,9 @@ void slate_pgemm(const char* transastr, const char* transbstr, int m, int n, int
         {slate::Option::Lookahead, lookahead},
         {slate::Option::Target, target}
     });
+
+    if (nb_reblock > 0)
+        slate_scalapack_unreblock(Cm, Cn, c, ic, jc, descc, nb_reblock, C_reblock, grid_order, nprow, npcol, myprow, mypcol, mpi_comm);
 }
 
 } // namespace scalapack_api
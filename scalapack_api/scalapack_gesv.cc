@@ -96,7 +96,8 @@ void slate_pgesv(int n, int nrhs, scalar_t* a, int ia, int ja, int* desca, int*
     int64_t lookahead = LookaheadConfig::value();
     int64_t panel_threads = PanelThreadsConfig::value();
     int64_t inner_blocking = IBConfig::value();
-    slate::GridOrder grid_order = slate_scalapack_blacs_grid_order();
+    slate::GridOrder grid_order = slate_scalapack_blacs_grid_order(desc_CTXT(desca));
+    MPI_Comm mpi_comm = slate_scalapack_blacs_comm(desc_CTXT(desca));
 
     // Matrix sizes
     int64_t Am = n;
@@ -108,23 +109,28 @@ void slate_pgesv(int n, int nrhs, scalar_t* a, int ia, int ja, int* desca, int*
     // create SLATE matrices from the ScaLAPACK layouts
     int nprow, npcol, myprow, mypcol;
     Cblacs_gridinfo(desc_CTXT(desca), &nprow, &npcol, &myprow, &mypcol);
-    auto A = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(desca), desc_N(desca), a, desc_LLD(desca), desc_MB(desca), desc_NB(desca), grid_order, nprow, npcol, MPI_COMM_WORLD);
+    auto A = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(desca), desc_N(desca), a, desc_LLD(desca), desc_MB(desca), desc_NB(desca), grid_order, nprow, npcol, mpi_comm);
     A = slate_scalapack_submatrix(Am, An, A, ia, ja, desca);
 
     Cblacs_gridinfo(desc_CTXT(descb), &nprow, &npcol, &myprow, &mypcol);
-    auto B = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(descb), desc_N(descb), b, desc_LLD(descb), desc_MB(descb), desc_NB(descb), grid_order, nprow, npcol, MPI_COMM_WORLD);
+    auto B = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(descb), desc_N(descb), b, desc_LLD(descb), desc_MB(descb), desc_NB(descb), grid_order, nprow, npcol, mpi_comm);
     B = slate_scalapack_submatrix(Bm, Bn, B, ib, jb, descb);
 
     if (verbose && myprow == 0 && mypcol == 0)
         logprintf("%s\n", "gesv");
 
-    slate::gesv(A, pivots, B, {
+    // For large matrices, optionally factor a copy in contiguous tiles.
+    auto Ap = slate_scalapack_pack(A, Am, target);
+
+    slate::gesv(Ap, pivots, B, {
         {slate::Option::Lookahead, lookahead},
         {slate::Option::Target, target},
         {slate::Option::MaxPanelThreads, panel_threads},
         {slate::Option::InnerBlocking, inner_blocking}
     });
 
+    slate_scalapack_unpack(Ap, A);
+
     // Extract pivots from SLATE's global Pivots structure into ScaLAPACK local ipiv array
     {
         int isrcproc0 = 0;
@@ -107,7 +107,8 @@ void slate_pgesvd(const char* jobustr, const char* jobvtstr, int m, int n, scala
     int64_t lookahead = LookaheadConfig::value();
     int64_t panel_threads = PanelThreadsConfig::value();
     int64_t ib = IBConfig::value();
-    slate::GridOrder grid_order = slate_scalapack_blacs_grid_order();
+    slate::GridOrder grid_order = slate_scalapack_blacs_grid_order(desc_CTXT(desca));
+    MPI_Comm mpi_comm = slate_scalapack_blacs_comm(desc_CTXT(desca));
 
     // todo: extract the real info from gesvd
     *info = 0;
@@ -134,20 +135,20 @@ void slate_pgesvd(const char* jobustr, const char* jobvtstr, int m, int n, scala
     int64_t VTn = n;
 
     // create SLATE matrices from the ScaLAPACK layouts
-    auto A = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(desca), desc_N(desca), a, desc_LLD(desca), desc_MB(desca), desc_NB(desca), grid_order, nprow, npcol, MPI_COMM_WORLD);
+    auto A = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(desca), desc_N(desca), a, desc_LLD(desca), desc_MB(desca), desc_NB(desca), grid_order, nprow, npcol, mpi_comm);
     A = slate_scalapack_submatrix(Am, An, A, ia, ja, desca);
 
     slate::Matrix<scalar_t> U;
     if (jobu == lapack::Job::Vec) {
         Cblacs_gridinfo(desc_CTXT(descu), &nprow, &npcol, &myprow, &mypcol);
-        U = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(descu), desc_N(descu), u, desc_LLD(descu), desc_MB(descu), desc_NB(descu), grid_order, nprow, npcol, MPI_COMM_WORLD);
+        U = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(descu), desc_N(descu), u, desc_LLD(descu), desc_MB(descu), desc_NB(descu), grid_order, nprow, npcol, mpi_comm);
         U = slate_scalapack_submatrix(Um, Un, U, iu, ju, descu);
     }
 
     slate::Matrix<scalar_t> VT;
     if (jobvt == lapack::Job::Vec) {
         Cblacs_gridinfo(desc_CTXT(descvt), &nprow, &npcol, &myprow, &mypcol);
-        VT = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(descvt), desc_N(descvt), vt, desc_LLD(descvt), desc_MB(descvt), desc_NB(descvt), grid_order, nprow, npcol, MPI_COMM_WORLD);
+        VT = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(descvt), desc_N(descvt), vt, desc_LLD(descvt), desc_MB(descvt), desc_NB(descvt), grid_order, nprow, npcol, mpi_comm);
         VT = slate_scalapack_submatrix(VTm, VTn, VT, ivt, jvt, descvt);
     }
 
@@ -96,7 +96,8 @@ void slate_pgetrf(int m, int n, scalar_t* a, int ia, int ja, int* desca, int* ip
     int64_t lookahead = LookaheadConfig::value();
     int64_t panel_threads = PanelThreadsConfig::value();
     int64_t ib = IBConfig::value();
-    slate::GridOrder grid_order = slate_scalapack_blacs_grid_order();
+    slate::GridOrder grid_order = slate_scalapack_blacs_grid_order(desc_CTXT(desca));
+    MPI_Comm mpi_comm = slate_scalapack_blacs_comm(desc_CTXT(desca));
 
     // Matrix sizes
     int64_t Am = m;
@@ -106,43 +107,40 @@ void slate_pgetrf(int m, int n, scalar_t* a, int ia, int ja, int* desca, int* ip
     // create SLATE matrices from the ScaLAPACK layouts
     int nprow, npcol, myprow, mypcol;
     Cblacs_gridinfo(desc_CTXT(desca), &nprow, &npcol, &myprow, &mypcol);
-    auto A = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(desca), desc_N(desca), a, desc_LLD(desca), desc_MB(desca), desc_NB(desca), grid_order, nprow, npcol, MPI_COMM_WORLD);
-    A = slate_scalapack_submatrix(Am, An, A, ia, ja, desca);
+    // Small ScaLAPACK blocks are optionally re-blocked to nb_reblock.
+    int64_t nb_reblock = slate_scalapack_reblock_nb(Am, An, std::min(Am, An), desca, nprow, npcol);
+    std::vector<scalar_t> A_reblock;
+    slate::Matrix<scalar_t> A;
+    if (nb_reblock > 0) {
+        A = slate_scalapack_reblock(Am, An, a, ia, ja, desca, nb_reblock, A_reblock, grid_order, nprow, npcol, myprow, mypcol, mpi_comm);
+    }
+    else {
+        A = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(desca), desc_N(desca), a, desc_LLD(desca), desc_MB(desca), desc_NB(desca), grid_order, nprow, npcol, mpi_comm);
+        A = slate_scalapack_submatrix(Am, An, A, ia, ja, desca);
+    }
 
     if (verbose && myprow == 0 && mypcol == 0)
         logprintf("%s\n", "getrf");
 
-    slate::getrf(A, pivots, {
+    // For large matrices, optionally factor a copy in contiguous tiles.
+    auto Ap = slate_scalapack_pack(A, std::min(Am, An), target);
+
+    slate::getrf(Ap, pivots, {
         {slate::Option::Lookahead, lookahead},
         {slate::Option::Target, target},
         {slate::Option::MaxPanelThreads, panel_threads},
         {slate::Option::InnerBlocking, ib}
     });
 
+    slate_scalapack_unpack(Ap, A);
+
+    if (nb_reblock > 0)
+        slate_scalapack_unreblock(Am, An, a, ia, ja, desca, nb_reblock, A_reblock, grid_order, nprow, npcol, myprow, mypcol, mpi_comm);
+
     // Extract pivots from SLATE's global Pivots structure into ScaLAPACK local ipiv array
-    {
-        int isrcproc0 = 0;
-        int nb = desc_MB(desca); // ScaLAPACK style fixed nb
-        int64_t l_numrows = scalapack_numroc(An, nb, myprow, isrcproc0, nprow);
-        // l_ipiv_rindx local ipiv row index (Scalapack 1-index)
-        // for each local ipiv entry, find corresponding local-pivot and swap-pivot
-        for (int l_ipiv_rindx=1; l_ipiv_rindx <= l_numrows; ++l_ipiv_rindx) {
-            // for ipiv index, convert to global indexing
-            int64_t g_ipiv_rindx = scalapack_indxl2g(&l_ipiv_rindx, &nb, &myprow, &isrcproc0, &nprow);
-            // assuming uniform nb from scalapack (note 1-indexing)
-            // figure out pivots(tile-index, offset)
-            int64_t g_ipiv_tile_indx = (g_ipiv_rindx - 1) / nb;
-            int64_t g_ipiv_tile_offset = (g_ipiv_rindx -1 ) % nb;
-            // get the reference to pivot corresponding to current ipiv
-            Pivot pivot = pivots[g_ipiv_tile_indx][g_ipiv_tile_offset];
-            // get swap information from pivot
-            int64_t tileIndexSwap = pivot.tileIndex();
-            int64_t elementOffsetSwap = pivot.elementOffset();
-            // scalapack 1-index
-            // pivots reference local submatrix; so shift by g_ipiv_tile_indx
-            ipiv[l_ipiv_rindx-1] = ((tileIndexSwap+g_ipiv_tile_indx) * nb) + (elementOffsetSwap + 1);
-        }
-    }
+    // pivots are relative to SLATE's tiles, which are re-blocked or nb
+    int64_t pivot_nb = (nb_reblock > 0 ? nb_reblock : desc_MB(desca));
+    slate_scalapack_pivots_to_ipiv(An, pivots, pivot_nb, desca, myprow, nprow, ipiv);
 
     // todo: extract the real info from getrf
     *info = 0;
@@ -11,11 +11,15 @@
 
 #include "slate/slate.hh"
 
-extern "C" void Cblacs_pinfo(int* mypnum, int* nprocs);
-extern "C" void Cblacs_pcoord(int icontxt, int pnum, int* prow, int* pcol);
+extern "C" void Cblacs_gridinfo(int context, int* np_row, int* np_col, int* my_row, int* my_col);
 extern "C" void Cblacs_get(int icontxt, int what, int* val);
+extern "C" void Cigsum2d(int icontxt, char* scope, char* top, int m, int n, int* A, int lda, int rdest, int cdest);
 
+#include <algorithm>
 #include <complex>
+#include <map>
+#include <mutex>
+#include <vector>
 
 namespace slate {
 namespace scalapack_api {
@@ -57,24 +61,64 @@ inline int desc_LLD(int* desca)
     return (desca[0] == BLOCK_CYCLIC_2D) ? desca[LLD_] : desca[LLD_INB];
 }
 
-inline slate::GridOrder slate_scalapack_blacs_grid_order()
+//------------------------------------------------------------------------------
+/// @return MPI communicator of the BLACS grid context, which can be a
+/// sub-grid. SLATE runs on that communicator, so independent sub-grids
+/// proceed concurrently rather than in collectives over MPI_COMM_WORLD.
+///
+/// The communicator is built from the grid's process coordinates: the
+/// grid members exchange their MPI_COMM_WORLD ranks with a BLACS sum over
+/// the grid, then create a communicator with MPI_Comm_create_group, which
+/// is collective only over the grid, so other sub-grids are not involved.
+/// Its ranks are in column-major grid order, rank = prow + pcol*nprow,
+/// matching slate_scalapack_blacs_grid_order.
+/// Communicators are cached by the list of members, not the context id,
+/// since context ids are reused after blacs_gridexit. They are never freed.
+///
+inline MPI_Comm slate_scalapack_blacs_comm(int context)
 {
-    // if nprocs == 1, the grid layout is irrelevant, all-OK
-    // if nprocs > 1 check the grid location of process-number-1 pnum(1).
-    // if pnum(1) is at grid-coord(0, 1) then grid is col-major
-    // else if pnum(1) is not at grid-coord(0, 1) then grid is row-major
-    int mypnum, nprocs, prow, pcol, icontxt=-1, imone=-1, izero=0, pnum_1=1;
-    Cblacs_pinfo( &mypnum, &nprocs );
-    if (nprocs == 1) // only one process, so col-major grid-layout
-        return slate::GridOrder::Col;
-    Cblacs_get( imone, izero, &icontxt );
-    Cblacs_pcoord( icontxt, pnum_1, &prow, &pcol );
-    if (prow == 0 && pcol == 1) { // col-major grid-layout
-        return slate::GridOrder::Col;
-    }
-    else { // row-major grid-layout
-        return slate::GridOrder::Row;
+    int nprow, npcol, myprow, mypcol;
+    Cblacs_gridinfo( context, &nprow, &npcol, &myprow, &mypcol );
+
+    int world_rank;
+    MPI_Comm_rank( MPI_COMM_WORLD, &world_rank );
+    std::vector<int> ranks( nprow * npcol, 0 );
+    ranks[ myprow + mypcol*nprow ] = world_rank;
+    char scope[] = "All", top[] = " ";
+    Cigsum2d( context, scope, top, nprow * npcol, 1, ranks.data(),
+              nprow * npcol, -1, -1 );
+
+    static std::map< std::vector<int>, MPI_Comm > comms;
+    static std::mutex comms_mutex;
+    {
+        std::lock_guard<std::mutex> guard( comms_mutex );
+        auto iter = comms.find( ranks );
+        if (iter != comms.end())
+            return iter->second;
     }
+
+    // All grid members miss the cache together, since they have the same
+    // members list, so the collective creation below is matched.
+    MPI_Group world_group, grid_group;
+    MPI_Comm comm;
+    MPI_Comm_group( MPI_COMM_WORLD, &world_group );
+    MPI_Group_incl( world_group, nprow * npcol, ranks.data(), &grid_group );
+    MPI_Comm_create_group( MPI_COMM_WORLD, grid_group, 0, &comm );
+    MPI_Group_free( &grid_group );
+    MPI_Group_free( &world_group );
+
+    std::lock_guard<std::mutex> guard( comms_mutex );
+    comms.emplace( ranks, comm );
+    return comm;
+}
+
+//------------------------------------------------------------------------------
+/// @return order of the ranks of slate_scalapack_blacs_comm( context )
+/// in the BLACS grid, which is always column-major.
+///
+inline slate::GridOrder slate_scalapack_blacs_grid_order(int context)
+{
+    return slate::GridOrder::Col;
 }
 
 template< typename scalar_t >
@@ -384,6 +428,101 @@ private:
     int64_t lookahead_;
 };
 
+//==============================================================================
+/// Initialize re-blocking setting from environment variable.
+/// Uses thread-safe Scott Meyers Singleton.
+class ReblockConfig
+{
+public:
+    /// @return block size to re-block to, or 0 to use the caller's blocks.
+    static int64_t value()
+    {
+        return instance().nb_;
+    }
+
+    /// Set block size to re-block to; 0 disables re-blocking.
+    static void value( int64_t nb )
+    {
+        instance().nb_ = nb;
+    }
+
+private:
+    /// On first call, creates the singleton instance, which queries the
+    /// environment variable.
+    /// @return singleton instance.
+    static ReblockConfig& instance()
+    {
+        static ReblockConfig instance_;
+        return instance_;
+    }
+
+    /// Constructor queries the environment variable or sets to default value.
+    ReblockConfig()
+    {
+        nb_ = 0;
+        const char* str = std::getenv( "SLATE_SCALAPACK_NB" );
+        if (str) {
+            nb_ = blas::max( strtol( str, NULL, 0 ), 0 );
+        }
+    }
+
+    // Prevent copy construction and copy assignment.
+    ReblockConfig( const ReblockConfig& orig ) = delete;
+    ReblockConfig& operator= ( const ReblockConfig& orig ) = delete;
+
+    //----------------------------------------
+    // Data
+    int64_t nb_;
+};
+
+//==============================================================================
+/// Initialize tile packing setting from environment variable.
+/// Uses thread-safe Scott Meyers Singleton.
+class PackConfig
+{
+public:
+    /// @return minimum size to pack matrices into contiguous tiles,
+    /// or 0 to not pack.
+    static int64_t value()
+    {
+        return instance().pack_;
+    }
+
+    /// Set minimum size to pack matrices; 0 disables packing.
+    static void value( int64_t pack )
+    {
+        instance().pack_ = pack;
+    }
+
+private:
+    /// On first call, creates the singleton instance, which queries the
+    /// environment variable.
+    /// @return singleton instance.
+    static PackConfig& instance()
+    {
+        static PackConfig instance_;
+        return instance_;
+    }
+
+    /// Constructor queries the environment variable or sets to default value.
+    PackConfig()
+    {
+        pack_ = 0;
+        const char* str = std::getenv( "SLATE_SCALAPACK_PACK" );
+        if (str) {
+            pack_ = blas::max( strtol( str, NULL, 0 ), 0 );
+        }
+    }
+
+    // Prevent copy construction and copy assignment.
+    PackConfig( const PackConfig& orig ) = delete;
+    PackConfig& operator= ( const PackConfig& orig ) = delete;
+
+    //----------------------------------------
+    // Data
+    int64_t pack_;
+};
+
 // -----------------------------------------------------------------------------
 // helper funtion to check and do type conversion
 // TODO: this is duplicated at the testing module
@@ -411,6 +550,287 @@ inline int64_t scalapack_numroc(int64_t n, int64_t nb, int iproc, int isrcproc,
 #define scalapack_indxl2g BLAS_FORTRAN_NAME(indxl2g,INDXL2G)
 extern "C" int scalapack_indxl2g(int* indxloc, int* nb, int* iproc, int* isrcproc, int* nprocs);
 
+//------------------------------------------------------------------------------
+/// Decides whether an m-by-n operand of a routine with inner dimension k
+/// (k = min(m, n) for factorizations) should be re-blocked from its
+/// ScaLAPACK block size to a larger one, set by SLATE_SCALAPACK_NB.
+///
+/// Re-blocking costs two all-to-all exchanges of the operand, O(mn/p)
+/// words per process, while the routine does O(mnk/p) flops, so the copy
+/// is amortized once k spans several of the new blocks. The new block size
+/// is also halved until every process keeps at least 2 block rows and
+/// columns, to preserve load balance.
+///
+/// @return the new block size, or 0 to use the caller's layout.
+///
+inline int64_t slate_scalapack_reblock_nb(
+    int64_t m, int64_t n, int64_t k, int* desca, int nprow, int npcol)
+{
+    int64_t nb_new = ReblockConfig::value();
+    if (nb_new <= 0
+        || desca[DTYPE_] != BLOCK_CYCLIC_2D
+        || desca[RSRC_] != 0 || desca[CSRC_] != 0)
+        return 0;
+
+    int64_t mb = desc_MB(desca);
+    int64_t nb = desc_NB(desca);
+    for (; nb_new > blas::max( mb, nb ); nb_new /= 2) {
+        if (m >= 2*nb_new*nprow && n >= 2*nb_new*npcol && k >= 4*nb_new)
+            return nb_new;
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Copies the m-by-n matrix between two 2D block-cyclic layouts on the same
+/// process grid, with one MPI_Alltoallv over the grid's communicator.
+/// Layout A is the ScaLAPACK submatrix A(ia:ia+m-1, ja:ja+n-1) with blocks
+/// mb_a-by-nb_a; layout B starts at (0, 0) with square nb_b blocks. Both
+/// have source process (0, 0). Copies A to B if to_b, else B to A.
+///
+/// The block boundaries of both layouts cut the matrix into rectangles,
+/// each of which lies in one block of A and one block of B, so it is
+/// contiguous columns of local storage on both sides. Rectangles are
+/// packed and unpacked with lacpy, visited in the same global order on
+/// every process, so both sides agree on the order of each message.
+///
+template <typename scalar_t>
+void slate_scalapack_reblock_copy(
+    int64_t m, int64_t n,
+    scalar_t* a, int64_t lda, int64_t ia, int64_t ja,
+    int64_t mb_a, int64_t nb_a,
+    scalar_t* b, int64_t ldb, int64_t nb_b,
+    slate::GridOrder grid_order, int nprow, int npcol,
+    int myprow, int mypcol, MPI_Comm mpi_comm, bool to_b)
+{
+    int nprocs = nprow * npcol;
+    auto rank = [&]( int prow, int pcol ) {
+        return grid_order == slate::GridOrder::Col
+               ? prow + pcol*nprow
+               : prow*npcol + pcol;
+    };
+
+    // Process and local index of global index g, with blocks of size nb.
+    auto g2p = []( int64_t g, int64_t nb, int nprocs ) {
+        return int( (g / nb) % nprocs );
+    };
+    auto g2l = []( int64_t g, int64_t nb, int nprocs ) {
+        return (g / (nb*nprocs))*nb + g % nb;
+    };
+
+    // The source and destination layouts; the submatrix offset applies
+    // only to layout A.
+    struct Layout {
+        scalar_t* data;
+        int64_t ld, i0, j0, mb, nb;
+    };
+    Layout A_ = { a, lda, ia-1, ja-1, mb_a, nb_a };
+    Layout B_ = { b, ldb, 0, 0, nb_b, nb_b };
+    Layout& src = to_b ? A_ : B_;
+    Layout& dst = to_b ? B_ : A_;
+
+    // Start of each segment of [0, len) that lies in one block of both
+    // layouts, i.e., between consecutive block boundaries of either;
+    // ends with len.
+    auto segments = []( int64_t len, int64_t off_a, int64_t nb_a,
+                        int64_t nb_b ) {
+        std::vector<int64_t> starts;
+        int64_t g = 0;
+        while (g < len) {
+            starts.push_back( g );
+            int64_t next_a = ((off_a + g) / nb_a + 1)*nb_a - off_a;
+            int64_t next_b = (g / nb_b + 1)*nb_b;
+            g = std::min( { next_a, next_b, len } );
+        }
+        starts.push_back( len );
+        return starts;
+    };
+    std::vector<int64_t> row_seg = segments( m, A_.i0, A_.mb, nb_b );
+    std::vector<int64_t> col_seg = segments( n, A_.j0, A_.nb, nb_b );
+
+    // Visits the rectangles local in layout L, in global column-major
+    // order, with a pointer to the rectangle in L's local storage and the
+    // rank owning it in layout O.
+    auto for_local = [&]( Layout& L, Layout& O, auto&& f ) {
+        for (size_t jj = 0; jj + 1 < col_seg.size(); ++jj) {
+            int64_t j = col_seg[ jj ];
+            int64_t jb = col_seg[ jj+1 ] - j;
+            if (g2p( L.j0 + j, L.nb, npcol ) != mypcol)
+                continue;
+            int64_t lj = g2l( L.j0 + j, L.nb, npcol );
+            int ocol = g2p( O.j0 + j, O.nb, npcol );
+            for (size_t ii = 0; ii + 1 < row_seg.size(); ++ii) {
+                int64_t i = row_seg[ ii ];
+                int64_t ib = row_seg[ ii+1 ] - i;
+                if (g2p( L.i0 + i, L.mb, nprow ) != myprow)
+                    continue;
+                int64_t li = g2l( L.i0 + i, L.mb, nprow );
+                f( &L.data[ li + lj*L.ld ], ib, jb,
+                   rank( g2p( O.i0 + i, O.mb, nprow ), ocol ) );
+            }
+        }
+    };
+
+    std::vector<int> send_counts( nprocs, 0 ), recv_counts( nprocs, 0 );
+    for_local( src, dst, [&]( scalar_t*, int64_t ib, int64_t jb, int r ) {
+        send_counts[ r ] += ib*jb;
+    } );
+    for_local( dst, src, [&]( scalar_t*, int64_t ib, int64_t jb, int r ) {
+        recv_counts[ r ] += ib*jb;
+    } );
+
+    std::vector<int> send_displs( nprocs, 0 ), recv_displs( nprocs, 0 );
+    for (int r = 1; r < nprocs; ++r) {
+        send_displs[ r ] = send_displs[ r-1 ] + send_counts[ r-1 ];
+        recv_displs[ r ] = recv_displs[ r-1 ] + recv_counts[ r-1 ];
+    }
+
+    std::vector<scalar_t> send_buf( send_displs[ nprocs-1 ]
+                                    + send_counts[ nprocs-1 ] );
+    std::vector<scalar_t> recv_buf( recv_displs[ nprocs-1 ]
+                                    + recv_counts[ nprocs-1 ] );
+
+    std::vector<int> offset = send_displs;
+    for_local( src, dst, [&]( scalar_t* x, int64_t ib, int64_t jb, int r ) {
+        lapack::lacpy( lapack::MatrixType::General, ib, jb,
+                       x, src.ld, &send_buf[ offset[ r ] ], ib );
+        offset[ r ] += ib*jb;
+    } );
+
+    slate_mpi_call(
+        MPI_Alltoallv( send_buf.data(), send_counts.data(), send_displs.data(),
+                       mpi_type<scalar_t>::value,
+                       recv_buf.data(), recv_counts.data(), recv_displs.data(),
+                       mpi_type<scalar_t>::value, mpi_comm ) );
+
+    offset = recv_displs;
+    for_local( dst, src, [&]( scalar_t* x, int64_t ib, int64_t jb, int r ) {
+        lapack::lacpy( lapack::MatrixType::General, ib, jb,
+                       &recv_buf[ offset[ r ] ], ib, x, dst.ld );
+        offset[ r ] += ib*jb;
+    } );
+}
+
+//------------------------------------------------------------------------------
+/// Re-blocks the ScaLAPACK submatrix A(ia:ia+m-1, ja:ja+n-1) to square
+/// nb blocks, in storage allocated in workspace.
+/// If copy is false, only allocates, e.g., for an output with beta = 0.
+/// @see slate_scalapack_reblock_nb, slate_scalapack_unreblock
+///
+/// @return SLATE matrix over the re-blocked copy.
+///
+template <typename scalar_t>
+slate::Matrix<scalar_t> slate_scalapack_reblock(
+    int64_t m, int64_t n, scalar_t* a, int ia, int ja, int* desca,
+    int64_t nb, std::vector<scalar_t>& workspace,
+    slate::GridOrder grid_order, int nprow, int npcol,
+    int myprow, int mypcol, MPI_Comm mpi_comm, bool copy = true)
+{
+    int64_t mlocal = scalapack_numroc( m, nb, myprow, 0, nprow );
+    int64_t nlocal = scalapack_numroc( n, nb, mypcol, 0, npcol );
+    int64_t lld = blas::max( mlocal, 1 );
+    workspace.resize( lld * nlocal );
+    if (copy) {
+        slate_scalapack_reblock_copy(
+            m, n, a, desc_LLD(desca), ia, ja, desc_MB(desca), desc_NB(desca),
+            workspace.data(), lld, nb,
+            grid_order, nprow, npcol, myprow, mypcol, mpi_comm, true );
+    }
+    return slate::Matrix<scalar_t>::fromScaLAPACK(
+        m, n, workspace.data(), lld, nb, nb,
+        grid_order, nprow, npcol, mpi_comm );
+}
+
+//------------------------------------------------------------------------------
+/// Copies the re-blocked matrix from slate_scalapack_reblock back into
+/// the ScaLAPACK submatrix A(ia:ia+m-1, ja:ja+n-1).
+///
+template <typename scalar_t>
+void slate_scalapack_unreblock(
+    int64_t m, int64_t n, scalar_t* a, int ia, int ja, int* desca,
+    int64_t nb, std::vector<scalar_t>& workspace,
+    slate::GridOrder grid_order, int nprow, int npcol,
+    int myprow, int mypcol, MPI_Comm mpi_comm)
+{
+    int64_t mlocal = scalapack_numroc( m, nb, myprow, 0, nprow );
+    slate_scalapack_reblock_copy(
+        m, n, a, desc_LLD(desca), ia, ja, desc_MB(desca), desc_NB(desca),
+        workspace.data(), blas::max( mlocal, 1 ), nb,
+        grid_order, nprow, npcol, myprow, mypcol, mpi_comm, false );
+}
+
+//------------------------------------------------------------------------------
+/// Converts SLATE pivots of an LU factorization to the local ScaLAPACK ipiv
+/// array, for process row myprow: ipiv( i ) is the global (1-based) row
+/// swapped with global row i. The pivots are relative to SLATE tiles of
+/// pivot_nb rows, which may differ from the ScaLAPACK row block size
+/// desc_MB(desca) when the matrix was re-blocked.
+///
+inline void slate_scalapack_pivots_to_ipiv(
+    int64_t n, slate::Pivots const& pivots, int64_t pivot_nb, int* desca,
+    int myprow, int nprow, int* ipiv)
+{
+    int isrcproc0 = 0;
+    int nb = desc_MB(desca); // ScaLAPACK style fixed nb
+    int64_t l_numrows = scalapack_numroc(n, nb, myprow, isrcproc0, nprow);
+    // l_ipiv_rindx local ipiv row index (Scalapack 1-index)
+    // for each local ipiv entry, find corresponding local-pivot and swap-pivot
+    for (int l_ipiv_rindx=1; l_ipiv_rindx <= l_numrows; ++l_ipiv_rindx) {
+        // for ipiv index, convert to global indexing
+        int64_t g_ipiv_rindx = scalapack_indxl2g(&l_ipiv_rindx, &nb, &myprow, &isrcproc0, &nprow);
+        // figure out pivots(tile-index, offset) (note 1-indexing)
+        int64_t g_ipiv_tile_indx = (g_ipiv_rindx - 1) / pivot_nb;
+        int64_t g_ipiv_tile_offset = (g_ipiv_rindx -1 ) % pivot_nb;
+        // get the reference to pivot corresponding to current ipiv
+        slate::Pivot pivot = pivots[g_ipiv_tile_indx][g_ipiv_tile_offset];
+        // get swap information from pivot
+        int64_t tileIndexSwap = pivot.tileIndex();
+        int64_t elementOffsetSwap = pivot.elementOffset();
+        // scalapack 1-index
+        // pivots reference local submatrix; so shift by g_ipiv_tile_indx
+        ipiv[l_ipiv_rindx-1] = ((tileIndexSwap+g_ipiv_tile_indx) * pivot_nb) + (elementOffsetSwap + 1);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Tiles from fromScaLAPACK alias the local array, with stride lld, so tile
+/// kernels touch lld-strided columns, and converting tiles to row-major
+/// needs extended buffers. For factorizations with inner dimension k at
+/// least SLATE_SCALAPACK_PACK, copies A, in parallel tasks and without
+/// communication, into a new matrix with the same tiles and distribution,
+/// each tile stored contiguously in one host slab per process
+/// (TileAlloc::Slab). Pivots are unchanged, as the tiles are the same.
+/// Devices copy tiles to contiguous GPU tiles anyway, so are not packed.
+/// @see slate_scalapack_unpack
+///
+/// @return the packed copy, or A itself if not packed.
+///
+template <typename scalar_t>
+slate::Matrix<scalar_t> slate_scalapack_pack(
+    slate::Matrix<scalar_t>& A, int64_t k, slate::Target target)
+{
+    int64_t pack = PackConfig::value();
+    if (pack <= 0 || k < pack || target == slate::Target::Devices)
+        return A;
+
+    auto Ap = A.emptyLike();
+    Ap.insertLocalTiles( slate::TileAlloc::Slab );
+    slate::copy( A, Ap, {{ slate::Option::Target, slate::Target::HostTask }} );
+    return Ap;
+}
+
+//------------------------------------------------------------------------------
+/// Copies the packed matrix Ap from slate_scalapack_pack back into A.
+/// Does nothing if A was not packed.
+///
+template <typename scalar_t>
+void slate_scalapack_unpack(
+    slate::Matrix<scalar_t>& Ap, slate::Matrix<scalar_t>& A)
+{
+    if (Ap.hostSlab() != nullptr && Ap.hostSlab() != A.hostSlab())
+        slate::copy( Ap, A, {{ slate::Option::Target, slate::Target::HostTask }} );
+}
+
 } // namespace scalapack_api
 } // namespace slate
 
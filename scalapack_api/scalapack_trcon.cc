@@ -103,7 +103,8 @@ void slate_ptrcon(const char* normstr, const char* uplostr, const char* diagstr,
     int64_t lookahead = LookaheadConfig::value();
     int64_t panel_threads = PanelThreadsConfig::value();
     int64_t ib = IBConfig::value();
-    slate::GridOrder grid_order = slate_scalapack_blacs_grid_order();
+    slate::GridOrder grid_order = slate_scalapack_blacs_grid_order(desc_CTXT(desca));
+    MPI_Comm mpi_comm = slate_scalapack_blacs_comm(desc_CTXT(desca));
 
     // todo: extract the real info from getrf
     *info = 0;
@@ -129,7 +130,7 @@ void slate_ptrcon(const char* normstr, const char* uplostr, const char* diagstr,
     int64_t An = n;
 
     // create SLATE matrices from the ScaLAPACK layouts
-    auto AT = slate::TriangularMatrix<scalar_t>::fromScaLAPACK(uplo, diag, desc_N(desca), a, desc_LLD(desca), desc_NB(desca), grid_order, nprow, npcol, MPI_COMM_WORLD);
+    auto AT = slate::TriangularMatrix<scalar_t>::fromScaLAPACK(uplo, diag, desc_N(desca), a, desc_LLD(desca), desc_NB(desca), grid_order, nprow, npcol, mpi_comm);
     AT = slate_scalapack_submatrix(Am, An, AT, ia, ja, desca);
 
     blas::real_type<scalar_t> anorm = slate::norm( norm, AT, {
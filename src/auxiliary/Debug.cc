@@ -301,17 +301,17 @@ void Debug::checkHostMemoryLeaks(Memory const& m)
 {
     using llu = long long unsigned;
     if (! debug_) return;
-    if (m.free_blocks_.at( HostNum ).size() < m.capacity_.at( HostNum )) {
+    if (m.host_free_blocks_.size() < m.host_capacity_) {
         fprintf(stderr,
                 "Error: memory leak: freed %llu of %llu blocks on host\n",
-                (llu) m.free_blocks_.at( HostNum ).size(),
-                (llu) m.capacity_.at( HostNum ));
+                (llu) m.host_free_blocks_.size(),
+                (llu) m.host_capacity_);
     }
-    else if (m.free_blocks_.at( HostNum ).size() > m.capacity_.at( HostNum )) {
+    else if (m.host_free_blocks_.size() > m.host_capacity_) {
         fprintf(stderr,
                 "Error: freed too many: %llu of %llu blocks on host\n",
-                (llu) m.free_blocks_.at( HostNum ).size(),
-                (llu) m.capacity_.at( HostNum ));
+                (llu) m.host_free_blocks_.size(),
+                (llu) m.host_capacity_);
     }
 }
 
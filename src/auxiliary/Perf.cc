@@ -0,0 +1,439 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/internal/Perf.hh"
+#include "slate/internal/openmp.hh"
+
+#include <cassert>
+#include <cstring>
+#include <iterator>
+#include <mutex>
+#include <set>
+#include <vector>
+
+namespace slate {
+namespace perf {
+
+std::atomic<bool> Perf::enabled_( false );
+
+namespace {
+
+/// Number of OpenMP nesting levels whose open region is tracked for tasks.
+const int max_levels = 8;
+
+/// Interned region path; nullptr is the top level, outside any region.
+using Path = std::string const*;
+
+//------------------------------------------------------------------------------
+/// Counters and region stack of one thread.
+/// The mutex is contended only when report() or clear() reads the counters.
+struct ThreadData {
+    ThreadData();
+    ~ThreadData();
+
+    std::mutex mutex;
+    std::map< Path, Counters > counters;
+    std::vector< Path > stack;
+
+    /// Paths interned by this thread, keyed by parent path and region name.
+    std::map< std::pair< Path, std::string >, Path > paths;
+};
+
+/// Region open on some thread.
+struct OpenRegion {
+    Region const* region;
+    Path path;
+    int level;                          ///< OpenMP nesting level
+    int64_t peak;                       ///< peak memory use while open
+};
+
+//------------------------------------------------------------------------------
+/// Process-wide state. Constructed on first use, before any ThreadData,
+/// so it outlives them all.
+struct Registry {
+    Registry()
+    {
+        for (int level = 0; level < max_levels; ++level)
+            level_paths[ level ].store( nullptr );
+    }
+
+    void update_level_path(int level);
+
+    std::mutex mutex;                   ///< guards threads and retired
+    std::set<ThreadData*> threads;
+    Report retired;                     ///< counters of exited threads
+
+    std::mutex paths_mutex;             ///< guards paths
+    std::set<std::string> paths;        ///< interned paths, never freed
+
+    std::mutex open_mutex;              ///< guards open
+    std::vector<OpenRegion> open;       ///< open regions, in order opened
+
+    /// Path of the most recently opened region still open at each OpenMP
+    /// nesting level, on any thread. Derived from open, so it stays valid
+    /// when regions close out of order; read without locking.
+    std::atomic<Path> level_paths[ max_levels ];
+
+    std::atomic<int64_t> memory_in_use{ 0 };
+};
+
+//------------------------------------------------------------------------------
+/// Sets level_paths[ level ] from the open regions. Requires open_mutex.
+void Registry::update_level_path(int level)
+{
+    if (level >= max_levels)
+        return;
+
+    Path path = nullptr;
+    for (auto iter = open.rbegin(); iter != open.rend(); ++iter) {
+        if (iter->level == level) {
+            path = iter->path;
+            break;
+        }
+    }
+    level_paths[ level ].store( path, std::memory_order_release );
+}
+
+Registry& registry()
+{
+    static Registry registry_;
+    return registry_;
+}
+
+ThreadData::ThreadData()
+{
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> guard( reg.mutex );
+    reg.threads.insert( this );
+}
+
+/// Folds this thread's counters into the retired counters,
+/// so they survive the thread's exit.
+ThreadData::~ThreadData()
+{
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> guard( reg.mutex );
+    for (auto const& entry : counters)
+        reg.retired[ entry.first ? *entry.first : "" ] += entry.second;
+    reg.threads.erase( this );
+}
+
+ThreadData& thread_data()
+{
+    static thread_local ThreadData data_;
+    return data_;
+}
+
+//------------------------------------------------------------------------------
+/// @return path of the innermost region open on this thread; if none,
+/// the innermost region open at a lower OpenMP nesting level, i.e., one
+/// that encloses this thread's parallel region; if none, nullptr.
+/// Regions opened by sibling tasks are at the same level, so they are
+/// skipped.
+Path current_path(ThreadData& data)
+{
+    if (! data.stack.empty())
+        return data.stack.back();
+
+    Registry& reg = registry();
+    for (int level = std::min( omp_get_level(), max_levels ) - 1;
+         level >= 0; --level)
+    {
+        Path path = reg.level_paths[ level ].load( std::memory_order_acquire );
+        if (path != nullptr)
+            return path;
+    }
+    return nullptr;
+}
+
+//------------------------------------------------------------------------------
+/// @return interned path of region name nested in parent.
+/// Paths are cached per thread, so the shared set is locked only the
+/// first time a thread opens a given region.
+Path intern(ThreadData& data, Path parent, const char* name)
+{
+    auto key = std::make_pair( parent, std::string( name ) );
+    auto iter = data.paths.find( key );
+    if (iter != data.paths.end())
+        return iter->second;
+
+    std::string path = parent == nullptr ? key.second
+                                         : *parent + "::" + key.second;
+    Registry& reg = registry();
+    Path result;
+    {
+        std::lock_guard<std::mutex> guard( reg.paths_mutex );
+        result = &*reg.paths.insert( path ).first;
+    }
+    data.paths[ key ] = result;
+    return result;
+}
+
+//------------------------------------------------------------------------------
+/// Applies update to the current region's counters on this thread.
+template <typename Update>
+void record(Update update)
+{
+    ThreadData& data = thread_data();
+    Path path = current_path( data );
+
+    std::lock_guard<std::mutex> guard( data.mutex );
+    update( data.counters[ path ] );
+}
+
+/// Number of values per region in reduce()'s message.
+const int num_values = 9;
+
+} // namespace
+
+//------------------------------------------------------------------------------
+/// Resets all counters on all threads. Regions that are open continue,
+/// adding to the cleared counters when they close.
+void Perf::clear()
+{
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> guard( reg.mutex );
+    reg.retired.clear();
+    for (ThreadData* data : reg.threads) {
+        std::lock_guard<std::mutex> data_guard( data->mutex );
+        data->counters.clear();
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @return counters on this MPI rank, summed over all threads.
+/// Time of a region opened on several threads, such as an internal kernel
+/// called from concurrent tasks, is the sum of its time on each thread.
+Report Perf::report()
+{
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> guard( reg.mutex );
+    Report result = reg.retired;
+    for (ThreadData* data : reg.threads) {
+        std::lock_guard<std::mutex> data_guard( data->mutex );
+        for (auto const& entry : data->counters)
+            result[ entry.first ? *entry.first : "" ] += entry.second;
+    }
+    return result;
+}
+
+//------------------------------------------------------------------------------
+/// Reduces reports from all ranks in comm onto root.
+/// For each region, time and workspace_hwm are the max over ranks;
+/// the other counters are summed over ranks.
+/// Regions need not be the same on all ranks.
+/// Collective over comm.
+///
+/// @param[in] local
+///     This rank's report, usually from report().
+///
+/// @param[in] comm
+///     MPI communicator.
+///
+/// @param[in] root
+///     Rank in comm that receives the result.
+///
+/// @return on root, the reduced report; on other ranks, an empty report.
+///
+Report Perf::reduce(Report const& local, MPI_Comm comm, int root)
+{
+    int mpi_rank, mpi_size;
+    slate_mpi_call( MPI_Comm_rank( comm, &mpi_rank ) );
+    slate_mpi_call( MPI_Comm_size( comm, &mpi_size ) );
+
+    // Pack paths as null-terminated strings, and counters as doubles.
+    std::vector<char> names;
+    std::vector<double> values;
+    values.reserve( num_values * local.size() );
+    for (auto const& entry : local) {
+        names.insert( names.end(), entry.first.begin(), entry.first.end() );
+        names.push_back( '\0' );
+        Counters const& c = entry.second;
+        values.insert( values.end(), {
+            double( c.calls ), c.time, c.mpi_wait, c.flops,
+            double( c.bytes_sent ), double( c.bytes_recv ),
+            double( c.msgs_sent ),  double( c.msgs_recv ),
+            double( c.workspace_hwm ) } );
+    }
+
+    int sizes[ 2 ] = { int( names.size() ), int( values.size() ) };
+    std::vector<int> all_sizes( 2*mpi_size );
+    slate_mpi_call(
+        MPI_Gather( sizes, 2, MPI_INT, all_sizes.data(), 2, MPI_INT,
+                    root, comm ) );
+
+    std::vector<int> names_counts( mpi_size ), names_displs( mpi_size );
+    std::vector<int> values_counts( mpi_size ), values_displs( mpi_size );
+    int names_total = 0, values_total = 0;
+    if (mpi_rank == root) {
+        for (int rank = 0; rank < mpi_size; ++rank) {
+            names_counts[ rank ]  = all_sizes[ 2*rank ];
+            values_counts[ rank ] = all_sizes[ 2*rank + 1 ];
+            names_displs[ rank ]  = names_total;
+            values_displs[ rank ] = values_total;
+            names_total  += names_counts[ rank ];
+            values_total += values_counts[ rank ];
+        }
+    }
+    std::vector<char> all_names( names_total );
+    std::vector<double> all_values( values_total );
+    slate_mpi_call(
+        MPI_Gatherv( names.data(), sizes[ 0 ], MPI_CHAR,
+                     all_names.data(), names_counts.data(),
+                     names_displs.data(), MPI_CHAR, root, comm ) );
+    slate_mpi_call(
+        MPI_Gatherv( values.data(), sizes[ 1 ], MPI_DOUBLE,
+                     all_values.data(), values_counts.data(),
+                     values_displs.data(), MPI_DOUBLE, root, comm ) );
+
+    Report result;
+    if (mpi_rank == root) {
+        char const* name = all_names.data();
+        for (int64_t k = 0; k < values_total; k += num_values) {
+            double const* v = &all_values[ k ];
+            Counters& c = result[ name ];
+            c.calls      += int64_t( v[ 0 ] );
+            c.time        = std::max( c.time, v[ 1 ] );
+            c.mpi_wait   += v[ 2 ];
+            c.flops      += v[ 3 ];
+            c.bytes_sent += int64_t( v[ 4 ] );
+            c.bytes_recv += int64_t( v[ 5 ] );
+            c.msgs_sent  += int64_t( v[ 6 ] );
+            c.msgs_recv  += int64_t( v[ 7 ] );
+            c.workspace_hwm = std::max( c.workspace_hwm, int64_t( v[ 8 ] ) );
+            name += strlen( name ) + 1;
+        }
+    }
+    return result;
+}
+
+//------------------------------------------------------------------------------
+/// Adds flops to the current region.
+void Perf::flops(double flops)
+{
+    if (! enabled())
+        return;
+    record( [flops](Counters& c) { c.flops += flops; } );
+}
+
+//------------------------------------------------------------------------------
+/// Adds time blocked in MPI to the current region.
+void Perf::mpiWait(double seconds)
+{
+    if (! enabled())
+        return;
+    record( [seconds](Counters& c) { c.mpi_wait += seconds; } );
+}
+
+//------------------------------------------------------------------------------
+/// Counts one tile message of the given size sent by the current region.
+void Perf::send(int64_t bytes)
+{
+    if (! enabled())
+        return;
+    record( [bytes](Counters& c) { c.bytes_sent += bytes; c.msgs_sent += 1; } );
+}
+
+//------------------------------------------------------------------------------
+/// Counts one tile message of the given size received by the current region.
+void Perf::recv(int64_t bytes)
+{
+    if (! enabled())
+        return;
+    record( [bytes](Counters& c) { c.bytes_recv += bytes; c.msgs_recv += 1; } );
+}
+
+//------------------------------------------------------------------------------
+/// Called by Memory when it hands out a block of the given size while
+/// enabled. Memory calls memoryFree() with the same size for each such
+/// block, even if disabled by then, so memory use stays balanced.
+/// Raises the peak of each open region.
+void Perf::memoryAlloc(int64_t bytes)
+{
+    Registry& reg = registry();
+    int64_t in_use = reg.memory_in_use.fetch_add( bytes ) + bytes;
+
+    std::lock_guard<std::mutex> guard( reg.open_mutex );
+    for (auto& open : reg.open)
+        open.peak = std::max( open.peak, in_use );
+}
+
+//------------------------------------------------------------------------------
+/// Called by Memory when a block counted by memoryAlloc() is returned.
+void Perf::memoryFree(int64_t bytes)
+{
+    registry().memory_in_use.fetch_sub( bytes );
+}
+
+//------------------------------------------------------------------------------
+/// Opens a region named name, nested under the current region.
+/// Does nothing if Perf is disabled.
+Region::Region(const char* name)
+    : active_( Perf::enabled() ),
+      level_( 0 ),
+      start_( 0 ),
+      flops_( 0 ),
+      path_( nullptr )
+{
+    if (! active_)
+        return;
+
+    ThreadData& data = thread_data();
+    path_ = intern( data, current_path( data ), name );
+    data.stack.push_back( path_ );
+
+    // The peak starts from the current use.
+    Registry& reg = registry();
+    level_ = omp_get_level();
+    {
+        std::lock_guard<std::mutex> guard( reg.open_mutex );
+        reg.open.push_back(
+            { this, path_, level_, reg.memory_in_use.load() } );
+        reg.update_level_path( level_ );
+    }
+
+    start_ = MPI_Wtime();
+}
+
+//------------------------------------------------------------------------------
+/// Closes the region, adding its time, flops, and workspace peak
+/// to its counters.
+Region::~Region()
+{
+    if (! active_)
+        return;
+
+    double time = MPI_Wtime() - start_;
+
+    ThreadData& data = thread_data();
+    assert( ! data.stack.empty() && data.stack.back() == path_ );
+    data.stack.pop_back();
+
+    // Remove this region, wherever it is in the open list, since regions
+    // on other threads may have opened after it and still be open.
+    Registry& reg = registry();
+    int64_t workspace_peak = 0;
+    {
+        std::lock_guard<std::mutex> guard( reg.open_mutex );
+        for (auto iter = reg.open.rbegin(); iter != reg.open.rend(); ++iter) {
+            if (iter->region == this) {
+                workspace_peak = iter->peak;
+                reg.open.erase( std::next( iter ).base() );
+                break;
+            }
+        }
+        reg.update_level_path( level_ );
+    }
+
+    std::lock_guard<std::mutex> guard( data.mutex );
+    Counters& c = data.counters[ path_ ];
+    c.calls += 1;
+    c.time  += time;
+    c.flops += flops_;
+    c.workspace_hwm = std::max( c.workspace_hwm, workspace_peak );
+}
+
+} // namespace perf
+} // namespace slate
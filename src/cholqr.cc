@@ -25,6 +25,27 @@ inline MethodCholQR select_algo( TA& A, TB& B, Options const& opts )
 
 namespace impl {
 
+//------------------------------------------------------------------------------
+/// @internal
+/// Adds shift to the diagonal of the Gram matrix, R = R + shift I.
+///
+/// @ingroup geqrf_specialization
+///
+template <typename scalar_t>
+void cholqr_shift(
+    BaseMatrix<scalar_t>& R,
+    blas::real_type<scalar_t> shift )
+{
+    for (int64_t i = 0; i < std::min( R.mt(), R.nt() ); ++i) {
+        if (R.tileIsLocal( i, i )) {
+            R.tileGetForWriting( i, i, LayoutConvert::ColMajor );
+            auto Rii = R( i, i );
+            for (int64_t ii = 0; ii < std::min( Rii.mb(), Rii.nb() ); ++ii)
+                Rii.at( ii, ii ) += shift;
+        }
+    }
+}
+
 //------------------------------------------------------------------------------
 /// @internal
 /// Generic implementation for any target that uses either gemmA or gemmC
@@ -36,6 +57,7 @@ template <Target target, typename scalar_t>
 void cholqr(
     Matrix<scalar_t>& A,
     Matrix<scalar_t>& R,
+    blas::real_type<scalar_t> shift,
     Options const& opts )
 {
     // Constants
@@ -66,6 +88,9 @@ void cholqr(
             slate_error( "CholQR unknown method" );
     }
 
+    if (shift != 0)
+        cholqr_shift( R, shift );
+
     // Compute L * L^t = chol(R).
     potrf( R_hermitian, opts );
 
@@ -84,6 +109,7 @@ template <Target target, typename scalar_t>
 void cholqr(
     Matrix<scalar_t>& A,
     HermitianMatrix<scalar_t>& R,
+    blas::real_type<scalar_t> shift,
     Options const& opts )
 {
     slate_assert( R.uplo() == Uplo::Upper );
@@ -99,6 +125,9 @@ void cholqr(
     // Compute R = AH * A.
     herk( r_one, AH, r_zero, R, opts );
 
+    if (shift != 0)
+        cholqr_shift( R, shift );
+
     // Compute Ut * U = chol(R).
     potrf( R, opts );
 
@@ -106,29 +135,25 @@ void cholqr(
     trsm( Side::Right, one, U, A, opts );
 }
 
-} // namespace impl
-
 //------------------------------------------------------------------------------
+/// @internal
+/// One Cholesky QR pass, A = Q R, computing the Gram matrix A^H A + shift I
+/// with the given method.
 ///
-/// Select the requested function to compute A^H * A.
-///
+/// @ingroup geqrf_specialization
 ///
 template <Target target, typename scalar_t>
-void cholqr(
+void cholqr_pass(
+    MethodCholQR method,
     Matrix<scalar_t>& A,
     Matrix<scalar_t>& R,
+    blas::real_type<scalar_t> shift,
     Options const& opts )
 {
-    MethodCholQR method = get_option(
-        opts, Option::MethodCholQR, MethodCholQR::Auto );
-
-    if (method == MethodCholQR::Auto)
-        method = select_algo( A, R, opts );
-
     switch (method) {
         case MethodCholQR::HerkC: {
             HermitianMatrix H( Uplo::Upper, R );
-            impl::cholqr<target>( A, H, opts );
+            cholqr<target>( A, H, shift, opts );
             break;
         }
         case MethodCholQR::GemmA:
@@ -136,7 +161,7 @@ void cholqr(
         case MethodCholQR::GemmC:{
             Options opts2 = opts;
             opts2[ Option::MethodCholQR ] = method;
-            impl::cholqr<target>( A, R, opts2 );
+            cholqr<target>( A, R, shift, opts2 );
             break;
         }
         default:
@@ -145,6 +170,81 @@ void cholqr(
     }
 }
 
+} // namespace impl
+
+//------------------------------------------------------------------------------
+///
+/// Select the requested function to compute A^H * A, and the number of
+/// passes. CholQR2 repeats the factorization on the computed Q;
+/// shifted CholQR3 precedes CholQR2 with a pass on A^H A + s I,
+/// which keeps the first Cholesky factorization from breaking down.
+/// The R factors of the passes are accumulated, R = R_k ... R_2 R_1.
+///
+template <Target target, typename scalar_t>
+void cholqr(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& R,
+    Options const& opts )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    MethodCholQR method = get_option(
+        opts, Option::MethodCholQR, MethodCholQR::Auto );
+
+    int passes = 1;
+    bool shifted = false;
+    if (method == MethodCholQR::CholQR2) {
+        passes = 2;
+        method = MethodCholQR::Auto;
+    }
+    else if (method == MethodCholQR::ShiftCholQR3) {
+        passes = 3;
+        shifted = true;
+        method = MethodCholQR::Auto;
+    }
+
+    if (method == MethodCholQR::Auto)
+        method = select_algo( A, R, opts );
+
+    // Shift s = 11 (m n + n (n+1)) u ||A||^2 from Fukaya et al.,
+    // using ||A||_F as a cheap upper bound on ||A||_2.
+    real_t shift = 0;
+    if (shifted) {
+        real_t m = A.m();
+        real_t n = A.n();
+        real_t Anorm = norm( Norm::Fro, A, opts );
+        shift = 11 * (m*n + n*(n + 1)) * std::numeric_limits<real_t>::epsilon()
+              * Anorm * Anorm;
+    }
+
+    impl::cholqr_pass<target>( method, A, R, shift, opts );
+
+    if (passes > 1) {
+        // Workspace for R_k, and for the product R_k R.
+        auto Rk = R.emptyLike();
+        Rk.insertLocalTiles();
+        auto W = R.emptyLike();
+        W.insertLocalTiles();
+
+        auto R_upper = TrapezoidMatrix<scalar_t>( Uplo::Upper, Diag::NonUnit, R );
+        auto W_upper = TrapezoidMatrix<scalar_t>( Uplo::Upper, Diag::NonUnit, W );
+        auto Uk = TriangularMatrix<scalar_t>( Uplo::Upper, Diag::NonUnit, Rk );
+
+        for (int pass = 1; pass < passes; ++pass) {
+            impl::cholqr_pass<target>( method, A, Rk, real_t( 0 ), opts );
+
+            // R = R_k R, using only the upper triangles.
+            set( zero, W, opts );
+            slate::copy( R_upper, W_upper, opts );
+            trmm( Side::Left, one, Uk, W, opts );
+            slate::copy( W, R, opts );
+        }
+    }
+}
+
 //------------------------------------------------------------------------------
 /// Distributed parallel Cholesky QR factorization.
 ///
@@ -156,6 +256,12 @@ void cholqr(
 /// where $Q$ is a matrix with orthonormal columns and $R$ is upper triangular
 /// (or upper trapezoidal if m < n).
 ///
+/// A single pass loses orthogonality in proportion to $\kappa(A)^2$ and
+/// fails if $A^H A$ is numerically singular. MethodCholQR::CholQR2 and
+/// MethodCholQR::ShiftCholQR3 repeat the pass, with the same Gram matrix
+/// computation and a single reduction of the n-by-n Gram matrix per pass,
+/// to give orthogonality comparable to geqrf.
+///
 //------------------------------------------------------------------------------
 /// @tparam scalar_t
 ///     One of float, double, std::complex<float>, std::complex<double>.
@@ -183,6 +289,11 @@ void cholqr(
 ///       - GemmA:
 ///       - GemmC:
 ///       - HerkC:
+///       or the number of passes, with A^H * A computed as for Auto:
+///       - CholQR2: two passes, for orthogonality to O(eps)
+///         when $\kappa(A) < O(\epsilon^{-1/2})$.
+///       - ShiftCholQR3: a shifted pass followed by two passes,
+///         for orthogonality to O(eps) when $\kappa(A) < O(\epsilon^{-1})$.
 ///     - Option::Target:
 ///       Implementation to target. Possible values:
 ///       - HostTask:  OpenMP tasks on CPU host [default].
@@ -62,14 +62,14 @@ void colNorms(
         }
 
         MPI_Op op_max_nan;
-        #pragma omp critical(slate_mpi)
         {
+            internal::MpiCriticalGuard guard;
             slate_mpi_call(
                 MPI_Op_create(mpi_max_nan, true, &op_max_nan));
         }
 
-        #pragma omp critical(slate_mpi)
         {
+            internal::MpiCriticalGuard guard;
             trace::Block trace_block("MPI_Allreduce");
             slate_mpi_call(
                 MPI_Allreduce(local_maxes.data(), values,
@@ -77,8 +77,8 @@ void colNorms(
                               op_max_nan, A.mpiComm()));
         }
 
-        #pragma omp critical(slate_mpi)
         {
+            internal::MpiCriticalGuard guard;
             slate_mpi_call(
                 MPI_Op_free(&op_max_nan));
         }
@@ -5,8 +5,13 @@
 
 #include "auxiliary/Debug.hh"
 #include "slate/internal/Memory.hh"
+#include "slate/internal/Perf.hh"
 #include "slate/Exception.hh"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
 namespace slate {
 
 int Memory::num_devices_;
@@ -18,7 +23,11 @@ Memory::Memory(size_t block_size):
     block_size_(block_size),
     free_blocks_( num_devices_ ),
     allocated_mem_( num_devices_ ),
-    capacity_( num_devices_ )
+    capacity_( num_devices_ ),
+    host_fd_( -1 ),
+    host_file_size_( 0 ),
+    host_capacity_( 0 ),
+    perf_blocks_( 0 )
 {
 }
 
@@ -36,25 +45,46 @@ Memory::~Memory()
         assert(capacity_[ device ] == 0);
     }
     // Debug::printNumFreeMemBlocks(*this);
+
+    // Host blocks don't need a queue, so they can be released here.
+    for (auto& slab : host_slabs_) {
+        munmap( slab.first, slab.second );
+    }
+    if (outOfCore()) {
+        for (auto& segment : host_segments_) {
+            freeHostMemory( segment.first );
+        }
+        close( host_fd_ );
+    }
 }
 
-/*
 //------------------------------------------------------------------------------
 /// Allocates num_blocks in host memory
 /// and adds them to the pool of free blocks.
+/// Host blocks are pooled only in out-of-core mode; otherwise, host blocks
+/// are allocated individually by alloc(), and this does nothing.
 ///
 // todo: merge with addDeviceBlocks by recognizing HostNum?
 void Memory::addHostBlocks(int64_t num_blocks)
 {
+    if (! outOfCore() || num_blocks <= 0)
+        return;
+
     // or std::byte* (C++17)
     uint8_t* host_mem;
-    host_mem = (uint8_t*) allocHostMemory(block_size_*num_blocks);
-    capacity_[ HostNum ] += num_blocks;
-
-    for (int64_t i = 0; i < num_blocks; ++i)
-        free_blocks_[ HostNum ].push(host_mem + i*block_size_);
+    #pragma omp critical(slate_memory)
+    {
+        host_mem = (uint8_t*) allocHostMemory(block_size_*num_blocks);
+        if (host_mem != nullptr) {
+            host_capacity_ += num_blocks;
+            for (int64_t i = 0; i < num_blocks; ++i)
+                host_free_blocks_.push(host_mem + i*block_size_);
+        }
+    }
+    // Throw outside the critical region.
+    if (host_mem == nullptr)
+        slate_error( "could not allocate out-of-core scratch file" );
 }
-*/
 
 //------------------------------------------------------------------------------
 /// Allocates num_blocks in given device's memory
@@ -71,26 +101,180 @@ void Memory::addDeviceBlocks(int device, int64_t num_blocks, blas::Queue *queue)
         free_blocks_[device].push(dev_mem + i*block_size_);
 }
 
-/*
 //------------------------------------------------------------------------------
 /// Empties the pool of free blocks of host memory and frees the allocations.
+/// In out-of-core mode, this truncates the scratch file, which stays open
+/// until the destructor, so out-of-core mode remains enabled.
 ///
 // todo: merge with clearDeviceBlocks by recognizing HostNum?
 void Memory::clearHostBlocks()
 {
+    if (! outOfCore())
+        return;
+
     Debug::checkHostMemoryLeaks(*this);
 
-    while (! free_blocks_[ HostNum ].empty())
-        free_blocks_[ HostNum ].pop();
+    #pragma omp critical(slate_memory)
+    {
+        while (! host_free_blocks_.empty())
+            host_free_blocks_.pop();
 
-    while (! allocated_mem_[ HostNum ].empty()) {
-        void* host_mem = allocated_mem_[ HostNum ].top();
-        freeHostMemory( host_mem );
-        allocated_mem_[ HostNum ].pop();
+        for (auto& segment : host_segments_) {
+            freeHostMemory( segment.first );
+        }
+        host_segments_.clear();
+        host_capacity_ = 0;
     }
-    capacity_[ HostNum ] = 0;
+
+    if (ftruncate( host_fd_, 0 ) != 0)
+        slate_error( "could not truncate out-of-core scratch file" );
+    host_file_size_ = 0;
+}
+
+//------------------------------------------------------------------------------
+/// Enables out-of-core mode, where host blocks are backed by an anonymous
+/// scratch file created in scratch_dir. The file is unlinked immediately,
+/// so it is removed by the OS when the process exits, even on abnormal exit.
+/// Each MPI rank creates its own file.
+///
+/// Must be called before any host blocks are allocated from this pool.
+///
+/// @param[in] scratch_dir
+///     Directory for the scratch file, preferably on a fast local disk.
+///
+void Memory::setOutOfCore(std::string const& scratch_dir)
+{
+    if (outOfCore())
+        return;
+
+    slate_assert( host_capacity_ == 0 );
+
+    std::string path = scratch_dir + "/slate_ooc_XXXXXX";
+    std::vector<char> name( path.begin(), path.end() );
+    name.push_back( '\0' );
+    int fd = mkstemp( name.data() );
+    if (fd < 0)
+        slate_error( "could not create out-of-core scratch file " + path );
+    unlink( name.data() );
+
+    host_fd_ = fd;
+    host_file_size_ = 0;
+}
+
+//------------------------------------------------------------------------------
+/// Allocates a host slab of at least size bytes, aligned to 2 MiB and
+/// preferably backed by huge pages: explicit huge pages (MAP_HUGETLB) if the
+/// system has them reserved, else transparent huge pages (MADV_HUGEPAGE).
+/// Huge pages cut TLB misses compared to individually allocated tiles.
+///
+/// The slab is first touched in parallel by the OpenMP threads, each
+/// touching a contiguous part, so the OS places its pages in the memory
+/// domains of the threads. It is freed by the destructor.
+///
+void* Memory::allocHostSlab(size_t size)
+{
+    const size_t huge_page = 2*1024*1024;
+    size = (size + huge_page - 1) / huge_page * huge_page;
+
+    char* slab = (char*) MAP_FAILED;
+#ifdef MAP_HUGETLB
+    slab = (char*) mmap( nullptr, size, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+#endif
+    if (slab == MAP_FAILED) {
+        // Over-allocate by a huge page to align the slab, then trim the ends.
+        char* mem = (char*) mmap( nullptr, size + huge_page,
+                                  PROT_READ | PROT_WRITE,
+                                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+        if (mem == MAP_FAILED)
+            slate_error( "could not allocate host slab" );
+        slab = (char*) ((uintptr_t( mem ) + huge_page - 1) & ~(huge_page - 1));
+        if (slab > mem)
+            munmap( mem, slab - mem );
+        munmap( slab + size, mem + huge_page - slab );
+#ifdef MADV_HUGEPAGE
+        madvise( slab, size, MADV_HUGEPAGE );
+#endif
+    }
+
+    int64_t page = sysconf( _SC_PAGESIZE );
+    int64_t num_pages = size / page;
+    #pragma omp parallel for schedule( static )
+    for (int64_t k = 0; k < num_pages; ++k) {
+        slab[ k*page ] = 0;
+    }
+
+    #pragma omp critical(slate_memory)
+    {
+        host_slabs_[ slab ] = size;
+    }
+    return slab;
+}
+
+//------------------------------------------------------------------------------
+/// Hints that the host memory [ptr, ptr + size) will be accessed soon,
+/// so the OS starts reading it in asynchronously.
+/// Does nothing unless ptr is a block of the out-of-core pool.
+///
+void Memory::prefetchHost(void const* ptr, size_t size) const
+{
+    if (! outOfCore() || ! isHostBlock( ptr ))
+        return;
+
+    // expand to whole pages
+    uintptr_t page = sysconf( _SC_PAGESIZE );
+    uintptr_t begin = uintptr_t( ptr ) & ~(page - 1);
+    uintptr_t end   = (uintptr_t( ptr ) + size + page - 1) & ~(page - 1);
+    madvise( (void*) begin, end - begin, MADV_WILLNEED );
+}
+
+//------------------------------------------------------------------------------
+/// Hints that the host memory [ptr, ptr + size) will not be accessed soon,
+/// so the OS may drop it from RAM. If modified, write-back to the scratch
+/// file is started first. Data is never lost; a later access reads it back.
+/// Does nothing unless ptr is a block of the out-of-core pool.
+///
+void Memory::evictHost(void const* ptr, size_t size, bool modified) const
+{
+    if (! outOfCore() || ! isHostBlock( ptr ))
+        return;
+
+    // shrink to whole pages, to not evict pages shared with neighbor blocks
+    uintptr_t page = sysconf( _SC_PAGESIZE );
+    uintptr_t begin = (uintptr_t( ptr ) + page - 1) & ~(page - 1);
+    uintptr_t end   = (uintptr_t( ptr ) + size) & ~(page - 1);
+    if (end <= begin)
+        return;
+
+    if (modified)
+        msync( (void*) begin, end - begin, MS_ASYNC );
+#ifdef MADV_PAGEOUT
+    madvise( (void*) begin, end - begin, MADV_PAGEOUT );
+#else
+    madvise( (void*) begin, end - begin, MADV_DONTNEED );
+#endif
+}
+
+//------------------------------------------------------------------------------
+/// @return true if ptr is within a segment of the out-of-core host pool.
+///
+/// Takes the slate_memory lock, as alloc() may add segments concurrently;
+/// don't call it while holding that lock.
+///
+bool Memory::isHostBlock(void const* ptr) const
+{
+    char const* p = (char const*) ptr;
+    bool found = false;
+    #pragma omp critical(slate_memory)
+    {
+        auto iter = host_segments_.upper_bound( (char*) p );
+        if (iter != host_segments_.begin()) {
+            --iter;
+            found = p < iter->first + iter->second;
+        }
+    }
+    return found;
 }
-*/
 
 //------------------------------------------------------------------------------
 /// Empties the pool of free blocks of given device's memory and frees the
@@ -120,8 +304,33 @@ void* Memory::alloc(int device, size_t size, blas::Queue* queue)
     void* block;
 
     if (device == HostNum) {
-        //block = malloc(size);
-        block = new char[size];
+        if (outOfCore() && size <= block_size_) {
+            block = nullptr;
+            #pragma omp critical(slate_memory)
+            {
+                if (host_free_blocks_.empty()) {
+                    // grow file by a segment of blocks
+                    uint8_t* host_mem = (uint8_t*) allocHostMemory(
+                        block_size_ * host_blocks_per_segment );
+                    if (host_mem != nullptr) {
+                        host_capacity_ += host_blocks_per_segment;
+                        for (int64_t i = 0; i < host_blocks_per_segment; ++i)
+                            host_free_blocks_.push( host_mem + i*block_size_ );
+                    }
+                }
+                if (! host_free_blocks_.empty()) {
+                    block = host_free_blocks_.top();
+                    host_free_blocks_.pop();
+                }
+            }
+            // Throw outside the critical region.
+            if (block == nullptr)
+                slate_error( "could not allocate out-of-core scratch file" );
+        }
+        else {
+            //block = malloc(size);
+            block = new char[size];
+        }
     }
     else {
         slate_assert( size <= block_size_ );
@@ -137,6 +346,14 @@ void* Memory::alloc(int device, size_t size, blas::Queue* queue)
             }
         }
     }
+    if (perf::Perf::enabled()) {
+        #pragma omp critical(slate_memory)
+        {
+            perf_sizes_[ block ] = size;
+        }
+        perf_blocks_.fetch_add( 1 );
+        perf::Perf::memoryAlloc( size );
+    }
     return block;
 }
 
@@ -146,9 +363,33 @@ void* Memory::alloc(int device, size_t size, blas::Queue* queue)
 ///
 void Memory::free(void* block, int device)
 {
+    if (perf_blocks_.load( std::memory_order_relaxed ) > 0) {
+        int64_t size = -1;
+        #pragma omp critical(slate_memory)
+        {
+            auto iter = perf_sizes_.find( block );
+            if (iter != perf_sizes_.end()) {
+                size = iter->second;
+                perf_sizes_.erase( iter );
+            }
+        }
+        if (size >= 0) {
+            perf_blocks_.fetch_sub( 1 );
+            perf::Perf::memoryFree( size );
+        }
+    }
+
     if (device == HostNum) {
-        //std::free(block);
-        delete[] (char*)block;
+        if (outOfCore() && isHostBlock( block )) {
+            #pragma omp critical(slate_memory)
+            {
+                host_free_blocks_.push(block);
+            }
+        }
+        else {
+            //std::free(block);
+            delete[] (char*)block;
+        }
     }
     else {
         #pragma omp critical(slate_memory)
@@ -164,8 +405,11 @@ void Memory::free(void* block, int device)
 void* Memory::allocBlock(int device, blas::Queue *queue)
 {
     void* block;
-    if (device == HostNum)
+    if (device == HostNum) {
         block = allocHostMemory(block_size_);
+        if (block == nullptr)
+            slate_error( "could not allocate out-of-core scratch file" );
+    }
     else
         block = allocDeviceMemory(device, block_size_, queue);
 
@@ -174,20 +418,31 @@ void* Memory::allocBlock(int device, blas::Queue *queue)
 }
 
 //------------------------------------------------------------------------------
-/// Allocates host memory of given size.
+/// Allocates host memory of given size, as a new segment of the
+/// out-of-core scratch file. The segment is recorded in host_segments_.
+/// Callers hold the slate_memory critical section, which exceptions must
+/// not leave, so this returns nullptr if the file can't be extended or
+/// mapped, and callers throw after leaving the critical section.
 ///
 void* Memory::allocHostMemory(size_t size)
 {
-    slate_not_implemented( "Memory pool currently doesn't handle host memory" );
-    return nullptr;
-    /*
-    void* host_mem;
-    host_mem = malloc(size);
-    assert(host_mem != nullptr);
-    allocated_mem_[ HostNum ].push( host_mem );
+    slate_assert( outOfCore() );
+
+    // Segments start on page boundaries, as required by mmap.
+    size_t page = sysconf( _SC_PAGESIZE );
+    size = (size + page - 1) / page * page;
+    off_t offset = host_file_size_;
+    if (ftruncate( host_fd_, offset + size ) != 0)
+        return nullptr;
+    host_file_size_ += size;
+
+    void* host_mem = mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                           host_fd_, offset );
+    if (host_mem == MAP_FAILED)
+        return nullptr;
+    host_segments_[ (char*) host_mem ] = size;
 
     return host_mem;
-    */
 }
 
 //------------------------------------------------------------------------------
@@ -202,11 +457,11 @@ void* Memory::allocDeviceMemory(int device, size_t size, blas::Queue *queue)
 }
 
 //------------------------------------------------------------------------------
-/// Frees host memory.
+/// Frees host memory, i.e., unmaps a segment of the out-of-core scratch file.
 ///
 void Memory::freeHostMemory(void* host_mem)
 {
-    std::free(host_mem);
+    munmap( host_mem, host_segments_.at( (char*) host_mem ) );
 }
 
 //------------------------------------------------------------------------------
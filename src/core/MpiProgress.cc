@@ -0,0 +1,231 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/internal/MpiProgress.hh"
+#include "slate/internal/openmp.hh"
+#include "slate/config.hh"
+
+#include <chrono>
+#include <mutex>
+#include <set>
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// @return true if MPI is initialized, not finalized, and provides
+/// MPI_THREAD_MULTIPLE.
+/// MPI is queried only until it is found initialized, since the thread
+/// level cannot change afterwards. Finalization isn't checked afterwards.
+bool mpi_thread_multiple()
+{
+    // -1: MPI not queried yet, 0: no, 1: yes.
+    static std::atomic<int> multiple( -1 );
+    int state = multiple.load( std::memory_order_acquire );
+    if (state < 0) {
+        int initialized, finalized, provided;
+        MPI_Initialized( &initialized );
+        if (! initialized)
+            return false;
+        MPI_Finalized( &finalized );
+        if (finalized)
+            return false;
+        MPI_Query_thread( &provided );
+        state = (provided >= MPI_THREAD_MULTIPLE ? 1 : 0);
+        multiple.store( state, std::memory_order_release );
+    }
+    return state == 1;
+}
+
+//------------------------------------------------------------------------------
+/// Serializes MPI calls when MPI provides less than MPI_THREAD_MULTIPLE.
+/// @see MpiCriticalGuard
+static std::mutex mpi_critical_mutex;
+
+void mpi_critical_lock()
+{
+    mpi_critical_mutex.lock();
+}
+
+void mpi_critical_unlock()
+{
+    mpi_critical_mutex.unlock();
+}
+
+//------------------------------------------------------------------------------
+/// @return the progress engine, started on first call,
+/// or nullptr if mpi_progress() is false, MPI isn't initialized,
+/// or MPI doesn't provide MPI_THREAD_MULTIPLE (see mpi_thread_multiple).
+/// Finalization isn't checked once MPI was found initialized,
+/// as the engine is used only to complete active requests.
+MpiProgress* MpiProgress::engine()
+{
+    if (! mpi_progress())
+        return nullptr;
+
+    if (! mpi_thread_multiple())
+        return nullptr;
+
+    // Thread-safe Scott Meyers' singleton.
+    static MpiProgress engine_;
+    return &engine_;
+}
+
+//------------------------------------------------------------------------------
+/// Starts the progress thread.
+MpiProgress::MpiProgress()
+    : incoming_( nullptr ),
+      stop_( false )
+{
+    thread_ = std::thread( &MpiProgress::run, this );
+}
+
+//------------------------------------------------------------------------------
+/// Stops the progress thread after it completes outstanding requests.
+MpiProgress::~MpiProgress()
+{
+    stop_.store( true );
+    if (thread_.joinable())
+        thread_.join();
+}
+
+//------------------------------------------------------------------------------
+/// Hands a group of nonblocking requests to the progress thread.
+/// The caller must have already counted them in pending, which is
+/// decremented as each request completes. The requests are set to
+/// MPI_REQUEST_NULL; the caller must not test, wait, or free them.
+/// All requests of a group are queued together, so if an error releases
+/// the group, the thread holds no other reference to pending.
+///
+/// @param[in,out] requests
+///     Active MPI requests, not MPI_REQUEST_NULL.
+///
+/// @param[in,out] pending
+///     Completion counter of the group. Must stay alive until wait()
+///     returns.
+///
+void MpiProgress::post(std::vector<MPI_Request>& requests,
+                       std::atomic<int>* pending)
+{
+    Node* node = new Node{ requests, pending, nullptr };
+    for (auto& request : requests)
+        request = MPI_REQUEST_NULL;
+
+    node->next = incoming_.load( std::memory_order_relaxed );
+    while (! incoming_.compare_exchange_weak(
+                node->next, node,
+                std::memory_order_release, std::memory_order_relaxed)) {
+        // node->next was updated to the current head; retry.
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Waits until pending reaches 0. While waiting, yields to other OpenMP
+/// tasks, so the calling thread can do useful work.
+/// Throws MpiException if the progress thread hit an MPI error while
+/// polling this group, which set pending to the negated error code.
+///
+void MpiProgress::wait(std::atomic<int>* pending)
+{
+    int count;
+    while ((count = pending->load( std::memory_order_acquire )) > 0) {
+        #pragma omp taskyield
+        std::this_thread::yield();
+    }
+    if (count < 0) {
+        throw MpiException( "MPI_Testsome", -count,
+                            __func__, __FILE__, __LINE__ );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Body of the progress thread.
+void MpiProgress::run()
+{
+    // Pause when idle, so the thread doesn't take a core from OpenMP.
+    const auto idle_sleep = std::chrono::microseconds( 20 );
+
+    std::vector<MPI_Request> requests;
+    std::vector<std::atomic<int>*> counters;
+    std::vector<int> indices;
+    std::vector<MPI_Status> statuses;
+    std::set<std::atomic<int>*> failed;
+
+    while (true) {
+        // Take all newly posted requests.
+        Node* node = incoming_.exchange( nullptr, std::memory_order_acquire );
+        while (node != nullptr) {
+            for (auto request : node->requests) {
+                requests.push_back( request );
+                counters.push_back( node->pending );
+            }
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+
+        if (requests.empty()) {
+            if (stop_.load())
+                break;
+            std::this_thread::sleep_for( idle_sleep );
+            continue;
+        }
+
+        int count = int( requests.size() );
+        int outcount = 0;
+        indices.resize( count );
+        statuses.resize( count );
+        int err = MPI_Testsome( count, requests.data(), &outcount,
+                                indices.data(), statuses.data() );
+        if (err != MPI_SUCCESS && err != MPI_ERR_IN_STATUS) {
+            // Error not tied to a request: release all waiters with it.
+            // Requests cannot be polled again, so all are dropped.
+            for (auto counter : counters)
+                counter->store( -err, std::memory_order_release );
+            requests.clear();
+            counters.clear();
+            continue;
+        }
+
+        if (outcount > 0 && outcount != MPI_UNDEFINED) {
+            // Mark groups with a failed request before counting the rest,
+            // so a failed group can't reach 0.
+            failed.clear();
+            if (err == MPI_ERR_IN_STATUS) {
+                for (int k = 0; k < outcount; ++k) {
+                    int status_err = statuses[ k ].MPI_ERROR;
+                    if (status_err != MPI_SUCCESS) {
+                        failed.insert( counters[ indices[ k ] ] );
+                        counters[ indices[ k ] ]->store(
+                            -status_err, std::memory_order_release );
+                    }
+                }
+            }
+            for (int k = 0; k < outcount; ++k) {
+                auto counter = counters[ indices[ k ] ];
+                if (failed.count( counter ) == 0)
+                    counter->fetch_sub( 1, std::memory_order_release );
+            }
+
+            // Remove completed requests, which MPI set to MPI_REQUEST_NULL,
+            // and the remaining requests of failed groups, whose waiters
+            // have returned.
+            int last = 0;
+            for (int k = 0; k < count; ++k) {
+                if (requests[ k ] != MPI_REQUEST_NULL
+                    && failed.count( counters[ k ] ) == 0) {
+                    requests[ last ] = requests[ k ];
+                    counters[ last ] = counters[ k ];
+                    ++last;
+                }
+            }
+            requests.resize( last );
+            counters.resize( last );
+        }
+    }
+}
+
+} // namespace internal
+} // namespace slate
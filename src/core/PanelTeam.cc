@@ -0,0 +1,203 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/internal/PanelTeam.hh"
+#include "slate/internal/openmp.hh"
+#include "slate/internal/util.hh"
+#include "slate/Exception.hh"
+
+#include <blas.hh>
+
+#ifdef BLAS_HAVE_MKL
+    #include <mkl_service.h>
+#endif
+
+#if defined( __linux__ )
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Binds the calling thread to the processors of the given OpenMP place.
+/// Does nothing if place < 0, or if the OS doesn't support thread affinity.
+///
+static void bind_thread_to_place(int place)
+{
+#if defined( __linux__ )
+    if (place < 0)
+        return;
+
+    int num_procs = omp_get_place_num_procs( place );
+    if (num_procs <= 0)
+        return;
+
+    std::vector<int> procs( num_procs );
+    omp_get_place_proc_ids( place, procs.data() );
+
+    cpu_set_t cpus;
+    CPU_ZERO( &cpus );
+    for (int proc : procs)
+        CPU_SET( proc, &cpus );
+    // Affinity is a hint here; on failure, the thread keeps its mask.
+    pthread_setaffinity_np( pthread_self(), sizeof(cpus), &cpus );
+#endif
+}
+
+//------------------------------------------------------------------------------
+/// Starts size - 1 worker threads; the caller of run() is thread 0.
+///
+/// If OpenMP threads are bound to places (OMP_PLACES, OMP_PROC_BIND),
+/// worker thread_rank is bound to the place thread_rank after the creating
+/// thread's place, as proc_bind( close ) would place the threads of a
+/// parallel region. Otherwise, workers inherit the creating thread's
+/// affinity.
+///
+/// @param[in] size
+///     Number of threads in the team, including the caller of run().
+///
+PanelTeam::PanelTeam(int size)
+    : size_( std::max( size, 1 ) ),
+      body_( nullptr ),
+      num_threads_( 0 ),
+      generation_( 0 ),
+      remaining_( 0 ),
+      stop_( false )
+{
+    int num_places = omp_get_num_places();
+    int first_place = omp_get_place_num();
+
+    workers_.reserve( size_ - 1 );
+    for (int thread_rank = 1; thread_rank < size_; ++thread_rank) {
+        int place = -1;
+        if (num_places > 0 && first_place >= 0)
+            place = (first_place + thread_rank) % num_places;
+        workers_.emplace_back( [this, thread_rank, place] {
+            bind_thread_to_place( place );
+            worker( thread_rank );
+        } );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Stops and joins the worker threads.
+PanelTeam::~PanelTeam()
+{
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        stop_.store( true );
+    }
+    wakeup_.notify_all();
+    for (auto& thread : workers_)
+        thread.join();
+}
+
+//------------------------------------------------------------------------------
+/// Runs body( thread_rank ) for thread_rank = 0, ..., num_threads - 1,
+/// concurrently on threads of the team; the caller runs thread_rank 0.
+/// Returns when all threads are done. Rethrows an exception thrown by body.
+/// Not thread safe: only one run() may be active at a time.
+///
+/// @param[in] num_threads
+///     Number of threads to run body on, 1 <= num_threads <= size().
+///
+/// @param[in] body
+///     Function to run on each thread. Threads may synchronize with a
+///     ThreadBarrier of num_threads threads.
+///
+void PanelTeam::run(
+    int num_threads, std::function<void (int thread_rank)> const& body)
+{
+    slate_assert( 1 <= num_threads && num_threads <= size_ );
+    if (num_threads == 1) {
+        body( 0 );
+        return;
+    }
+
+    // Publish the job; every worker acknowledges it, active or not,
+    // so the next run() can't overwrite it while a worker reads it.
+    body_ = &body;
+    num_threads_ = num_threads;
+    exception_ = nullptr;
+    remaining_.store( size_ - 1, std::memory_order_relaxed );
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        generation_.fetch_add( 1, std::memory_order_release );
+    }
+    wakeup_.notify_all();
+
+    std::exception_ptr exception;
+    try {
+        body( 0 );
+    }
+    catch (...) {
+        exception = std::current_exception();
+    }
+
+    SpinBackoff backoff;
+    while (remaining_.load( std::memory_order_acquire ) > 0)
+        backoff.pause();
+
+    if (exception == nullptr)
+        exception = exception_;
+    if (exception != nullptr)
+        std::rethrow_exception( exception );
+}
+
+//------------------------------------------------------------------------------
+/// Body of worker thread_rank: waits for each new job and runs its share.
+void PanelTeam::worker(int thread_rank)
+{
+    // Number of backoff steps to spin before sleeping. Panels arrive in
+    // quick succession when the trailing update is short.
+    const int spin_steps = 256;
+
+    // Each worker is one thread of the panel, so BLAS calls it makes
+    // must not start threads of their own, which would oversubscribe the
+    // cores. This covers OpenMP-threaded BLAS and, via its thread-local
+    // setting, MKL.
+    omp_set_num_threads( 1 );
+    #ifdef BLAS_HAVE_MKL
+        mkl_set_num_threads_local( 1 );
+    #endif
+
+    int64_t seen = 0;
+    while (true) {
+        SpinBackoff backoff;
+        for (int step = 0; step < spin_steps; ++step) {
+            if (generation_.load( std::memory_order_acquire ) != seen
+                || stop_.load( std::memory_order_relaxed ))
+                break;
+            backoff.pause();
+        }
+        if (generation_.load( std::memory_order_acquire ) == seen) {
+            std::unique_lock<std::mutex> lock( mutex_ );
+            wakeup_.wait( lock, [&] {
+                return generation_.load( std::memory_order_acquire ) != seen
+                       || stop_.load();
+            } );
+        }
+        if (stop_.load())
+            break;
+
+        seen = generation_.load( std::memory_order_acquire );
+        if (thread_rank < num_threads_) {
+            try {
+                (*body_)( thread_rank );
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock( mutex_ );
+                if (exception_ == nullptr)
+                    exception_ = std::current_exception();
+            }
+        }
+        remaining_.fetch_sub( 1, std::memory_order_release );
+    }
+}
+
+} // namespace internal
+} // namespace slate
@@ -14,11 +14,11 @@ namespace slate {
 
 const char* GridOrder_help    = "c or col; r or row";
 
-const char* MethodCholQR_help = "auto; gemmA; gemmC; herkA; herkC";
+const char* MethodCholQR_help = "auto; gemmA; gemmC; herkA; herkC; cholQR2; sCholQR3";
 
 const char* MethodGels_help   = "auto; QR; CholQR";
 
-const char* MethodGemm_help   = "auto; A or gemmA; C or gemmC";
+const char* MethodGemm_help   = "auto; A or gemmA; C or gemmC; S or Strassen";
 
 const char* MethodHemm_help   = "auto; A or hemmA; C or hemmC";
 
@@ -26,8 +26,10 @@ const char* MethodTrsm_help   = "auto; A or trsmA; B or trsmB";
 
 const char* MethodLU_help     = "auto; PPLU or PartialPiv; CALU; NoPiv; RBT; BEAM";
 
+const char* MethodHesv_help   = "auto; Aasen; RBT";
+
 const char* MethodEig_help    = "auto; QR (QR iteration); DC (divide & conquer); "
-                                "bisection; MRRR";
+                                "bisection; MRRR; QDWH (spectral divide & conquer)";
 
 const char* MethodSVD_help    = "auto; QR (QR iteration); DC (divide & conquer); "
                                 "bisection";
@@ -40,4 +42,7 @@ const char* Origin_help       = "d, dev, or devices; h or host; "
 const char* Target_help       = "d, dev, or devices; h or host; t or task; "
                                 "n or nest; b or batch";
 
+const char* TilePrecision_help = "w or working; h, half, or fp16; "
+                                 "b, bfloat16, or bf16";
+
 } // namespace slate
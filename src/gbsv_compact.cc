@@ -0,0 +1,92 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed band LU factorization and solve in compact band storage,
+/// for narrow bands.
+///
+/// Computes the solution to a system of linear equations
+/// \[
+///     A X = B,
+/// \]
+/// where $A$ is an n-by-n band matrix and $X$ and $B$ are n-by-nrhs matrices,
+/// using gbtrf( CompactBandMatrix ) and gbtrs( CompactBandMatrix ).
+///
+/// Compared to gbsv( BandMatrix ), this stores only the band instead of
+/// nb-by-nb tiles, so it is preferred when kl + ku is much less than nb.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the n-by-n band matrix $A$ to be factored.
+///     On exit, the factors $L$ and $U$ from the factorization $A = P L U$.
+///
+/// @param[out] pivots
+///     The pivot indices for the local columns; see gbtrf.
+///
+/// @param[in,out] B
+///     On entry, the n-by-nrhs right hand side matrix $B$,
+///     distributed to match A, as from A.emptyRHS( nrhs ).
+///     On exit, if return value = 0, the n-by-nrhs solution matrix $X$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently unused.
+///
+/// @return 0: successful exit
+/// @return i > 0: $U(i,i)$ is exactly zero, where $i$ is a 1-based index.
+///         The factorization has been completed, but the factor $U$ is exactly
+///         singular, so the solution could not be computed.
+///
+/// @ingroup gbsv
+///
+template <typename scalar_t>
+int64_t gbsv(
+    CompactBandMatrix<scalar_t>& A, std::vector<int64_t>& pivots,
+    Matrix<scalar_t>& B,
+    Options const& opts)
+{
+    perf::Region perf_region( "gbsv" );
+
+    int64_t info = gbtrf( A, pivots, opts );
+
+    if (info == 0) {
+        gbtrs( A, pivots, B, opts );
+    }
+    return info;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t gbsv<float>(
+    CompactBandMatrix<float>& A, std::vector<int64_t>& pivots,
+    Matrix<float>& B,
+    Options const& opts);
+
+template
+int64_t gbsv<double>(
+    CompactBandMatrix<double>& A, std::vector<int64_t>& pivots,
+    Matrix<double>& B,
+    Options const& opts);
+
+template
+int64_t gbsv< std::complex<float> >(
+    CompactBandMatrix< std::complex<float> >& A, std::vector<int64_t>& pivots,
+    Matrix< std::complex<float> >& B,
+    Options const& opts);
+
+template
+int64_t gbsv< std::complex<double> >(
+    CompactBandMatrix< std::complex<double> >& A, std::vector<int64_t>& pivots,
+    Matrix< std::complex<double> >& B,
+    Options const& opts);
+
+} // namespace slate
@@ -0,0 +1,209 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "internal/internal.hh"
+#include "internal/internal_compact_band.hh"
+#include "internal/internal_spike.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed band solve using the SPIKE algorithm, for narrow bands.
+///
+/// Computes the solution to a system of linear equations
+/// \[
+///     A X = B,
+/// \]
+/// where $A$ is an n-by-n band matrix and $X$ and $B$ are n-by-nrhs matrices.
+///
+/// Unlike gbsv, which factors along the diagonal in order, each rank
+/// independently factors its diagonal block $A_j$ with lapack::gbtrf and
+/// computes the spikes $A_j^{-1} C_j$ and $A_j^{-1} B_j$ of its couplings
+/// to the neighboring blocks. The interface rows of the spikes form a
+/// reduced system of O( (kl + ku) p ) unknowns for p ranks, which all ranks
+/// solve; each rank then recovers its part of $X$ locally. Communication is
+/// one exchange with each neighbor and one allgather of the reduced system.
+///
+/// Pivoting is only within diagonal blocks, so this requires each $A_j$ to be
+/// nonsingular, e.g., $A$ diagonally dominant, which is typical of
+/// PDE discretizations.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the n-by-n band matrix $A$.
+///     On exit, the LU factors of each rank's diagonal block $A_j$.
+///
+/// @param[in,out] B
+///     On entry, the n-by-nrhs right hand side matrix $B$,
+///     distributed to match A, as from A.emptyRHS( nrhs ).
+///     On exit, if return value = 0, the n-by-nrhs solution matrix $X$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently unused.
+///
+/// @return 0: successful exit
+/// @return i > 0: $U(i,i)$ of a diagonal block, or the reduced system
+///         at row i, is exactly zero, where $i$ is a 1-based index,
+///         so the solution could not be computed.
+///
+/// @ingroup gbsv
+///
+template <typename scalar_t>
+int64_t gbsv_spike(
+    CompactBandMatrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    Options const& opts)
+{
+    perf::Region perf_region( "gbsv_spike" );
+
+    // Constants
+    const scalar_t zero = 0.0;
+    const int tag_lower = 0;
+    const int tag_upper = 1;
+
+    internal::compact_rhs_check( A, B );
+
+    int64_t n    = A.n();
+    int64_t kl   = A.lowerBandwidth();
+    int64_t ku   = A.upperBandwidth();
+    int64_t ldab = A.stride();
+    int64_t nrhs = B.n();
+    int64_t c_begin = A.colBegin();
+    int64_t c_end   = A.colEnd();
+    int64_t nj = c_end - c_begin;
+    int rank   = A.mpiRank();
+    int nranks = A.numRanks();
+    MPI_Comm mpi_comm = A.mpiComm();
+
+    internal::SpikePartition part( n, A.nb(), kl, ku, nranks );
+    int64_t kw = part.bottom( rank - 1 );  // couples to previous block
+    int64_t kv = part.top( rank + 1 );     // couples to next block
+
+    scalar_t* AB = A.data();
+    auto elem = [&](int64_t i, int64_t j) -> scalar_t& {
+        return AB[ kl + ku + i - j + (j - c_begin)*ldab ];
+    };
+
+    // Y = [ C_j  B_j  F_j ], overwritten by A_j^{-1} Y.
+    int64_t ncols = kw + kv + nrhs;
+    std::vector<scalar_t> Y( nj*ncols, zero );
+    std::vector<int64_t> ipiv( nj );
+    int64_t info = 0;
+
+    if (nj > 0) {
+        // C_j is nonzero in its first min( kl, nj ) rows,
+        // from the previous rank's last kl columns.
+        // B_j is nonzero in its last ku rows,
+        // from the next rank's first columns.
+        int64_t c_rows = std::min( kl, nj );
+        std::vector<scalar_t> Cj( c_rows*kw ), Bj( ku*kv );
+        MPI_Request requests[ 2 ] = { MPI_REQUEST_NULL, MPI_REQUEST_NULL };
+        if (kw > 0) {
+            slate_mpi_call(
+                MPI_Irecv( Cj.data(), Cj.size(), mpi_type<scalar_t>::value,
+                           rank - 1, tag_lower, mpi_comm, &requests[ 0 ] ) );
+        }
+        if (kv > 0) {
+            slate_mpi_call(
+                MPI_Irecv( Bj.data(), Bj.size(), mpi_type<scalar_t>::value,
+                           rank + 1, tag_upper, mpi_comm, &requests[ 1 ] ) );
+        }
+
+        // Send our entries below the diagonal block to the next rank,
+        // and above it to the previous rank, then clear them,
+        // leaving only A_j.
+        if (part.bottom( rank ) > 0) {
+            int64_t m = std::min( kl, n - c_end );
+            std::vector<scalar_t> D( m*kl, zero );
+            for (int64_t c = 0; c < kl; ++c) {
+                for (int64_t r = 0; r <= std::min( c, m - 1 ); ++r) {
+                    scalar_t& a = elem( c_end + r, c_end - kl + c );
+                    D[ r + c*m ] = a;
+                    a = zero;
+                }
+            }
+            internal::compact_send_rows(
+                m*kl, 1, D.data(), m*kl, rank + 1, tag_lower, mpi_comm );
+        }
+        if (part.top( rank ) > 0) {
+            int64_t t = part.top( rank );
+            std::vector<scalar_t> D( ku*t, zero );
+            for (int64_t c = 0; c < t; ++c) {
+                for (int64_t r = c; r < ku; ++r) {
+                    scalar_t& a = elem( c_begin - ku + r, c_begin + c );
+                    D[ r + c*ku ] = a;
+                    a = zero;
+                }
+            }
+            internal::compact_send_rows(
+                ku*t, 1, D.data(), ku*t, rank - 1, tag_upper, mpi_comm );
+        }
+
+        info = lapack::gbtrf( nj, nj, kl, ku, AB, ldab, ipiv.data() );
+        if (info > 0)
+            info += c_begin;
+
+        slate_mpi_call( MPI_Waitall( 2, requests, MPI_STATUSES_IGNORE ) );
+        if (kw > 0) {
+            lapack::lacpy( lapack::MatrixType::General, c_rows, kw,
+                           Cj.data(), c_rows, &Y[ 0 ], nj );
+        }
+        if (kv > 0) {
+            lapack::lacpy( lapack::MatrixType::General, ku, kv,
+                           Bj.data(), ku, &Y[ nj - ku + kw*nj ], nj );
+        }
+        internal::compact_rhs_get( B, rank, &Y[ (kw + kv)*nj ], nj );
+    }
+
+    internal::reduce_info( &info, mpi_comm );
+    if (info != 0)
+        return info;
+
+    if (nj > 0) {
+        lapack::gbtrs( Op::NoTrans, nj, kl, ku, ncols, AB, ldab, ipiv.data(),
+                       Y.data(), nj );
+    }
+
+    std::vector<scalar_t> X( nj*nrhs );
+    info = internal::spike_reduced_solve(
+        part, kl, ku, nrhs, rank, nranks, mpi_comm, Y, X.data(), nj );
+
+    if (info == 0 && nj > 0)
+        internal::compact_rhs_set( X.data(), nj, B, rank );
+
+    return info;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t gbsv_spike<float>(
+    CompactBandMatrix<float>& A,
+    Matrix<float>& B,
+    Options const& opts);
+
+template
+int64_t gbsv_spike<double>(
+    CompactBandMatrix<double>& A,
+    Matrix<double>& B,
+    Options const& opts);
+
+template
+int64_t gbsv_spike< std::complex<float> >(
+    CompactBandMatrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& B,
+    Options const& opts);
+
+template
+int64_t gbsv_spike< std::complex<double> >(
+    CompactBandMatrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& B,
+    Options const& opts);
+
+} // namespace slate
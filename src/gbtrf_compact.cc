@@ -0,0 +1,174 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "internal/internal.hh"
+#include "internal/internal_compact_band.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed band LU factorization in compact band storage,
+/// for narrow bands.
+///
+/// Computes an LU factorization of an n-by-n band matrix $A$
+/// using partial pivoting with row interchanges, as lapack::gbtrf does.
+/// The factorization has the form
+/// \[
+///     A = P L U
+/// \]
+/// where $P$ is a permutation matrix, $L$ is lower triangular with unit
+/// diagonal elements and kl subdiagonals, and $U$ is upper triangular
+/// with kl + ku superdiagonals.
+///
+/// Ranks factor their block columns in order. Fill-in from a rank's last
+/// columns reaches the next rank's first kl + ku columns, which are
+/// exchanged as the halo, so each rank sends and receives two messages
+/// of size (2 kl + ku + 1)(kl + ku). Workspace and flops are
+/// O( n (kl + ku) kl ), instead of the O( n nb^2 ) of tiled gbtrf.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the n-by-n band matrix $A$ to be factored.
+///     On exit, the factors $L$ and $U$ from the factorization $A = P L U$;
+///     the unit diagonal elements of $L$ are not stored.
+///     $U$ uses the kl rows of fill-in above the band.
+///
+/// @param[out] pivots
+///     On exit, for each local column k in [ A.colBegin(), A.colEnd() ),
+///     row k was interchanged with row pivots[ k - A.colBegin() ],
+///     as 0-based global indices.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently unused.
+///
+/// @return 0: successful exit
+/// @return i > 0: $U(i,i)$ is exactly zero, where $i$ is a 1-based index.
+///         The factorization has been completed, but the factor $U$ is exactly
+///         singular, and division by zero will occur if it is used
+///         to solve a system of equations.
+///
+/// @ingroup gbsv_computational
+///
+template <typename scalar_t>
+int64_t gbtrf(
+    CompactBandMatrix<scalar_t>& A, std::vector<int64_t>& pivots,
+    Options const& opts)
+{
+    perf::Region perf_region( "gbtrf" );
+
+    // Constants
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+    const int tag_halo   = 0;
+    const int tag_update = 1;
+
+    int64_t n    = A.n();
+    int64_t kl   = A.lowerBandwidth();
+    int64_t kv   = kl + A.upperBandwidth();
+    int64_t ldab = A.stride();
+    int64_t c_begin = A.colBegin();
+    int64_t c_end   = A.colEnd();
+    int64_t h_end   = A.haloEnd();
+    int rank   = A.mpiRank();
+    int nranks = A.numRanks();
+    MPI_Comm mpi_comm = A.mpiComm();
+
+    pivots.resize( c_end - c_begin );
+
+    int64_t info = 0;
+    if (c_begin < c_end) {
+        scalar_t* AB = A.data();
+
+        // Get the next rank's first columns, before the previous rank
+        // updates ours, since the messages overlap.
+        MPI_Request halo_request = MPI_REQUEST_NULL;
+        if (rank + 1 < nranks) {
+            slate_mpi_call(
+                MPI_Irecv( &AB[ (c_end - c_begin)*ldab ],
+                           (h_end - c_end)*ldab, mpi_type<scalar_t>::value,
+                           rank + 1, tag_halo, mpi_comm, &halo_request ) );
+        }
+        int64_t prev_halo = std::min( c_begin + kv, n ) - c_begin;
+        if (rank > 0) {
+            slate_mpi_call(
+                MPI_Send( AB, prev_halo*ldab, mpi_type<scalar_t>::value,
+                          rank - 1, tag_halo, mpi_comm ) );
+
+            // Our first columns, updated by the previous rank.
+            internal::compact_recv_rows(
+                prev_halo*ldab, 1, AB, prev_halo*ldab,
+                rank - 1, tag_update, mpi_comm, false );
+        }
+        slate_mpi_call( MPI_Wait( &halo_request, MPI_STATUS_IGNORE ) );
+
+        // Unblocked band LU, as in lapack::gbtf2, with the last column
+        // of U fill bounded by k + kl + ku.
+        // Rows of the band have stride ldab - 1.
+        for (int64_t k = c_begin; k < c_end; ++k) {
+            scalar_t* Akk = &AB[ kv + (k - c_begin)*ldab ];
+            int64_t km = std::min( kl, n - 1 - k );
+            int64_t jp = blas::iamax( km + 1, Akk, 1 );
+            pivots[ k - c_begin ] = k + jp;
+
+            if (Akk[ jp ] != zero) {
+                int64_t ju = std::min( k + kv, n - 1 );
+                if (jp != 0) {
+                    blas::swap( ju - k + 1, &Akk[ jp ], ldab - 1,
+                                Akk, ldab - 1 );
+                }
+                if (km > 0) {
+                    blas::scal( km, one / Akk[ 0 ], &Akk[ 1 ], 1 );
+                    if (ju > k) {
+                        blas::geru( Layout::ColMajor, km, ju - k,
+                                    -one, &Akk[ 1 ], 1,
+                                          &Akk[ ldab - 1 ], ldab - 1,
+                                          &Akk[ ldab ], ldab - 1 );
+                    }
+                }
+            }
+            else if (info == 0) {
+                info = k + 1;
+            }
+        }
+
+        // Pass the updated halo to the next rank.
+        if (rank + 1 < nranks) {
+            internal::compact_send_rows(
+                (h_end - c_end)*ldab, 1, &AB[ (c_end - c_begin)*ldab ],
+                (h_end - c_end)*ldab, rank + 1, tag_update, mpi_comm );
+        }
+    }
+
+    internal::reduce_info( &info, mpi_comm );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t gbtrf<float>(
+    CompactBandMatrix<float>& A, std::vector<int64_t>& pivots,
+    Options const& opts);
+
+template
+int64_t gbtrf<double>(
+    CompactBandMatrix<double>& A, std::vector<int64_t>& pivots,
+    Options const& opts);
+
+template
+int64_t gbtrf< std::complex<float> >(
+    CompactBandMatrix< std::complex<float> >& A, std::vector<int64_t>& pivots,
+    Options const& opts);
+
+template
+int64_t gbtrf< std::complex<double> >(
+    CompactBandMatrix< std::complex<double> >& A, std::vector<int64_t>& pivots,
+    Options const& opts);
+
+} // namespace slate
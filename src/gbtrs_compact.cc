@@ -0,0 +1,200 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "internal/internal.hh"
+#include "internal/internal_compact_band.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed band LU solve in compact band storage, for narrow bands.
+///
+/// Solves a system of linear equations
+/// \[
+///     A X = B
+/// \]
+/// with an n-by-n band matrix $A$ using the LU factorization computed
+/// by gbtrf( CompactBandMatrix ).
+///
+/// The forward solve with $P L$ runs over ranks in order, passing kl rows
+/// to the next rank; the backward solve with $U$ runs in reverse order,
+/// passing kl + ku rows of updates to the previous rank.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     The factors $L$ and $U$ from the factorization $A = P L U$
+///     computed by gbtrf.
+///
+/// @param[in] pivots
+///     The pivot indices from gbtrf.
+///
+/// @param[in,out] B
+///     On entry, the n-by-nrhs right hand side matrix $B$,
+///     distributed to match A, as from A.emptyRHS( nrhs ).
+///     On exit, the n-by-nrhs solution matrix $X$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently unused.
+///
+/// @ingroup gbsv_computational
+///
+template <typename scalar_t>
+void gbtrs(
+    CompactBandMatrix<scalar_t>& A, std::vector<int64_t>& pivots,
+    Matrix<scalar_t>& B,
+    Options const& opts)
+{
+    perf::Region perf_region( "gbtrs" );
+
+    // Constants
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+    const int tag_halo   = 0;
+    const int tag_update = 1;
+
+    internal::compact_rhs_check( A, B );
+
+    int64_t n    = A.n();
+    int64_t kl   = A.lowerBandwidth();
+    int64_t kv   = kl + A.upperBandwidth();
+    int64_t ldab = A.stride();
+    int64_t nrhs = B.n();
+    int64_t c_begin = A.colBegin();
+    int64_t c_end   = A.colEnd();
+    int rank   = A.mpiRank();
+    int nranks = A.numRanks();
+    MPI_Comm mpi_comm = A.mpiComm();
+
+    if (c_begin == c_end)
+        return;
+
+    scalar_t const* AB = A.data();
+
+    // Local rows [r_begin, r_end) of B: kl + ku rows of the previous rank
+    // updated by the backward solve, our rows, and kl rows of the next
+    // rank updated by the forward solve.
+    int64_t r_begin = std::max( c_begin - kv, int64_t( 0 ) );
+    int64_t r_end   = std::min( c_end + kl, n );
+    int64_t ldx = r_end - r_begin;
+    std::vector<scalar_t> X( ldx*nrhs, zero );
+    auto Xrow = [&](int64_t i) { return &X[ i - r_begin ]; };
+
+    internal::compact_rhs_get( B, rank, Xrow( c_begin ), ldx );
+
+    //----------------------------------------
+    // Forward solve with P L.
+    // Get the next rank's first rows, before the previous rank
+    // updates ours, as in gbtrf.
+    int64_t prev_halo = std::min( c_begin + kl, n ) - c_begin;
+    if (rank + 1 < nranks && r_end > c_end) {
+        // Posted before sending, so ranks don't wait on each other.
+        std::vector<scalar_t> buffer( (r_end - c_end)*nrhs );
+        MPI_Request request;
+        slate_mpi_call(
+            MPI_Irecv( buffer.data(), buffer.size(), mpi_type<scalar_t>::value,
+                       rank + 1, tag_halo, mpi_comm, &request ) );
+        if (rank > 0 && prev_halo > 0) {
+            internal::compact_send_rows(
+                prev_halo, nrhs, Xrow( c_begin ), ldx,
+                rank - 1, tag_halo, mpi_comm );
+        }
+        slate_mpi_call( MPI_Wait( &request, MPI_STATUS_IGNORE ) );
+        lapack::lacpy( lapack::MatrixType::General, r_end - c_end, nrhs,
+                       buffer.data(), r_end - c_end, Xrow( c_end ), ldx );
+    }
+    else if (rank > 0 && prev_halo > 0) {
+        internal::compact_send_rows(
+            prev_halo, nrhs, Xrow( c_begin ), ldx,
+            rank - 1, tag_halo, mpi_comm );
+    }
+    if (rank > 0 && prev_halo > 0) {
+        internal::compact_recv_rows(
+            prev_halo, nrhs, Xrow( c_begin ), ldx,
+            rank - 1, tag_update, mpi_comm, false );
+    }
+
+    for (int64_t j = c_begin; j < c_end; ++j) {
+        scalar_t const* Ajj = &AB[ kv + (j - c_begin)*ldab ];
+        int64_t lm = std::min( kl, n - 1 - j );
+        int64_t l = pivots[ j - c_begin ];
+        if (l != j)
+            blas::swap( nrhs, Xrow( l ), ldx, Xrow( j ), ldx );
+        if (lm > 0) {
+            blas::geru( Layout::ColMajor, lm, nrhs,
+                        -one, &Ajj[ 1 ], 1, Xrow( j ), ldx,
+                              Xrow( j + 1 ), ldx );
+        }
+    }
+
+    if (rank + 1 < nranks && r_end > c_end) {
+        internal::compact_send_rows(
+            r_end - c_end, nrhs, Xrow( c_end ), ldx,
+            rank + 1, tag_update, mpi_comm );
+    }
+
+    //----------------------------------------
+    // Backward solve with U, which has kl + ku superdiagonals.
+    // Updates to the previous rank's rows are accumulated from zero
+    // and added there.
+    if (rank + 1 < nranks) {
+        int64_t next_halo = c_end - std::max( c_end - kv, c_begin );
+        internal::compact_recv_rows(
+            next_halo, nrhs, Xrow( c_end - next_halo ), ldx,
+            rank + 1, tag_update, mpi_comm, true );
+    }
+    lapack::laset( lapack::MatrixType::General, c_begin - r_begin, nrhs,
+                   zero, zero, Xrow( r_begin ), ldx );
+
+    for (int64_t j = c_end - 1; j >= c_begin; --j) {
+        scalar_t const* Ajj = &AB[ kv + (j - c_begin)*ldab ];
+        blas::scal( nrhs, one / Ajj[ 0 ], Xrow( j ), ldx );
+        int64_t kd = std::min( kv, j );
+        if (kd > 0) {
+            blas::geru( Layout::ColMajor, kd, nrhs,
+                        -one, &Ajj[ -kd ], 1, Xrow( j ), ldx,
+                              Xrow( j - kd ), ldx );
+        }
+    }
+
+    if (rank > 0) {
+        internal::compact_send_rows(
+            c_begin - r_begin, nrhs, Xrow( r_begin ), ldx,
+            rank - 1, tag_update, mpi_comm );
+    }
+
+    internal::compact_rhs_set( Xrow( c_begin ), ldx, B, rank );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void gbtrs<float>(
+    CompactBandMatrix<float>& A, std::vector<int64_t>& pivots,
+    Matrix<float>& B,
+    Options const& opts);
+
+template
+void gbtrs<double>(
+    CompactBandMatrix<double>& A, std::vector<int64_t>& pivots,
+    Matrix<double>& B,
+    Options const& opts);
+
+template
+void gbtrs< std::complex<float> >(
+    CompactBandMatrix< std::complex<float> >& A, std::vector<int64_t>& pivots,
+    Matrix< std::complex<float> >& B,
+    Options const& opts);
+
+template
+void gbtrs< std::complex<double> >(
+    CompactBandMatrix< std::complex<double> >& A, std::vector<int64_t>& pivots,
+    Matrix< std::complex<double> >& B,
+    Options const& opts);
+
+} // namespace slate
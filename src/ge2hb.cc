@@ -0,0 +1,449 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "internal/internal.hh"
+#include "internal/internal_util.hh"
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel reduction to band Hessenberg form.
+/// Generic implementation for any target.
+/// Panel computed on host using Host OpenMP task.
+///
+/// ColMajor layout is assumed
+///
+/// @ingroup geev_impl
+///
+template <Target target, typename scalar_t>
+void ge2hb(
+    Matrix<scalar_t>& A,
+    TriangularFactors<scalar_t>& T,
+    Options const& opts )
+{
+    using BcastList = typename Matrix<scalar_t>::BcastList;
+    using lapack::device_info_int;
+
+    // Constants
+    const int priority_0 = 0;
+    const int priority_1 = 1;
+    const int queue_1 = 1;
+    const int queue_2 = 2;
+    const int queue_3 = 3;
+    // Assumes column major
+    const Layout layout = Layout::ColMajor;
+
+    // Options
+    int64_t ib = get_option<int64_t>( opts, Option::InnerBlocking, 16 );
+    int64_t max_panel_threads = std::max( omp_get_max_threads()/2, 1 );
+    max_panel_threads = get_option<int64_t>( opts, Option::MaxPanelThreads,
+                                             max_panel_threads );
+
+    int64_t A_mt = A.mt();
+    int64_t A_nt = A.nt();
+
+    // Q is applied from the right directly to the trailing columns, which
+    // requires the columns of A to be distributed like its rows, as in
+    // he2hb. For block cyclic, that is a square p-by-p grid.
+    GridOrder grid_order;
+    int nprow, npcol, myrow, mycol;
+    A.gridinfo( &grid_order, &nprow, &npcol, &myrow, &mycol );
+    slate_error_if( grid_order == GridOrder::Unknown );
+    slate_error_if( nprow != npcol );
+
+    T.clear();
+    T.push_back( A.emptyLike() );
+    T.push_back( A.emptyLike( ib, 0 ) );
+    auto Tlocal  = T[ 0 ];
+    auto Treduce = T[ 1 ];
+
+    // workspace
+    auto W = A.emptyLike();
+
+    // setting up dummy variables for case the when target == host
+    int64_t num_devices  = A.num_devices();
+    int     panel_device = -1;
+    size_t  work_size    = 0;
+
+    std::vector< scalar_t* > dwork_array( num_devices, nullptr );
+
+    if (target == Target::Devices) {
+        const int64_t batch_size_default = 0; // use default batch size
+        const int num_queues = 4;
+        A.allocateBatchArrays( batch_size_default, num_queues );
+        A.reserveDeviceWorkspace();
+        W.allocateBatchArrays( batch_size_default, num_queues );
+
+        // Find largest panel size and device for copying to
+        // contiguous memory within internal geqrf routine
+        int64_t mlocal = 0;
+        int64_t first_panel_seen = -1;
+        for (int64_t j = 0; j < A_nt; ++j) {
+            for (int64_t i = j+1; i < A_mt; ++i) {
+                if (A.tileIsLocal( i, j )) {
+                    if (first_panel_seen < 0) {
+                        first_panel_seen = j;
+                    }
+                    if (first_panel_seen == j) {
+                        if (panel_device < 0) {
+                            panel_device = A.tileDevice( i, j );
+                        }
+                        mlocal += A.tileMb( i );
+                    }
+                }
+            }
+            if (first_panel_seen >= 0) {
+                break;
+            }
+        }
+
+        if (panel_device >= 0) {
+
+            lapack::Queue* comm_queue = A.comm_queue( panel_device );
+
+            int64_t nb       = A.tileNb( 0 );
+            size_t  size_tau = (size_t) std::min( mlocal, nb );
+            size_t  size_A   = (size_t) blas::max( 1, mlocal ) * nb;
+            size_t  hsize, dsize;
+
+            // Find size of the workspace needed
+            lapack::geqrf_work_size_bytes( mlocal, nb, dwork_array[0], mlocal,
+                                           &dsize, &hsize, *comm_queue );
+
+            // Size of dA, dtau, dwork and dinfo
+            work_size = size_A + size_tau + ceildiv( dsize, sizeof(scalar_t) )
+                        + ceildiv( sizeof(device_info_int), sizeof(scalar_t) );
+
+            for (int64_t dev = 0; dev < num_devices; ++dev) {
+                lapack::Queue* queue = A.comm_queue( dev );
+                dwork_array[dev] = blas::device_malloc<scalar_t>( work_size, *queue );
+            }
+        }
+    }
+
+    // tracks dependencies by block-column.
+    // OpenMP needs pointer types, but vectors are exception safe
+    std::vector< uint8_t > block_vector( A_nt );
+    uint8_t* block = block_vector.data();
+    SLATE_UNUSED( block ); // Used only by OpenMP
+
+    // set min number for omp nested active parallel regions
+    slate::OmpSetMaxActiveLevels set_active_levels( MinOmpActiveLevels );
+
+    // Persistent team of threads for the host panels, created once
+    // instead of a nested parallel region per panel.
+    internal::PanelTeam panel_team(
+        target == Target::Devices ? 1 : max_panel_threads );
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        for (int64_t k = 0; k < A_nt-1; ++k) {
+            auto  A_panel =       A.sub( k+1, A_mt-1, k, k );
+            auto Tl_panel =  Tlocal.sub( k+1, A_mt-1, k, k );
+            auto Tr_panel = Treduce.sub( k+1, A_mt-1, k, k );
+
+            // Find each rank's first (top-most) row in this panel,
+            // where the triangular tile resulting from local geqrf panel
+            // will reside.
+            std::vector< int64_t > first_indices
+                          = internal::geqrf_compute_first_indices( A_panel, k+1 );
+
+            // panel, high priority
+            #pragma omp task depend( inout:block[ k ] ) priority( 1 )
+            {
+                // local panel factorization
+                internal::geqrf<target>(
+                    std::move( A_panel ),
+                    std::move( Tl_panel ),
+                    dwork_array, work_size,
+                    ib, max_panel_threads, priority_1,
+                    &panel_team );
+
+                // triangle-triangle reductions
+                // ttqrt handles tile transfers internally
+                internal::ttqrt<Target::HostTask>(
+                    std::move( A_panel ),
+                    std::move( Tr_panel ) );
+
+                // Send V(i) across row A(i, k+1:nt-1) for the left update,
+                // and down col A(0:mt-1, i) for the right update.
+                BcastList bcast_list_V;
+                for (int64_t i = k+1; i < A_mt; ++i) {
+                    bcast_list_V.push_back(
+                        { i, k, { A.sub( i, i, k+1, A_nt-1 ),
+                                  A.sub( 0, A_mt-1, i, i ) } } );
+                }
+                A.template listBcast<target>( bcast_list_V, layout );
+
+                // Send Tlocal(i) across row i and down col i.
+                BcastList bcast_list_T;
+                for (int64_t row : first_indices) {
+                    bcast_list_T.push_back(
+                        { row, k, { Tlocal.sub( row, row, k+1, A_nt-1 ),
+                                    Tlocal.sub( 0, A_mt-1, row, row ) } } );
+                }
+                Tlocal.template listBcast<target>( bcast_list_T, layout );
+
+                // Send Treduce(i) across row i and down col i.
+                if (first_indices.size() > 1) {
+                    bcast_list_T.clear();
+                    for (int64_t row : first_indices) {
+                        // Exclude first row of this panel,
+                        // which doesn't have Treduce tile.
+                        if (row > k+1) {
+                            bcast_list_T.push_back(
+                                { row, k, { Treduce.sub( row, row, k+1, A_nt-1 ),
+                                            Treduce.sub( 0, A_mt-1, row, row ) } } );
+                        }
+                    }
+                    Treduce.template listBcast<>( bcast_list_T, layout );
+                }
+            }
+
+            // Update from right all rows of the trailing columns,
+            // A(0:mt-1, k+1:nt-1) = A(0:mt-1, k+1:nt-1) Q_k.
+            // Each column depends on all the others, so this can't be
+            // split up for lookahead.
+            #pragma omp task depend( in:block[ k ] ) \
+                             depend( inout:block[ k+1 ] ) \
+                             depend( inout:block[ A_nt-1 ] )
+            {
+                // Apply local reflectors, then triangle-triangle reduction
+                // reflectors: C Q = C Q_local Q_reduce.
+                auto A_right = A.sub( 0, A_mt-1, k+1, A_nt-1 );
+                internal::unmqr<target>(
+                    Side::Right, Op::NoTrans,
+                    std::move( A_panel ),
+                    std::move( Tl_panel ),
+                    std::move( A_right ),
+                    W.sub( 0, A_mt-1, k+1, A_nt-1 ),
+                    priority_0, queue_1 );
+
+                // Tags A_nt, ..., A_nt + A_mt - 1 by row, distinct from
+                // the tags of the left updates.
+                int tag_right = A_nt;
+                internal::ttmqr<Target::HostTask>(
+                    Side::Right, Op::NoTrans,
+                    std::move( A_panel ),
+                    std::move( Tr_panel ),
+                    std::move( A_right ),
+                    tag_right );
+            }
+
+            // Update from left the lookahead column, high priority,
+            // A(k+1:mt-1, k+1) = Q_k^H A(k+1:mt-1, k+1),
+            // so the next panel can overlap the rest of the left update.
+            #pragma omp task depend( in:block[ k ] ) \
+                             depend( inout:block[ k+1 ] ) \
+                             priority( 1 )
+            {
+                // Apply local reflectors, then triangle-triangle reduction
+                // reflectors: Q^H C = Q_reduce^H Q_local^H C.
+                auto A_trail_j = A.sub( k+1, A_mt-1, k+1, k+1 );
+                internal::unmqr<target>(
+                    Side::Left, Op::ConjTrans,
+                    std::move( A_panel ),
+                    std::move( Tl_panel ),
+                    std::move( A_trail_j ),
+                    W.sub( k+1, A_mt-1, k+1, k+1 ),
+                    priority_1, queue_2 );
+
+                int tag_j = k+1;
+                internal::ttmqr<Target::HostTask>(
+                    Side::Left, Op::ConjTrans,
+                    std::move( A_panel ),
+                    std::move( Tr_panel ),
+                    std::move( A_trail_j ),
+                    tag_j );
+            }
+
+            // Update from left the rest of the trailing matrix,
+            // A(k+1:mt-1, k+2:nt-1) = Q_k^H A(k+1:mt-1, k+2:nt-1).
+            if (k+2 < A_nt) {
+                #pragma omp task depend( in:block[ k ] ) \
+                                 depend( inout:block[ k+2 ] ) \
+                                 depend( inout:block[ A_nt-1 ] )
+                {
+                    auto A_trail_j = A.sub( k+1, A_mt-1, k+2, A_nt-1 );
+                    internal::unmqr<target>(
+                        Side::Left, Op::ConjTrans,
+                        std::move( A_panel ),
+                        std::move( Tl_panel ),
+                        std::move( A_trail_j ),
+                        W.sub( k+1, A_mt-1, k+2, A_nt-1 ),
+                        priority_0, queue_3 );
+
+                    int tag_j = k+2;
+                    internal::ttmqr<Target::HostTask>(
+                        Side::Left, Op::ConjTrans,
+                        std::move( A_panel ),
+                        std::move( Tr_panel ),
+                        std::move( A_trail_j ),
+                        tag_j );
+                }
+            }
+
+            #pragma omp task depend( inout:block[ k ] )
+            {
+                // Release the whole column, not just the panel
+                for (int64_t i = 0; i < A_mt; ++i) {
+                    if (A.tileIsLocal( i, k )) {
+                        A.tileUpdateOrigin( i, k );
+                        A.releaseLocalWorkspaceTile( i, k );
+                    }
+                    else {
+                        A.releaseRemoteWorkspaceTile( i, k );
+                    }
+                }
+
+                for (int64_t i : first_indices) {
+                    if (Tlocal.tileIsLocal( i, k )) {
+                        // Tlocal and Treduce have the same process distribution
+                        Tlocal.tileUpdateOrigin( i, k );
+                        Tlocal.releaseLocalWorkspaceTile( i, k );
+                        if (i != k+1) {
+                            // i == k+1 is the root of the reduction tree
+                            // Treduce( k+1, k ) isn't allocated
+                            Treduce.tileUpdateOrigin( i, k );
+                            Treduce.releaseLocalWorkspaceTile( i, k );
+                        }
+                    }
+                    else {
+                        Tlocal.releaseRemoteWorkspaceTile( i, k );
+                        Treduce.releaseRemoteWorkspaceTile( i, k );
+                    }
+                }
+            }
+        }
+
+        #pragma omp taskwait
+        A.tileUpdateAllOrigin();
+    }
+
+    A.releaseWorkspace();
+    W.releaseWorkspace();
+
+    if (target == Target::Devices) {
+        for (int64_t dev = 0; dev < num_devices; ++dev) {
+            blas::Queue* queue = A.comm_queue( dev );
+            blas::device_free( dwork_array[dev], *queue );
+            dwork_array[dev] = nullptr;
+        }
+    }
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel reduction of a general matrix to upper
+/// block Hessenberg (band Hessenberg) form, the first stage of the
+/// nonsymmetric eigenvalue decomposition,
+/// \[
+///     A = Q H Q^H,
+/// \]
+/// where $Q$ is unitary and $H$ is upper Hessenberg with nb subdiagonals.
+///
+/// As in he2hb, the block column k is reduced by a QR factorization of
+/// the panel below its diagonal tile, $A_{k+1:mt-1, k} = Q_k R_k$, but
+/// since A is not Hermitian, $Q_k$ is applied separately from the left
+/// to the trailing matrix, $A_{k+1:mt-1, k+1:nt-1}$, and from the right
+/// to all rows of the trailing columns, $A_{0:mt-1, k+1:nt-1}$.
+/// The left update of column k+1 is done first, so the next panel
+/// overlaps the rest of the left update.
+///
+/// Complexity (in real): $\approx \frac{10}{3} n^{3}$ flops.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the n-by-n general matrix $A$.
+///     On exit, the upper triangle and the first nb subdiagonals contain
+///     the band Hessenberg matrix $H$. The tiles below hold the
+///     Householder vectors that, with T, represent $Q$,
+///     as for geqrf of each panel.
+///     Tiles must be square (mb = nb), and A must be distributed on a
+///     square p-by-p process grid, so its columns are distributed like
+///     its rows.
+///
+/// @param[out] T
+///     On exit, triangular matrices of the block reflectors for Q.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::InnerBlocking:
+///       Inner blocking to use for panel. Default 16.
+///     - Option::MaxPanelThreads:
+///       Number of threads to use for panel. Default omp_get_max_threads()/2.
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  not implemented.
+///       - HostBatch: not implemented.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// @ingroup geev_computational
+///
+template <typename scalar_t>
+void ge2hb(
+    Matrix<scalar_t>& A,
+    TriangularFactors<scalar_t>& T,
+    Options const& opts )
+{
+    perf::Region perf_region( "ge2hb" );
+
+    slate_error_if( A.m() != A.n() );
+
+    Target target = get_option( opts, Option::Target, Target::HostTask );
+
+    // HostNest and HostBatch not implemented; use HostTask.
+    switch (target) {
+        case Target::Host:
+        case Target::HostTask:
+        case Target::HostNest:
+        case Target::HostBatch:
+            impl::ge2hb<Target::HostTask>( A, T, opts );
+            break;
+
+        case Target::Devices:
+            impl::ge2hb<Target::Devices>( A, T, opts );
+            break;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void ge2hb<float>(
+    Matrix<float>& A,
+    TriangularFactors<float>& T,
+    Options const& opts);
+
+template
+void ge2hb<double>(
+    Matrix<double>& A,
+    TriangularFactors<double>& T,
+    Options const& opts);
+
+template
+void ge2hb< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    TriangularFactors< std::complex<float> >& T,
+    Options const& opts);
+
+template
+void ge2hb< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    TriangularFactors< std::complex<double> >& T,
+    Options const& opts);
+
+} // namespace slate
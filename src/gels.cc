@@ -99,6 +99,8 @@ void gels(
     Matrix<scalar_t>& BX,
     Options const& opts)
 {
+    perf::Region perf_region( "gels" );
+
     MethodGels method = get_option( opts, Option::MethodGels, MethodGels::Auto );
 
     if (method == MethodGels::Auto)
@@ -69,6 +69,12 @@ MethodGemm select_algo( TA& A, TB& B, Options& opts )
 ///           - Auto: let the routine decides [default]
 ///           - gemmA: select gemmA routine
 ///           - gemmC: select gemmC routine
+///           - Strassen: select gemm_strassen routine, which saves flops
+///             for large square multiplies, but is less accurate;
+///             see gemm_strassen for its error bound. Never chosen by Auto.
+///         - Option::Depth:
+///           Number of levels of Strassen recursion, for MethodGemm::Strassen.
+///           Default 1.
 ///         - Option::Target:
 ///           Implementation to target. Possible values:
 ///           - HostTask:  OpenMP tasks on CPU host [default].
@@ -84,6 +90,8 @@ void gemm(scalar_t alpha, Matrix<scalar_t>& A,
           scalar_t beta,  Matrix<scalar_t>& C,
           Options const& opts)
 {
+    perf::Region perf_region( "gemm" );
+
     MethodGemm method = get_option(
         opts, Option::MethodGemm, MethodGemm::Auto );
 
@@ -101,6 +109,9 @@ void gemm(scalar_t alpha, Matrix<scalar_t>& A,
         case MethodGemm::C:
             gemmC( alpha, A, B, beta, C, tuned_opts );
             break;
+        case MethodGemm::Strassen:
+            gemm_strassen( alpha, A, B, beta, C, tuned_opts );
+            break;
     }
 }
 
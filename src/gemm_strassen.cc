@@ -0,0 +1,299 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "internal/internal.hh"
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// @internal
+/// @return true if A can be split into 2x2 quadrants at tile row mt/2 and
+/// tile column nt/2, such that the quadrants have the same tile sizes and
+/// each tile of a quadrant has the same rank and device as the
+/// corresponding tiles of the other quadrants. Then quadrants can be added
+/// by slate::add and copied by slate::copy without communication. For 2D
+/// block-cyclic distributions on a p-by-q grid, this holds if mt/2 is a
+/// multiple of p and nt/2 is a multiple of q, and the tiles are uniform.
+/// @ingroup gemm_impl
+///
+template <typename scalar_t>
+bool strassen_splittable( Matrix<scalar_t>& A )
+{
+    int64_t mt = A.mt();
+    int64_t nt = A.nt();
+    if (A.op() != Op::NoTrans || mt < 2 || nt < 2 || mt % 2 != 0 || nt % 2 != 0)
+        return false;
+
+    int64_t mh = mt / 2;
+    int64_t nh = nt / 2;
+    for (int64_t i = 0; i < mh; ++i) {
+        if (A.tileMb( i ) != A.tileMb( i + mh ))
+            return false;
+    }
+    for (int64_t j = 0; j < nh; ++j) {
+        if (A.tileNb( j ) != A.tileNb( j + nh ))
+            return false;
+    }
+    for (int64_t j = 0; j < nh; ++j) {
+        for (int64_t i = 0; i < mh; ++i) {
+            int rank = A.tileRank( i, j );
+            int device = A.tileDevice( i, j );
+            if (A.tileRank( i + mh, j      ) != rank
+                || A.tileRank( i,      j + nh ) != rank
+                || A.tileRank( i + mh, j + nh ) != rank
+                || A.tileDevice( i + mh, j      ) != device
+                || A.tileDevice( i,      j + nh ) != device
+                || A.tileDevice( i + mh, j + nh ) != device)
+                return false;
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+/// @internal
+/// Distributed parallel general matrix-matrix multiplication using
+/// levels of Strassen-Winograd recursion over 2x2 blocks of tiles.
+/// Each level computes the product of the quadrants with 7 products of
+/// quadrants instead of 8, plus additions of quadrants, which are done by
+/// slate::add and slate::copy. The products recurse with levels - 1; the
+/// last level, or any level where A, B, or C cannot be split
+/// (see strassen_splittable), calls gemmC.
+///
+/// With quadrants $A_{ij}$, $B_{ij}$, and $C_{ij}$, Winograd's variant
+/// computes
+///
+///     S1 = A21 + A22,  T1 = B12 - B11,  P1 = A11 B11,  P5 = S1 T1,
+///     S2 = S1  - A11,  T2 = B22 - T1,   P2 = A12 B21,  P6 = S2 T2,
+///     S3 = A11 - A21,  T3 = B22 - B12,  P3 = S4  B22,  P7 = S3 T3,
+///     S4 = A12 - S2,   T4 = T2  - B21,  P4 = A22 T4,
+///
+///     U2 = P1 + P6,  U3 = U2 + P7,
+///     C11 = P1 + P2,  C12 = U2 + P5 + P3,  C21 = U3 - P4,  C22 = U3 + P5,
+///
+/// scaled by alpha and added to beta C. To use workspace of only two
+/// quadrants of C, one of A, and one of B, T2 is computed twice, and S3
+/// and T3 are computed last.
+/// @ingroup gemm_impl
+///
+template <typename scalar_t>
+void gemm_strassen(
+    scalar_t alpha, Matrix<scalar_t>& A,
+                    Matrix<scalar_t>& B,
+    scalar_t beta,  Matrix<scalar_t>& C,
+    int64_t levels, Options const& opts )
+{
+    // Constants
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    if (levels <= 0
+        || ! strassen_splittable( A )
+        || ! strassen_splittable( B )
+        || ! strassen_splittable( C ))
+    {
+        gemmC( alpha, A, B, beta, C, opts );
+        return;
+    }
+
+    Target target = get_option( opts, Option::Target, Target::HostTask );
+
+    // Workspace below is not initialized, and tile::add computes beta C
+    // even for beta = 0, so zero C first.
+    if (beta == zero)
+        set( zero, C, opts );
+
+    int64_t mh = C.mt() / 2;
+    int64_t nh = C.nt() / 2;
+    int64_t kh = A.nt() / 2;
+
+    auto A11 = A.sub( 0,  mh-1,   0,  kh-1   );
+    auto A12 = A.sub( 0,  mh-1,   kh, 2*kh-1 );
+    auto A21 = A.sub( mh, 2*mh-1, 0,  kh-1   );
+    auto A22 = A.sub( mh, 2*mh-1, kh, 2*kh-1 );
+
+    auto B11 = B.sub( 0,  kh-1,   0,  nh-1   );
+    auto B12 = B.sub( 0,  kh-1,   nh, 2*nh-1 );
+    auto B21 = B.sub( kh, 2*kh-1, 0,  nh-1   );
+    auto B22 = B.sub( kh, 2*kh-1, nh, 2*nh-1 );
+
+    auto C11 = C.sub( 0,  mh-1,   0,  nh-1   );
+    auto C12 = C.sub( 0,  mh-1,   nh, 2*nh-1 );
+    auto C21 = C.sub( mh, 2*mh-1, 0,  nh-1   );
+    auto C22 = C.sub( mh, 2*mh-1, nh, 2*nh-1 );
+
+    // Workspace, distributed as the quadrants.
+    auto S = A11.emptyLike();
+    auto T = B11.emptyLike();
+    auto W = C11.emptyLike();
+    auto P5 = C11.emptyLike();
+    S.insertLocalTiles( target );
+    T.insertLocalTiles( target );
+    W.insertLocalTiles( target );
+    P5.insertLocalTiles( target );
+
+    // W = P1
+    gemm_strassen( alpha, A11, B11, zero, W, levels-1, opts );
+
+    // C11 = beta C11 + P2 + P1
+    gemm_strassen( alpha, A12, B21, beta, C11, levels-1, opts );
+    add( one, W, one, C11, opts );
+
+    // S = S1, T = T1, P5 = S1 T1
+    slate::copy( A21, S, opts );
+    add( one, A22, one, S, opts );
+    slate::copy( B12, T, opts );
+    add( -one, B11, one, T, opts );
+    gemm_strassen( alpha, S, T, zero, P5, levels-1, opts );
+
+    // S = S2, T = T2, W = U2 = P1 + P6
+    add( -one, A11, one, S, opts );
+    add( one, B22, -one, T, opts );
+    gemm_strassen( alpha, S, T, one, W, levels-1, opts );
+
+    // S = S4, C12 = beta C12 + U2 + P5 + P3
+    add( one, A12, -one, S, opts );
+    add( one, W, beta, C12, opts );
+    add( one, P5, one, C12, opts );
+    gemm_strassen( alpha, S, B22, one, C12, levels-1, opts );
+
+    // S = S3, T = T3, W = U3 = U2 + P7
+    slate::copy( A11, S, opts );
+    add( -one, A21, one, S, opts );
+    slate::copy( B22, T, opts );
+    add( -one, B12, one, T, opts );
+    gemm_strassen( alpha, S, T, one, W, levels-1, opts );
+
+    // C22 = beta C22 + U3 + P5
+    add( one, W, beta, C22, opts );
+    add( one, P5, one, C22, opts );
+
+    // T = T2 = T3 + B11, T = T4, C21 = beta C21 + U3 - P4
+    add( one, B11, one, T, opts );
+    add( -one, B21, one, T, opts );
+    add( one, W, beta, C21, opts );
+    gemm_strassen( -alpha, A22, T, one, C21, levels-1, opts );
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel general matrix-matrix multiplication using
+/// Strassen-Winograd recursion over 2x2 blocks of tiles.
+/// Performs the matrix-matrix operation
+/// \[
+///     C = \alpha A B + \beta C,
+/// \]
+/// where alpha and beta are scalars, and $A$, $B$, and $C$ are matrices, with
+/// $A$ an m-by-k matrix, $B$ a k-by-n matrix, and $C$ an m-by-n matrix.
+///
+/// Each level of recursion replaces 8 products of quadrants by 7, plus
+/// additions of quadrants, saving 1/8 of the flops for one level and
+/// 23% for two, at the cost of workspace for two quadrants of C, one of A,
+/// and one of B per level. The leaves call gemmC, i.e., the same tile gemm
+/// kernels. A level applies only if A, B, and C split into quadrants
+/// with the same tile sizes and distribution, e.g., for uniform tiles on a
+/// p-by-q grid, if mt/2 and kt/2 are multiples of p, and kt/2 and nt/2 are
+/// multiples of q; otherwise, that level falls back to gemmC.
+/// Transposed matrices are not split.
+///
+/// Strassen's method is not as accurate as the classical one: its error is
+/// bounded only normwise, not componentwise, so entries of C much smaller
+/// than $\|A\| \|B\|$ may have large relative errors. For square n-by-n
+/// matrices with l levels and leaves of size $n_0 = n / 2^l$, the computed
+/// $\hat{C}$ satisfies (Higham, Accuracy and Stability of Numerical
+/// Algorithms, 2nd ed., Theorem 23.3)
+/// \[
+///     \max_{ij} |C - \hat{C}|_{ij} \le
+///         \left( 18^l (n_0^2 + 6 n_0) - 6 n \right)
+///         u \max_{ij} |A_{ij}| \max_{ij} |B_{ij}| + O(u^2),
+/// \]
+/// with unit roundoff u, compared to $n^2 u$ for the classical method.
+/// That is, about 4.5 times the classical bound per level.
+///
+/// Complexity (in real): about $(7/8)^l \, 2 m n k$ flops.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///         One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] alpha
+///         The scalar alpha.
+///
+/// @param[in] A
+///         The m-by-k matrix A.
+///
+/// @param[in] B
+///         The k-by-n matrix B.
+///
+/// @param[in] beta
+///         The scalar beta.
+///
+/// @param[in,out] C
+///         On entry, the m-by-n matrix C.
+///         On exit, overwritten by the result $\alpha A B + \beta C$.
+///
+/// @param[in] opts
+///         Additional options, as map of name = value pairs. Possible options:
+///         - Option::Depth:
+///           Number of levels of recursion, >= 0. Default 1.
+///         - Option::Lookahead:
+///           Number of blocks to overlap communication and computation.
+///           lookahead >= 0. Default 1.
+///         - Option::Target:
+///           Implementation to target. Possible values:
+///           - HostTask:  OpenMP tasks on CPU host [default].
+///           - HostNest:  nested OpenMP parallel for loop on CPU host.
+///           - HostBatch: batched BLAS on CPU host.
+///           - Devices:   batched BLAS on GPU device.
+///
+/// @ingroup gemm
+///
+template <typename scalar_t>
+void gemm_strassen(
+    scalar_t alpha, Matrix<scalar_t>& A,
+                    Matrix<scalar_t>& B,
+    scalar_t beta,  Matrix<scalar_t>& C,
+    Options const& opts)
+{
+    int64_t levels = get_option<int64_t>( opts, Option::Depth, 1 );
+
+    impl::gemm_strassen( alpha, A, B, beta, C, levels, opts );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void gemm_strassen<float>(
+    float alpha, Matrix<float>& A,
+                 Matrix<float>& B,
+    float beta,  Matrix<float>& C,
+    Options const& opts);
+
+template
+void gemm_strassen<double>(
+    double alpha, Matrix<double>& A,
+                  Matrix<double>& B,
+    double beta,  Matrix<double>& C,
+    Options const& opts);
+
+template
+void gemm_strassen< std::complex<float> >(
+    std::complex<float> alpha, Matrix< std::complex<float> >& A,
+                               Matrix< std::complex<float> >& B,
+    std::complex<float> beta,  Matrix< std::complex<float> >& C,
+    Options const& opts);
+
+template
+void gemm_strassen< std::complex<double> >(
+    std::complex<double> alpha, Matrix< std::complex<double> >& A,
+                                Matrix< std::complex<double> >& B,
+    std::complex<double> beta,  Matrix< std::complex<double> >& C,
+    Options const& opts);
+
+} // namespace slate
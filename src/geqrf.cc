@@ -134,6 +134,11 @@ void geqrf(
     // set min number for omp nested active parallel regions
     slate::OmpSetMaxActiveLevels set_active_levels( MinOmpActiveLevels );
 
+    // Persistent team of threads for the host panels, created once
+    // instead of a nested parallel region per panel.
+    internal::PanelTeam panel_team(
+        target == Target::Devices ? 1 : max_panel_threads );
+
     #pragma omp parallel
     #pragma omp master
     {
@@ -154,7 +159,8 @@ void geqrf(
                                 std::move(A_panel),
                                 std::move(Tl_panel),
                                 dwork_array, work_size,
-                                ib, max_panel_threads, priority_1 );
+                                ib, max_panel_threads, priority_1,
+                                &panel_team );
 
                 // triangle-triangle reductions
                 // ttqrt handles tile transfers internally
@@ -361,6 +367,8 @@ void geqrf(
     TriangularFactors<scalar_t>& T,
     Options const& opts )
 {
+    perf::Region perf_region( "geqrf" );
+
     Target target = get_option( opts, Option::Target, Target::HostTask );
 
     switch (target) {
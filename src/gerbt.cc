@@ -338,6 +338,118 @@ template
 void gerbt(Matrix<std::complex<double>>&,
            Matrix<std::complex<double>>&);
 
+//------------------------------------------------------------------------------
+/// Applies a symmetric 2-sided RBT to the given Hermitian matrix,
+/// $A = U^T A U$. The butterflies are real, so this is also $U^H A U$,
+/// and the transformed matrix remains Hermitian.
+///
+/// The lower triangle is expanded into a general matrix with the same
+/// distribution, transformed by the 2-sided gerbt, and copied back.
+/// Tiles of the upper triangle are filled in by broadcasting each block
+/// column of A to the owners of the matching block row.
+/// The transform costs O( d n^2 ) for depth d, so this is negligible next to
+/// the factorization.
+///
+/// @param[in] U
+///     The transform in packed storage. Should not be transposed.
+///
+/// @param[in, out] A
+///     The Hermitian matrix to transform, stored lower.
+///
+/// @ingroup hesv_computational
+///
+template<typename scalar_t>
+void herbt(Matrix<scalar_t>& U,
+           HermitianMatrix<scalar_t>& A)
+{
+    using blas::conj;
 
+    slate_assert(U.op() == Op::NoTrans);
+    slate_assert(A.op() == Op::NoTrans);
+    slate_error_if( A.uplo() != Uplo::Lower );
+
+    if (U.n() == 0) {
+        return;
+    }
+
+    const int64_t nt = A.nt();
+    const Layout layout = Layout::ColMajor;
+
+    // W = A, with the upper triangle filled in from the lower,
+    // one block column k of A at a time: tiles A(k:nt-1, k) are copied to
+    // W(k:nt-1, k), and tiles A(k+1:nt-1, k) are broadcast to the owners
+    // of W(k, k+1:nt-1), which conjugate-transpose them.
+    using BcastList = typename Matrix<scalar_t>::BcastList;
+    auto W = Matrix<scalar_t>::emptyLike( A );
+    W.insertLocalTiles();
+    for (int64_t k = 0; k < nt; ++k) {
+        for (int64_t i = k; i < nt; ++i) {
+            if (A.tileIsLocal( i, k )) {
+                A.tileGetForReading( i, k, LayoutConvert( layout ) );
+                auto Aik = A( i, k );
+                auto Wik = W( i, k );
+                tile::gecopy( Aik, Wik );
+                if (i == k) {
+                    for (int64_t jj = 0; jj < Wik.nb(); ++jj)
+                        for (int64_t ii = 0; ii < jj; ++ii)
+                            Wik.at( ii, jj ) = conj( Wik.at( jj, ii ) );
+                }
+            }
+        }
+
+        if (k+1 < nt) {
+            auto A_col = A.sub( k+1, nt-1, k, k );
+            BcastList bcast_list;
+            for (int64_t i = k+1; i < nt; ++i)
+                bcast_list.push_back( { i-k-1, 0, { W.sub( k, k, i, i ) } } );
+            A_col.listBcast( bcast_list, layout );
+
+            for (int64_t i = k+1; i < nt; ++i) {
+                if (W.tileIsLocal( k, i )) {
+                    A_col.tileGetForReading( i-k-1, 0, LayoutConvert( layout ) );
+                    tile::deepConjTranspose( A_col( i-k-1, 0 ), W( k, i ) );
+                }
+            }
+            A_col.releaseRemoteWorkspace();
+        }
+    }
+
+    auto UT = transpose( U );
+    gerbt( UT, W, U );
+
+    // Copy the lower triangle back.
+    for (int64_t j = 0; j < nt; ++j) {
+        for (int64_t i = j; i < nt; ++i) {
+            if (A.tileIsLocal( i, j )) {
+                A.tileGetForWriting( i, j, LayoutConvert( layout ) );
+                auto Aij = A( i, j );
+                auto Wij = W( i, j );
+                if (i == j) {
+                    Wij.uplo( Uplo::Lower );
+                    tile::tzcopy( Wij, Aij );
+                }
+                else {
+                    tile::gecopy( Wij, Aij );
+                }
+            }
+        }
+    }
+}
+
+template
+void herbt(Matrix<float>&,
+           HermitianMatrix<float>&);
+
+template
+void herbt(Matrix<double>&,
+           HermitianMatrix<double>&);
+
+template
+void herbt(Matrix<std::complex<float>>&,
+           HermitianMatrix<std::complex<float>>&);
+
+template
+void herbt(Matrix<std::complex<double>>&,
+           HermitianMatrix<std::complex<double>>&);
 
 } // namespace slate
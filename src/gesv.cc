@@ -87,6 +87,8 @@ int64_t gesv(
     Matrix<scalar_t>& B,
     Options const& opts)
 {
+    perf::Region perf_region( "gesv" );
+
     Timer t_gesv;
 
     slate_assert(A.mt() == A.nt());  // square
@@ -75,8 +75,11 @@ int64_t getrf(
         A.reserveDeviceWorkspace();
     }
 
-    // set min number for omp nested active parallel regions
-    slate::OmpSetMaxActiveLevels set_active_levels( MinOmpActiveLevels );
+    // Persistent team of threads for the panels, created once
+    // instead of a nested parallel region per panel, so getrf doesn't
+    // need nested parallelism. The panel is factored on the host for
+    // all targets, including Target::Devices, so all use a full team.
+    internal::PanelTeam panel_team( max_panel_threads );
 
     #pragma omp parallel
     #pragma omp master
@@ -90,14 +93,31 @@ int64_t getrf(
             // panel, high priority
             #pragma omp task depend(inout:column[k]) priority(1)
             {
+                // In out-of-core mode, start reading in the column that
+                // enters the lookahead window in the next step.
+                int64_t kl = k+1+lookahead;
+                if (kl < A_nt)
+                    A.sub(k, A_mt-1, kl, kl).prefetchLocalTiles();
+
                 // factor A(k:mt-1, k)
                 int64_t iinfo;
                 internal::getrf_panel<Target::HostTask>(
                     A.sub(k, A_mt-1, k, k), diag_len, ib, pivots.at(k),
-                    pivot_threshold, max_panel_threads, priority_1, k, &iinfo );
+                    pivot_threshold, max_panel_threads, priority_1, k, &iinfo,
+                    &panel_team );
                 if (info == 0 && iinfo > 0)
                     info = kk + iinfo;
 
+                // Root broadcasts the pivot to all ranks. Start it before
+                // broadcasting the panel, to overlap the two; the swaps in
+                // the update tasks need both.
+                // todo: Panel ranks send the pivots to the right.
+                MPI_Request pivot_request;
+                MPI_Ibcast(pivots.at(k).data(),
+                           sizeof(Pivot)*pivots.at(k).size(),
+                           MPI_BYTE, A.tileRank(k, k), A.mpiComm(),
+                           &pivot_request);
+
                 BcastList bcast_list_A;
                 int tag_k = k;
                 for (int64_t i = k; i < A_mt; ++i) {
@@ -107,14 +127,9 @@ int64_t getrf(
                 A.template listBcast<target>(
                     bcast_list_A, target_layout, tag_k );
 
-                // Root broadcasts the pivot to all ranks.
-                // todo: Panel ranks send the pivots to the right.
                 {
-                    trace::Block trace_block("MPI_Bcast");
-
-                    MPI_Bcast(pivots.at(k).data(),
-                              sizeof(Pivot)*pivots.at(k).size(),
-                              MPI_BYTE, A.tileRank(k, k), A.mpiComm());
+                    trace::Block trace_block("MPI_Wait");
+                    MPI_Wait(&pivot_request, MPI_STATUS_IGNORE);
                 }
             }
             // update lookahead column(s), high priority
@@ -321,6 +336,8 @@ int64_t getrf(
     Matrix<scalar_t>& A, Pivots& pivots,
     Options const& opts )
 {
+    perf::Region perf_region( "getrf" );
+
     MethodLU method = get_option<Option::MethodLU>( opts, MethodLU::PartialPiv );
 
     // todo: info for tntpiv, nopiv
@@ -67,6 +67,8 @@ void getrs(Matrix<scalar_t>& A, Pivots& pivots,
            Matrix<scalar_t>& B,
            Options const& opts)
 {
+    perf::Region perf_region( "getrs" );
+
     // Constants
     const scalar_t one  = 1;
 
@@ -54,6 +54,10 @@ namespace slate {
 ///       Inner blocking to use for panel. Default 16.
 ///     - Option::MaxPanelThreads:
 ///       Number of threads to use for panel. Default omp_get_max_threads()/2.
+///     - Option::MethodEig:
+///       Eigensolver for the tridiagonal matrix: QR or DC [default].
+///       QDWH skips the tridiagonal reduction and uses spectral
+///       divide and conquer instead; see heev_qdwh.
 ///     - Option::Target:
 ///       Implementation to target. Possible values:
 ///       - HostTask:  OpenMP tasks on CPU host [default].
@@ -70,6 +74,14 @@ void heev(
     Matrix<scalar_t>& Z,
     Options const& opts)
 {
+    perf::Region perf_region( "heev" );
+
+    MethodEig method = get_option( opts, Option::MethodEig, MethodEig::DC );
+    if (method == MethodEig::QDWH) {
+        heev_qdwh( A, Lambda, Z, opts );
+        return;
+    }
+
     Timer t_heev;
 
     using real_t = blas::real_type<scalar_t>;
@@ -89,7 +101,6 @@ void heev(
     const real_t sqrt_sml = sqrt( sml_num );
     const real_t sqrt_big = sqrt( big_num );
 
-    MethodEig method = get_option( opts, Option::MethodEig, MethodEig::DC );
     Target target = get_option( opts, Option::Target, Target::HostTask );
 
     // Currently requires square process grid.
@@ -0,0 +1,538 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "slate/HermitianMatrix.hh"
+#include "internal/internal.hh"
+
+#include <algorithm>
+#include <cmath>
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Returns a new m-by-n matrix with nb-by-nb tiles, distributed on the
+/// same process grid as A, with its local tiles inserted.
+/// nb is given since A may be a single, smaller tile.
+/// @ingroup heev_impl
+///
+template <typename scalar_t>
+Matrix<scalar_t> heev_qdwh_alloc(
+    BaseMatrix<scalar_t>& A,
+    int64_t m, int64_t n, int64_t nb )
+{
+    using ij_tuple = typename BaseMatrix<scalar_t>::ij_tuple;
+
+    GridOrder grid_order;
+    int nprow, npcol, myrow, mycol;
+    A.gridinfo( &grid_order, &nprow, &npcol, &myrow, &mycol );
+
+    Matrix<scalar_t> B;
+    if (grid_order != GridOrder::Unknown) {
+        B = Matrix<scalar_t>( m, n, nb, nb, grid_order, nprow, npcol,
+                              A.mpiComm() );
+    }
+    else {
+        std::function<int64_t (int64_t)> tileNb = [ nb ]( int64_t ) {
+            return nb;
+        };
+        std::function<int (ij_tuple)> tileRank = A.tileRankFunc();
+        std::function<int (ij_tuple)> tileDevice = A.tileDeviceFunc();
+        B = Matrix<scalar_t>( m, n, tileNb, tileNb, tileRank, tileDevice,
+                              A.mpiComm() );
+    }
+    B.insertLocalTiles();
+    return B;
+}
+
+//------------------------------------------------------------------------------
+/// Returns the diagonal of the square matrix A on all ranks.
+/// @ingroup heev_impl
+///
+template <typename scalar_t>
+std::vector<scalar_t> heev_qdwh_diag(
+    Matrix<scalar_t>& A )
+{
+    int64_t nb = A.tileNb( 0 );
+
+    std::vector<scalar_t> D( A.n(), scalar_t( 0 ) );
+    for (int64_t i = 0; i < A.nt(); ++i) {
+        if (A.tileIsLocal( i, i )) {
+            A.tileGetForReading( i, i, LayoutConvert::ColMajor );
+            auto T = A( i, i );
+            for (int64_t ii = 0; ii < T.nb(); ++ii)
+                D[ i*nb + ii ] = T( ii, ii );
+        }
+    }
+    slate_mpi_call(
+        MPI_Allreduce( MPI_IN_PLACE, D.data(), D.size(),
+                       mpi_type<scalar_t>::value, MPI_SUM, A.mpiComm() ) );
+    return D;
+}
+
+//------------------------------------------------------------------------------
+/// Subtracts sigma from the diagonal of the square matrix A.
+/// @ingroup heev_impl
+///
+template <typename scalar_t>
+void heev_qdwh_shift(
+    Matrix<scalar_t>& A,
+    blas::real_type<scalar_t> sigma )
+{
+    for (int64_t i = 0; i < A.nt(); ++i) {
+        if (A.tileIsLocal( i, i )) {
+            A.tileGetForWriting( i, i, LayoutConvert::ColMajor );
+            auto T = A( i, i );
+            for (int64_t ii = 0; ii < T.nb(); ++ii)
+                T.at( ii, ii ) -= sigma;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Copies the m-by-n block of A starting at ( ia, ja ) to the block of B
+/// starting at ( ib, jb ). A and B have nb-by-nb tiles, but the blocks
+/// need not start on tile boundaries, so each tile of B overlaps up to
+/// 2-by-2 tiles of A. Pieces owned by different ranks are sent
+/// point-to-point; all ranks visit pieces in the same order,
+/// so one tag suffices.
+/// @ingroup heev_impl
+///
+template <typename scalar_t>
+void heev_qdwh_copy(
+    Matrix<scalar_t>& A, int64_t ia, int64_t ja,
+    Matrix<scalar_t>& B, int64_t ib, int64_t jb,
+    int64_t m, int64_t n, int64_t nb )
+{
+    const int tag = 0;
+    const auto mpi_scalar_type = mpi_type<scalar_t>::value;
+
+    int mpi_rank = B.mpiRank();
+    MPI_Comm comm = B.mpiComm();
+
+    // Received pieces, to unpack once all receives complete.
+    struct Piece {
+        int64_t i, j, ii, jj, mb, nb;
+    };
+    std::vector<Piece> recv_pieces;
+    std::vector< std::vector<scalar_t> > recv_buffers, send_buffers;
+    std::vector<MPI_Request> requests;
+
+    // Pieces are [ row0, row1 ) x [ col0, col1 ) in the coordinates of B.
+    for (int64_t j = jb / nb; j*nb < jb + n; ++j) {
+        for (int64_t i = ib / nb; i*nb < ib + m; ++i) {
+            int64_t row_end = std::min( (i + 1)*nb, ib + m );
+            int64_t col_end = std::min( (j + 1)*nb, jb + n );
+            for (int64_t col0 = std::max( j*nb, jb ); col0 < col_end; ) {
+                int64_t ja_col = col0 - jb + ja;
+                int64_t col1 = std::min( col_end,
+                                         col0 + (nb - ja_col % nb) );
+                for (int64_t row0 = std::max( i*nb, ib ); row0 < row_end; ) {
+                    int64_t ia_row = row0 - ib + ia;
+                    int64_t row1 = std::min( row_end,
+                                             row0 + (nb - ia_row % nb) );
+                    int64_t ai = ia_row / nb, aj = ja_col / nb;
+                    int64_t mb_p = row1 - row0, nb_p = col1 - col0;
+                    int src = A.tileRank( ai, aj );
+                    int dst = B.tileRank( i, j );
+
+                    if (src == mpi_rank) {
+                        A.tileGetForReading( ai, aj, LayoutConvert::ColMajor );
+                    }
+                    if (dst == mpi_rank) {
+                        B.tileGetForWriting( i, j, LayoutConvert::ColMajor );
+                    }
+
+                    if (src == mpi_rank && dst == mpi_rank) {
+                        auto S = A( ai, aj );
+                        auto D = B( i, j );
+                        lapack::lacpy( lapack::MatrixType::General, mb_p, nb_p,
+                                       &S.at( ia_row % nb, ja_col % nb ),
+                                       S.stride(),
+                                       &D.at( row0 - i*nb, col0 - j*nb ),
+                                       D.stride() );
+                    }
+                    else if (src == mpi_rank) {
+                        auto S = A( ai, aj );
+                        std::vector<scalar_t> buffer( mb_p*nb_p );
+                        lapack::lacpy( lapack::MatrixType::General, mb_p, nb_p,
+                                       &S.at( ia_row % nb, ja_col % nb ),
+                                       S.stride(), buffer.data(), mb_p );
+                        MPI_Request request;
+                        slate_mpi_call(
+                            MPI_Isend( buffer.data(), mb_p*nb_p,
+                                       mpi_scalar_type, dst, tag, comm,
+                                       &request ) );
+                        requests.push_back( request );
+                        // Moving the vector keeps its data in place.
+                        send_buffers.push_back( std::move( buffer ) );
+                    }
+                    else if (dst == mpi_rank) {
+                        std::vector<scalar_t> buffer( mb_p*nb_p );
+                        MPI_Request request;
+                        slate_mpi_call(
+                            MPI_Irecv( buffer.data(), mb_p*nb_p,
+                                       mpi_scalar_type, src, tag, comm,
+                                       &request ) );
+                        requests.push_back( request );
+                        recv_pieces.push_back(
+                            { i, j, row0 - i*nb, col0 - j*nb, mb_p, nb_p } );
+                        recv_buffers.push_back( std::move( buffer ) );
+                    }
+                    row0 = row1;
+                }
+                col0 = col1;
+            }
+        }
+    }
+
+    internal::waitAll( requests );
+
+    for (int64_t r = 0; r < int64_t( recv_pieces.size() ); ++r) {
+        auto& piece = recv_pieces[ r ];
+        auto D = B( piece.i, piece.j );
+        lapack::lacpy( lapack::MatrixType::General, piece.mb, piece.nb,
+                       recv_buffers[ r ].data(), piece.mb,
+                       &D.at( piece.ii, piece.jj ), D.stride() );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Computes the eigenvalues of the m-by-m Hermitian matrix Ab, stored as a
+/// general matrix, into Lambda[ offset : offset + m ), and, if Z is not
+/// empty, the eigenvectors Zb Q into columns [ offset, offset + m ) of Z,
+/// where Ab = Q Lambda Q^H. Zb is the n-by-m orthonormal basis of the
+/// invariant subspace that Ab represents; if Zb is empty, it is the
+/// identity. All matrices have nb-by-nb tiles.
+///
+/// If Ab is one tile, the rank that owns it solves it with LAPACK.
+/// Otherwise, the QDWH polar factor of Ab - sigma I splits Ab into 2
+/// smaller problems, which are solved recursively; if it does not split,
+/// Ab is solved by heev.
+/// Ab, Zb, and the workspace are released before recursing.
+/// @ingroup heev_impl
+///
+template <typename scalar_t>
+void heev_qdwh_rec(
+    Matrix<scalar_t> Ab,
+    Matrix<scalar_t> Zb,
+    int64_t offset,
+    int64_t level,
+    int64_t nb,
+    std::vector< blas::real_type<scalar_t> >& Lambda,
+    Matrix<scalar_t>& Z,
+    blas::real_type<scalar_t> delta,
+    Options const& opts )
+{
+    using real_t = blas::real_type<scalar_t>;
+    using std::real;
+
+    // Constants
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+    const scalar_t half = 0.5;
+    const int64_t seed  = 42;
+    const auto mpi_real_type = mpi_type<real_t>::value;
+
+    int64_t m = Ab.m();
+    bool wantz = (Z.mt() > 0);
+
+    // Copies the eigenvectors Zb Q into Z.
+    auto back_transform = [&]( Matrix<scalar_t>& Q ) {
+        if (Zb.mt() == 0) {
+            heev_qdwh_copy( Q, 0, 0, Z, 0, offset, Z.m(), m, nb );
+        }
+        else {
+            auto ZQ = heev_qdwh_alloc( Ab, Z.m(), m, nb );
+            gemm( one, Zb, Q, zero, ZQ, opts );
+            heev_qdwh_copy( ZQ, 0, 0, Z, 0, offset, Z.m(), m, nb );
+        }
+    };
+
+    if (Ab.nt() == 1) {
+        // Solve on the rank that owns the tile, overwriting Ab with Q.
+        int root = Ab.tileRank( 0, 0 );
+        int64_t info = 0;
+        if (Ab.tileIsLocal( 0, 0 )) {
+            Ab.tileGetForWriting( 0, 0, LayoutConvert::ColMajor );
+            auto T = Ab( 0, 0 );
+            lapack::Job jobz = wantz ? lapack::Job::Vec : lapack::Job::NoVec;
+            info = lapack::heev( jobz, Uplo::Lower, m, T.data(), T.stride(),
+                                 &Lambda[ offset ] );
+        }
+        slate_mpi_call(
+            MPI_Bcast( &info, 1, MPI_INT64_T, root, Ab.mpiComm() ) );
+        slate_error_if( info != 0 );
+        slate_mpi_call(
+            MPI_Bcast( &Lambda[ offset ], m, mpi_real_type, root,
+                       Ab.mpiComm() ) );
+        if (wantz)
+            back_transform( Ab );
+        return;
+    }
+
+    // Shift by the median of the diagonal. The offset delta keeps a
+    // diagonal entry that is also an eigenvalue from leaving B singular.
+    std::vector<scalar_t> D = heev_qdwh_diag( Ab );
+    std::vector<real_t> D_real( m );
+    for (int64_t i = 0; i < m; ++i)
+        D_real[ i ] = real( D[ i ] );
+    auto mid = D_real.begin() + m / 2;
+    std::nth_element( D_real.begin(), mid, D_real.end() );
+    real_t sigma = *mid + delta;
+
+    auto Up = heev_qdwh_alloc( Ab, m, m, nb );
+    {
+        auto B = heev_qdwh_alloc( Ab, m, m, nb );
+        slate::copy( Ab, B, opts );
+        heev_qdwh_shift( B, sigma );
+        Matrix<scalar_t> H;
+        polar( B, Up, H, opts );
+    }
+
+    // Number of eigenvalues below sigma,
+    // k = trace( I - P ) = (m - trace( Up )) / 2.
+    std::vector<scalar_t> DU = heev_qdwh_diag( Up );
+    real_t trace = 0;
+    for (int64_t i = 0; i < m; ++i)
+        trace += real( DU[ i ] );
+    int64_t k = std::llround( (m - trace) / 2 );
+
+    if (k <= 0 || k >= m) {
+        // Doesn't split, e.g., a multiple eigenvalue; solve it directly.
+        Up = Matrix<scalar_t>();
+        HermitianMatrix<scalar_t> Ah( Uplo::Lower, Ab );
+        Matrix<scalar_t> Q;
+        if (wantz)
+            Q = heev_qdwh_alloc( Ab, m, m, nb );
+        Options opts_heev = opts;
+        opts_heev[ Option::MethodEig ] = MethodEig::DC;
+        std::vector<real_t> Lambda_b;
+        heev( Ah, Lambda_b, Q, opts_heev );
+        std::copy( Lambda_b.begin(), Lambda_b.end(),
+                   Lambda.begin() + offset );
+        if (wantz)
+            back_transform( Q );
+        return;
+    }
+
+    // Orthonormal bases of range( I - P ) and range( P ), where
+    // P = (Up + I)/2, from the QR factorization of
+    // Y = [ (I - P) Omega_1, P Omega_2 ] = (Up Omega S + Omega)/2,
+    // with Gaussian Omega and S = diag( -I_k, I ). One factorization
+    // gives V = [ V_1, V_2 ] with V_1 exactly orthogonal to V_2.
+    auto V = heev_qdwh_alloc( Ab, m, m, nb );
+    {
+        auto Y = heev_qdwh_alloc( Ab, m, m, nb );
+        internal::randn( V, seed + level );
+        slate::copy( V, Y, opts );
+        for (int64_t j = 0; j*nb < k; ++j) {
+            for (int64_t i = 0; i < V.mt(); ++i) {
+                if (V.tileIsLocal( i, j )) {
+                    V.tileGetForWriting( i, j, LayoutConvert::ColMajor );
+                    auto T = V( i, j );
+                    for (int64_t jj = 0; jj < T.nb() && j*nb + jj < k; ++jj)
+                        blas::scal( T.mb(), -one, &T.at( 0, jj ), 1 );
+                }
+            }
+        }
+        gemm( half, Up, V, half, Y, opts );
+
+        TriangularFactors<scalar_t> T;
+        geqrf( Y, T, opts );
+        set( zero, one, V, opts );
+        unmqr( Side::Left, Op::NoTrans, Y, T, V, opts );
+    }
+    Up = Matrix<scalar_t>();
+
+    // Each child is A_c = V_c^H Ab V_c, with basis Z_c = Zb V_c.
+    int64_t child_m[ 2 ] = { k, m - k };
+    int64_t child_j[ 2 ] = { 0, k };
+    Matrix<scalar_t> A_child[ 2 ], Z_child[ 2 ];
+    for (int c = 0; c < 2; ++c) {
+        int64_t mc = child_m[ c ];
+        auto Vc = heev_qdwh_alloc( Ab, m, mc, nb );
+        heev_qdwh_copy( V, 0, child_j[ c ], Vc, 0, 0, m, mc, nb );
+
+        {
+            auto W = heev_qdwh_alloc( Ab, m, mc, nb );
+            gemm( one, Ab, Vc, zero, W, opts );
+            A_child[ c ] = heev_qdwh_alloc( Ab, mc, mc, nb );
+            auto VH = conj_transpose( Vc );
+            gemm( one, VH, W, zero, A_child[ c ], opts );
+        }
+
+        if (wantz) {
+            if (Zb.mt() == 0) {
+                Z_child[ c ] = Vc;
+            }
+            else {
+                Z_child[ c ] = heev_qdwh_alloc( Ab, Zb.m(), mc, nb );
+                gemm( one, Zb, Vc, zero, Z_child[ c ], opts );
+            }
+        }
+    }
+
+    // Release this level before recursing.
+    Ab = Matrix<scalar_t>();
+    Zb = Matrix<scalar_t>();
+    V  = Matrix<scalar_t>();
+
+    heev_qdwh_rec( std::move( A_child[ 0 ] ), std::move( Z_child[ 0 ] ),
+                   offset, level + 1, nb, Lambda, Z, delta, opts );
+    heev_qdwh_rec( std::move( A_child[ 1 ] ), std::move( Z_child[ 1 ] ),
+                   offset + k, level + 1, nb, Lambda, Z, delta, opts );
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel Hermitian matrix eigen decomposition using
+/// QDWH-based spectral divide and conquer,
+/// \[
+///     A = Z \Lambda Z^H.
+/// \]
+/// Instead of reducing to tridiagonal form, the spectrum is split
+/// recursively. For a block $A_b$, with $\sigma$ near the median of its
+/// diagonal, the polar factor $U_p$ of $A_b - \sigma I$ gives the spectral
+/// projector $P = (U_p + I)/2$ onto the eigenvalues above $\sigma$,
+/// whose rank is $m - k = \text{trace}( P )$. Orthonormal bases $V_1$ and
+/// $V_2$ of the ranges of $I - P$ and $P$ are found by one QR factorization
+/// of $[ (I - P) \Omega_1, P \Omega_2 ]$ with Gaussian $\Omega$, and the
+/// $k \times k$ block $V_1^H A_b V_1$ and the $(m - k) \times (m - k)$
+/// block $V_2^H A_b V_2$ are solved recursively, as new distributed
+/// matrices, so each polar decomposition is only the size of its block.
+///
+/// Blocks of one tile are solved by LAPACK on the rank that owns the tile.
+/// Blocks that do not split, e.g., with a multiple eigenvalue, are solved
+/// by heev with MethodEig::DC, which currently requires a square process
+/// grid. Since the lower eigenvalues are always ordered first,
+/// the eigenvalues are returned in ascending order.
+///
+/// Selected in heev by Option::MethodEig = MethodEig::QDWH.
+///
+/// Complexity (in real): $O(n^3)$ flops, dominated by the top-level polar
+/// decomposition; the total size of the blocks at each level of the
+/// $\approx \log_2( n / nb )$ levels is $n$.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     On entry, the $n \times n$ Hermitian matrix $A$.
+///     Currently, tiles must be square (mb = nb). Not modified.
+///
+/// @param[out] Lambda
+///     The vector Lambda of length $n$.
+///     If successful, the eigenvalues in ascending order.
+///
+/// @param[out] Z
+///     On entry, if $Z$ is empty, does not compute eigenvectors.
+///     Otherwise, the $n \times n$ matrix $Z$ to store eigenvectors,
+///     with the same tiling as $A$.
+///     On exit, orthonormal eigenvectors of the matrix $A$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::MaxIterations:
+///       Maximum number of QDWH iterations per polar decomposition;
+///       see polar.
+///     - Option::Lookahead:
+///       Number of panels to overlap with matrix updates.
+///       lookahead >= 0. Default 1.
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// @ingroup heev
+///
+template <typename scalar_t>
+void heev_qdwh(
+    HermitianMatrix<scalar_t>& A,
+    std::vector< blas::real_type<scalar_t> >& Lambda,
+    Matrix<scalar_t>& Z,
+    Options const& opts)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    perf::Region perf_region( "heev_qdwh" );
+
+    Timer t_heev;
+
+    // Constants
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+    const real_t eps    = std::numeric_limits<real_t>::epsilon();
+
+    int64_t n = A.n();
+    int64_t nb = A.tileNb( 0 );
+
+    Lambda.resize( n );
+    if (n == 0)
+        return;
+
+    real_t Amax = norm( Norm::Max, A, opts );
+    if (std::isnan( Amax ) || std::isinf( Amax )) {
+        Lambda.assign( Lambda.size(), Amax );
+        return;
+    }
+
+    // Expand A to a general matrix, Ag = A I.
+    auto Ag = impl::heev_qdwh_alloc( A, n, n, nb );
+    {
+        auto Id = impl::heev_qdwh_alloc( A, n, n, nb );
+        set( zero, one, Id, opts );
+        hemm( Side::Left, one, A, Id, zero, Ag, opts );
+    }
+
+    // Offset of the shifts from the median.
+    real_t Anorm = norm( Norm::Fro, Ag, opts );
+    real_t delta = std::sqrt( eps ) * Anorm;
+
+    impl::heev_qdwh_rec( std::move( Ag ), Matrix<scalar_t>(), 0, 0, nb,
+                         Lambda, Z, delta, opts );
+
+    timers[ "heev_qdwh" ] = t_heev.stop();
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void heev_qdwh<float>(
+    HermitianMatrix<float>& A,
+    std::vector<float>& Lambda,
+    Matrix<float>& Z,
+    Options const& opts);
+
+template
+void heev_qdwh<double>(
+    HermitianMatrix<double>& A,
+    std::vector<double>& Lambda,
+    Matrix<double>& Z,
+    Options const& opts);
+
+template
+void heev_qdwh< std::complex<float> >(
+    HermitianMatrix< std::complex<float> >& A,
+    std::vector<float>& Lambda,
+    Matrix< std::complex<float> >& Z,
+    Options const& opts);
+
+template
+void heev_qdwh< std::complex<double> >(
+    HermitianMatrix< std::complex<double> >& A,
+    std::vector<double>& Lambda,
+    Matrix< std::complex<double> >& Z,
+    Options const& opts);
+
+} // namespace slate
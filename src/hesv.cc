@@ -78,6 +78,14 @@ namespace slate {
 ///       Inner blocking to use for panel. Default 16.
 ///     - Option::MaxPanelThreads:
 ///       Number of threads to use for panel. Default omp_get_max_threads()/2.
+///     - Option::MethodHesv:
+///       Algorithm to use. Possible values:
+///       - MethodHesv::Aasen: Aasen's 2-stage algorithm [default].
+///       - MethodHesv::RBT: random butterfly transform with $LDL^H$ without
+///         pivoting and iterative refinement; see hesv_rbt. On exit, $A$
+///         holds the factors of the transformed matrix, and pivots, T,
+///         pivots2, and H are not referenced.
+///         Options for hesv_rbt also apply.
 ///     - Option::Target:
 ///       Implementation to target. Possible values:
 ///       - HostTask:  OpenMP tasks on CPU host [default].
@@ -108,6 +116,17 @@ int64_t hesv(
     if (A_.uplo() == Uplo::Upper)
         A_ = conj_transpose( A_ );
 
+    MethodHesv method = get_option( opts, Option::MethodHesv, MethodHesv::Auto );
+    if (method == MethodHesv::RBT) {
+        auto X = B.emptyLike();
+        X.insertLocalTiles();
+        int iter;
+        int64_t info = hesv_rbt( A_, B, X, iter, opts );
+        slate::copy( X, B, opts );
+        timers[ "hesv" ] = t_hesv.stop();
+        return info;
+    }
+
     // factorization
     Timer t_hetrf;
     int64_t info = hetrf( A_, pivots, T, pivots2, H, opts );
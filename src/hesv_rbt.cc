@@ -0,0 +1,337 @@
+// Copyright (c) 2020-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "internal/internal.hh"
+#include "internal/internal_util.hh"
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Copies A, stored upper, to a new Hermitian matrix stored lower,
+/// $L = A^H$ tile by tile. Tile L(i, j) is on the owner of A(j, i),
+/// so no communication is needed.
+///
+/// @param[in] A
+///     Hermitian matrix stored upper. Should not be transposed.
+///
+/// @return lower matrix L holding the same Hermitian matrix.
+///
+template <typename scalar_t>
+HermitianMatrix<scalar_t> lower_from_upper( HermitianMatrix<scalar_t>& A )
+{
+    using ij_tuple = typename BaseMatrix<scalar_t>::ij_tuple;
+
+    std::function<int64_t (int64_t)> tileNb = [A]( int64_t j ) {
+        return A.tileNb( j );
+    };
+    std::function<int (ij_tuple)> tileRank = [A]( ij_tuple ij ) {
+        return A.tileRank( std::get<1>( ij ), std::get<0>( ij ) );
+    };
+    std::function<int (ij_tuple)> tileDevice = [A]( ij_tuple ij ) {
+        return A.tileDevice( std::get<1>( ij ), std::get<0>( ij ) );
+    };
+    HermitianMatrix<scalar_t> L( Uplo::Lower, A.n(), tileNb, tileRank,
+                                 tileDevice, A.mpiComm() );
+    L.insertLocalTiles();
+
+    for (int64_t j = 0; j < L.nt(); ++j) {
+        for (int64_t i = j; i < L.mt(); ++i) {
+            if (L.tileIsLocal( i, j )) {
+                A.tileGetForReading( j, i, LayoutConvert::ColMajor );
+                L.tileGetForWriting( i, j, LayoutConvert::ColMajor );
+                tile::deepConjTranspose( A( j, i ), L( i, j ) );
+            }
+        }
+    }
+    return L;
+}
+
+//------------------------------------------------------------------------------
+/// Copies L, made by lower_from_upper( A ), back to A, $A = L^H$.
+///
+template <typename scalar_t>
+void upper_from_lower(
+    HermitianMatrix<scalar_t>& L, HermitianMatrix<scalar_t>& A )
+{
+    for (int64_t j = 0; j < L.nt(); ++j) {
+        for (int64_t i = j; i < L.mt(); ++i) {
+            if (L.tileIsLocal( i, j )) {
+                L.tileGetForReading( i, j, LayoutConvert::ColMajor );
+                A.tileGetForWriting( j, i, LayoutConvert::ColMajor );
+                tile::deepConjTranspose( L( i, j ), A( j, i ) );
+            }
+        }
+    }
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel Hermitian indefinite $LDL^H$ factorization and solve,
+/// using random butterfly transforms instead of pivoting.
+///
+/// Computes the solution to a system of linear equations
+/// \[
+///     A X = B,
+/// \]
+/// where $A$ is an n-by-n Hermitian matrix and $X$ and $B$ are n-by-nrhs
+/// matrices.
+///
+/// hesv_rbt first transforms the matrix with a symmetric random butterfly
+/// transform, $U^T A U$, which remains Hermitian (see herbt), factorizes the
+/// transformed matrix using hetrf_nopiv, and uses this factorization within
+/// an iterative refinement procedure to produce a solution with full
+/// normwise backward error quality (see below). Unlike Aasen's algorithm in
+/// hesv, there is no pivot search, so the factorization has the data flow
+/// of a Cholesky factorization. If the approach fails and the
+/// UseFallbackSolver is true, the problem is re-solved with hesv using
+/// Aasen's algorithm.
+///
+/// The iterative refinement process is stopped if iter > itermax or
+/// for all the RHS, $1 \le j \le nrhs$, we have:
+///     $\norm{r_j}_{inf} < tol \norm{x_j}_{inf} \norm{A}_{inf},$
+/// where:
+/// - iter is the number of the current iteration in the iterative refinement
+///    process
+/// - $\norm{r_j}_{inf}$ is the infinity-norm of the residual, $r_j = Ax_j - b_j$
+/// - $\norm{x_j}_{inf}$ is the infinity-norm of the solution
+/// - $\norm{A}_{inf}$ is the infinity-operator-norm of the matrix $A$
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the n-by-n Hermitian matrix $A$ to be factored.
+///     On exit, the factors $D$ and $L$ from the factorization
+///     $U^T A U = L D L^H$ of the transformed matrix, or if $A$ is stored
+///     upper, $D$ and $L^H$.
+///     The factorization is done on a lower matrix; if $A$ is stored upper,
+///     it is first copied to a lower matrix with the transposed
+///     distribution, and the factors are copied back on exit.
+///
+/// @param[in] B
+///     On entry, the n-by-nrhs right hand side matrix $B$.
+///
+/// @param[out] X
+///     On exit, the n-by-nrhs solution matrix $X$.
+///
+/// @param[out] iter
+///     The number of the iterations in the iterative refinement
+///     process, needed for the convergence. If iterative refinement failed,
+///     it is set to -(1+itermax), regardless of whether the fallback solver
+///     was used.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::Lookahead:
+///       Number of panels to overlap with matrix updates.
+///       lookahead >= 0. Default 1.
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///     - Option::Depth:
+///       Depth for butterfly transform. Default 2
+///     - Option::Tolerance:
+///       Iterative refinement tolerance. Default epsilon * sqrt(n)
+///     - Option::MaxIterations:
+///       Maximum number of refinement iterations. Default 30
+///     - Option::UseFallbackSolver:
+///       If true and iterative refinement fails to converge, the problem is
+///       resolved with Aasen's algorithm. Default true
+///
+/// @retval 0 successful exit
+/// @retval >0 for return value = $i$, the computed $D(i,i)$ is exactly zero
+///         and the fallback solver was not used or also failed,
+///         so the solution could not be computed.
+///
+/// @ingroup hesv
+///
+template <typename scalar_t>
+int64_t hesv_rbt(
+    HermitianMatrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    Matrix<scalar_t>& X,
+    int& iter,
+    Options const& opts)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Work on the stored triangle, without a transposed view, since A^H = A
+    // for a Hermitian matrix; hesv passes an upper matrix as such a view.
+    // An upper matrix is copied to a lower one.
+    HermitianMatrix<scalar_t> A_stored = A;
+    if (A_stored.op() != Op::NoTrans)
+        A_stored = conj_transpose( A_stored );
+    if (A_stored.uplo() == Uplo::Upper) {
+        HermitianMatrix<scalar_t> A_lower = impl::lower_from_upper( A_stored );
+        int64_t info = hesv_rbt( A_lower, B, X, iter, opts );
+        impl::upper_from_lower( A_lower, A_stored );
+        return info;
+    }
+    else if (A.op() != Op::NoTrans) {
+        return hesv_rbt( A_stored, B, X, iter, opts );
+    }
+
+    perf::Region perf_region( "hesv_rbt" );
+
+    Target target = get_option( opts, Option::Target, Target::HostTask );
+
+    // Constants
+    const scalar_t one = 1.0;
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+    const int64_t rbt_seed = 42;
+
+    int64_t depth = get_option<int64_t>( opts, Option::Depth, 2 );
+    int64_t itermax = get_option<int64_t>( opts, Option::MaxIterations, 30 );
+    double tol = get_option<double>( opts, Option::Tolerance, eps*std::sqrt(A.m()) );
+    bool use_fallback = get_option<int64_t>( opts, Option::UseFallbackSolver, true );
+
+    slate_assert(B.mt() == A.mt());
+
+    // The same butterflies on both sides keep the transform symmetric.
+    auto A_general = Matrix<scalar_t>::emptyLike( A );
+    auto transforms = internal::rbt_generate( A_general, depth, rbt_seed );
+    Matrix<scalar_t> U = transforms.second;
+    Matrix<scalar_t> UT = transpose( U );
+
+    // Workspace
+    HermitianMatrix<scalar_t> A_copy = A.emptyLike();
+    Matrix<scalar_t> R = B.emptyLike();
+
+    real_t Anorm = 0;
+    if (itermax > 0 || use_fallback) {
+        A_copy.insertLocalTiles( target );
+        R.insertLocalTiles( target );
+        slate::copy( A, A_copy, opts );
+        Anorm = norm( Norm::Inf, A, opts );
+    }
+
+    slate::copy( B, X, opts );
+
+    std::vector<real_t> colnorms_X( X.n() );
+    std::vector<real_t> colnorms_R( R.n() );
+
+    real_t cte = Anorm*tol;
+    bool converged = false;
+
+    // Factor
+    herbt( U, A );
+    int64_t info = hetrf_nopiv( A, opts );
+
+    if (info == 0) {
+        // Solve
+        gerbt( UT, X );
+        hetrs_nopiv( A, X, opts );
+        gerbt( U, X );
+
+        if (itermax == 0) {
+            return 0;
+        }
+
+        // refine
+        slate::copy( B, R, opts );
+        hemm( Side::Left,
+              -one, A_copy, X,
+               one, R, opts );
+
+        // Check whether the nrhs normwise backward error satisfies the
+        // stopping criterion. If yes, set iter=0 and return.
+        colNorms( Norm::Max, X, colnorms_X.data(), opts );
+        colNorms( Norm::Max, R, colnorms_R.data(), opts );
+
+        if (internal::iterRefConverged<real_t>( colnorms_R, colnorms_X, cte )) {
+            iter = 0;
+            converged = true;
+        }
+
+        for (int64_t iiter = 0; iiter < itermax && ! converged; ++iiter) {
+            gerbt( UT, R );
+            hetrs_nopiv( A, R, opts );
+            gerbt( U, R );
+            add( one, R, one, X, opts );
+            slate::copy( B, R, opts );
+            hemm( Side::Left,
+                  -one, A_copy, X,
+                   one, R, opts );
+
+            // Check whether nrhs normwise backward error satisfies the
+            // stopping criterion. If yes, set iter = iiter > 0 and return.
+            colNorms( Norm::Max, X, colnorms_X.data(), opts );
+            colNorms( Norm::Max, R, colnorms_R.data(), opts );
+
+            if (internal::iterRefConverged<real_t>( colnorms_R, colnorms_X, cte )) {
+                iter = iiter+1;
+                converged = true;
+            }
+        }
+    }
+
+    if (! converged) {
+        // If we are at this place of the code, this is because either
+        // D is singular or we have performed iter = itermax iterations
+        // and never satisfied the stopping criterion. Set up the iter flag
+        // accordingly and follow up with Aasen's algorithm.
+        iter = -itermax - 1;
+
+        if (use_fallback) {
+            slate::copy( B, X, opts );
+            slate::copy( A_copy, A, opts );
+
+            auto H = Matrix<scalar_t>::emptyLike( A );
+            int64_t kl = A.tileNb( 0 );
+            int64_t ku = A.tileNb( 0 );
+            auto T = BandMatrix<scalar_t>::emptyLike( A, kl, ku );
+            Pivots pivots, pivots2;
+            Options opts_aasen = opts;
+            opts_aasen[ Option::MethodHesv ] = MethodHesv::Aasen;
+            info = hesv( A, pivots, T, pivots2, H, X, opts_aasen );
+        }
+    }
+
+    return info;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t hesv_rbt<float>(
+    HermitianMatrix<float>& A,
+    Matrix<float>& B,
+    Matrix<float>& X,
+    int& iter,
+    Options const& opts);
+
+template
+int64_t hesv_rbt<double>(
+    HermitianMatrix<double>& A,
+    Matrix<double>& B,
+    Matrix<double>& X,
+    int& iter,
+    Options const& opts);
+
+template
+int64_t hesv_rbt< std::complex<float> >(
+    HermitianMatrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& B,
+    Matrix< std::complex<float> >& X,
+    int& iter,
+    Options const& opts);
+
+template
+int64_t hesv_rbt< std::complex<double> >(
+    HermitianMatrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& B,
+    Matrix< std::complex<double> >& X,
+    int& iter,
+    Options const& opts);
+
+} // namespace slate
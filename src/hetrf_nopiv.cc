@@ -0,0 +1,336 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "slate/HermitianMatrix.hh"
+#include "slate/TriangularMatrix.hh"
+#include "internal/internal.hh"
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Splits the panel A(k+1:nt-1, k) = L D, computed by the trsm with $L_{kk}^H$,
+/// into W(k+1:nt-1, k) = L D and A(k+1:nt-1, k) = L, for the local tiles.
+/// D is the diagonal of A(k, k), which was broadcast down the panel.
+/// @ingroup hesv_impl
+///
+template <typename scalar_t>
+void hetrf_nopiv_split_panel(
+    HermitianMatrix<scalar_t>& A,
+    HermitianMatrix<scalar_t>& W,
+    int64_t k )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    const real_t r_one = 1.0;
+    int64_t A_nt = A.nt();
+
+    bool first = true;
+    std::vector<real_t> Dinv;
+    for (int64_t i = k+1; i < A_nt; ++i) {
+        if (A.tileIsLocal( i, k )) {
+            if (first) {
+                A.tileGetForReading( k, k, LayoutConvert::ColMajor );
+                auto Akk = A( k, k );
+                Dinv.resize( Akk.nb() );
+                for (int64_t jj = 0; jj < Akk.nb(); ++jj)
+                    Dinv[ jj ] = r_one / blas::real( Akk( jj, jj ) );
+                first = false;
+            }
+            A.tileGetForWriting( i, k, LayoutConvert::ColMajor );
+            W.tileInsert( i, k );
+            auto Aik = A( i, k );
+            auto Wik = W( i, k );
+            tile::gecopy( Aik, Wik );
+            for (int64_t jj = 0; jj < Aik.nb(); ++jj)
+                blas::scal( Aik.mb(), Dinv[ jj ], &Aik.at( 0, jj ), 1 );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Distributed parallel Hermitian $L D L^H$ factorization without pivoting.
+/// Generic implementation for any target.
+/// Factorization of diagonal tiles computed on host using Host OpenMP task.
+/// @ingroup hesv_impl
+///
+template <Target target, typename scalar_t>
+int64_t hetrf_nopiv(
+    HermitianMatrix<scalar_t> A,
+    Options const& opts )
+{
+    using real_t = blas::real_type<scalar_t>;
+    using BcastListTag = typename Matrix<scalar_t>::BcastListTag;
+
+    // Constants
+    const scalar_t one = 1.0;
+    const scalar_t half = 0.5;
+    const real_t r_one = 1.0;
+    const int priority_0 = 0;
+    const int priority_1 = 1;
+    const int queue_0 = 0;
+    const int queue_1 = 1;
+    // Assumes column major
+    const Layout layout = Layout::ColMajor;
+
+    // Options
+    int64_t lookahead = get_option<Option::Lookahead>( opts, 1 );
+
+    if (A.uplo() != Uplo::Lower) {
+        slate_not_implemented( "hetrf_nopiv with uplo=upper" );
+    }
+
+    int64_t info = 0;
+    int64_t A_nt = A.nt();
+
+    // Panels of L D, sent down the columns to update, while L is sent
+    // across the rows.
+    auto W = A.emptyLike();
+
+    if (target == Target::Devices) {
+        // two batch arrays plus one for each lookahead
+        // batch array size will be set as needed
+        A.allocateBatchArrays( 0, 2 + lookahead );
+        A.reserveDeviceWorkspace();
+    }
+
+    // OpenMP needs pointer types, but vectors are exception safe
+    std::vector< uint8_t > column_vector(A_nt);
+    uint8_t* column = column_vector.data();
+    SLATE_UNUSED( column ); // Used only by OpenMP
+
+    // A(j:nt-1, j) -= L(j:nt-1, k) D_k L(j, k)^H
+    //              = A(j:nt-1, k) W(j, k)^H.
+    // The diagonal tile uses her2k with both halves of the update,
+    // L W^H = W L^H = L D L^H, to update only its lower triangle.
+    auto update_column = [&]( int64_t k, int64_t j, int priority, int queue ) {
+        internal::her2k<target>(
+            -half, A.sub( j, j, k, k ),
+                   W.sub( j, j, k, k ),
+            r_one, A.sub( j, j ),
+            priority, queue, layout );
+
+        if (j+1 <= A_nt-1) {
+            auto Wjk = W.sub( j, j, k, k );
+            internal::gemm<target>(
+                -one, A.sub( j+1, A_nt-1, k, k ),
+                      conj_transpose( Wjk ),
+                one,  A.sub( j+1, A_nt-1, j, j ),
+                layout, priority, queue );
+        }
+    };
+
+    // set min number for omp nested active parallel regions
+    slate::OmpSetMaxActiveLevels set_active_levels( MinOmpActiveLevels );
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        int64_t kk = 0;  // column index (not block-column)
+        for (int64_t k = 0; k < A_nt; ++k) {
+            // panel, high priority
+            #pragma omp task depend(inout:column[k]) priority(1) \
+                shared( info )
+            {
+                // factor A(k, k) = L(k, k) D_k L(k, k)^H
+                int64_t iinfo;
+                internal::hetrf_nopiv<Target::HostTask>(
+                    A.sub( k, k ), priority_1, &iinfo );
+                if (info == 0 && iinfo > 0) {
+                    info = kk + iinfo;
+                }
+
+                if (k+1 <= A_nt-1) {
+                    // send A(k, k) down col A(k+1:nt-1, k)
+                    A.tileBcast( k, k, A.sub( k+1, A_nt-1, k, k ), layout );
+
+                    // A(k+1:nt-1, k) * L(k, k)^{-H} = L(k+1:nt-1, k) D_k
+                    auto Akk = A.sub( k, k );
+                    auto Tkk = TriangularMatrix<scalar_t>( Diag::Unit, Akk );
+                    internal::trsm<target>(
+                        Side::Right,
+                        one, conj_transpose( Tkk ),
+                        A.sub( k+1, A_nt-1, k, k ),
+                        priority_1, layout, queue_1 );
+
+                    hetrf_nopiv_split_panel( A, W, k );
+                }
+
+                BcastListTag bcast_list_A, bcast_list_W;
+                for (int64_t i = k+1; i < A_nt; ++i) {
+                    // send L(i, k) across row A(i, k+1:i) with msg tag i,
+                    // and W(i, k) down col A(i:nt-1, i) with msg tag nt + i
+                    bcast_list_A.push_back(
+                        {i, k, {A.sub( i, i, k+1, i )}, i} );
+                    bcast_list_W.push_back(
+                        {i, k, {W.sub( i, A_nt-1, i, i )}, A_nt + i} );
+                }
+                A.template listBcastMT<target>( bcast_list_A, layout );
+                W.template listBcastMT<target>( bcast_list_W, layout );
+            }
+
+            // update lookahead column(s), high priority
+            for (int64_t j = k+1; j < k+1+lookahead && j < A_nt; ++j) {
+                #pragma omp task depend(in:column[k]) \
+                                 depend(inout:column[j]) \
+                                 priority(1)
+                {
+                    update_column( k, j, priority_1, j-k+1 );
+                }
+            }
+
+            // update trailing submatrix, normal priority
+            if (k+1+lookahead < A_nt) {
+                #pragma omp task depend(in:column[k]) \
+                                 depend(inout:column[k+1+lookahead]) \
+                                 depend(inout:column[A_nt-1])
+                {
+                    // Columns are independent. On devices, they share
+                    // batch arrays, so are updated in order.
+                    for (int64_t j = k+1+lookahead; j < A_nt; ++j) {
+                        #pragma omp task if (target != Target::Devices)
+                        {
+                            update_column( k, j, priority_0, queue_0 );
+                        }
+                    }
+                    #pragma omp taskwait
+                }
+            }
+
+            #pragma omp task depend(inout:column[k])
+            {
+                auto panel = A.sub( k, A_nt-1, k, k );
+                auto W_panel = W.sub( k, A_nt-1, k, k );
+
+                // Erase remote tiles on all devices including host
+                panel.releaseRemoteWorkspace();
+                W_panel.releaseRemoteWorkspace();
+
+                // Update the origin tiles before their
+                // workspace copies on devices are erased.
+                panel.tileUpdateAllOrigin();
+
+                // Erase local workspace on devices.
+                panel.releaseLocalWorkspace();
+
+                // W(k+1:nt-1, k) is no longer needed.
+                for (int64_t i = k+1; i < A_nt; ++i) {
+                    if (W.tileIsLocal( i, k ))
+                        W.tileErase( i, k, AllDevices );
+                }
+            }
+            kk += A.tileNb( k );
+        }
+
+        #pragma omp taskwait
+        A.tileUpdateAllOrigin();
+    }
+    A.clearWorkspace();
+
+    internal::reduce_info( &info, A.mpiComm() );
+    return info;
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel Hermitian $L D L^H$ factorization without pivoting.
+///
+/// Computes the factorization of a Hermitian matrix $A$ without pivoting.
+/// The factorization has the form
+/// \[
+///     A = L D L^H,
+/// \]
+/// where $L$ is unit lower triangular and $D$ is real diagonal.
+/// Currently only $A$ stored lower is supported.
+///
+/// Without pivoting, this is stable only for matrices such as those
+/// preconditioned by a random butterfly transform; see hesv_rbt.
+/// It has the same data flow as potrf: the panel is factored, then
+/// $L$ is sent across the rows and $L D$ down the columns of the
+/// trailing matrix, which is updated with lookahead.
+///
+/// Complexity (in real): $\approx \frac{1}{3} n^{3}$ flops.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the n-by-n Hermitian matrix $A$.
+///     On exit, if return value = 0, $D$ on the diagonal and the factor
+///     $L$ below it; the unit diagonal elements of $L$ are not stored.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::Lookahead:
+///       Number of panels to overlap with matrix updates.
+///       lookahead >= 0. Default 1.
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// @return 0: successful exit
+/// @return i > 0: $D(i,i)$ is exactly zero, where $i$ is a 1-based index.
+///         The factorization will have NaN due to division by zero.
+///
+/// @ingroup hesv_computational
+///
+template <typename scalar_t>
+int64_t hetrf_nopiv(
+    HermitianMatrix<scalar_t>& A,
+    Options const& opts )
+{
+    perf::Region perf_region( "hetrf_nopiv" );
+
+    Target target = get_option( opts, Option::Target, Target::HostTask );
+
+    switch (target) {
+        case Target::Host:
+        case Target::HostTask:
+            return impl::hetrf_nopiv<Target::HostTask>( A, opts );
+
+        case Target::HostNest:
+            return impl::hetrf_nopiv<Target::HostNest>( A, opts );
+
+        case Target::HostBatch:
+            return impl::hetrf_nopiv<Target::HostBatch>( A, opts );
+
+        case Target::Devices:
+            return impl::hetrf_nopiv<Target::Devices>( A, opts );
+    }
+    return -2;  // shouldn't happen
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t hetrf_nopiv<float>(
+    HermitianMatrix<float>& A,
+    Options const& opts);
+
+template
+int64_t hetrf_nopiv<double>(
+    HermitianMatrix<double>& A,
+    Options const& opts);
+
+template
+int64_t hetrf_nopiv< std::complex<float> >(
+    HermitianMatrix< std::complex<float> >& A,
+    Options const& opts);
+
+template
+int64_t hetrf_nopiv< std::complex<double> >(
+    HermitianMatrix< std::complex<double> >& A,
+    Options const& opts);
+
+} // namespace slate
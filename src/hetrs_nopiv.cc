@@ -0,0 +1,124 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "slate/HermitianMatrix.hh"
+#include "slate/TriangularMatrix.hh"
+#include "internal/internal.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel Hermitian $L D L^H$ solve without pivoting.
+///
+/// Solves a system of linear equations
+/// \[
+///     A X = B
+/// \]
+/// with a Hermitian matrix $A$ using the factorization $A = L D L^H$
+/// computed by hetrf_nopiv.
+///
+/// Complexity (in real): $2 n^{2} r$ flops.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     The n-by-n factors $D$ and $L$ from the factorization $A = L D L^H$,
+///     computed by hetrf_nopiv.
+///
+/// @param[in,out] B
+///     On entry, the n-by-nrhs right hand side matrix $B$.
+///     On exit, the n-by-nrhs solution matrix $X$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::Lookahead:
+///       Number of panels to overlap with matrix updates.
+///       lookahead >= 0. Default 1.
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// @ingroup hesv_computational
+///
+template <typename scalar_t>
+void hetrs_nopiv(HermitianMatrix<scalar_t>& A,
+                 Matrix<scalar_t>& B,
+                 Options const& opts)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    perf::Region perf_region( "hetrs_nopiv" );
+
+    // Constants
+    const scalar_t one  = 1;
+    const real_t r_zero = 0;
+    const real_t r_one  = 1;
+
+    assert(B.mt() == A.mt());
+    slate_error_if( A.uplo() != Uplo::Lower );
+
+    // Gather D^{-1} from the diagonal tiles; each entry has one owner.
+    std::vector<real_t> Dinv( A.n(), r_zero );
+    int64_t ii = 0;
+    for (int64_t i = 0; i < A.nt(); ++i) {
+        if (A.tileIsLocal( i, i )) {
+            A.tileGetForReading( i, i, LayoutConvert::ColMajor );
+            auto Aii = A( i, i );
+            for (int64_t jj = 0; jj < Aii.nb(); ++jj)
+                Dinv[ ii + jj ] = r_one / blas::real( Aii( jj, jj ) );
+        }
+        ii += A.tileNb( i );
+    }
+    slate_mpi_call(
+        MPI_Allreduce( MPI_IN_PLACE, Dinv.data(), Dinv.size(),
+                       mpi_type<real_t>::value, MPI_SUM, A.mpiComm() ) );
+    // Column scaling is not applied, but must be sized for B.
+    std::vector<real_t> C( B.n(), r_one );
+
+    auto L = TriangularMatrix<scalar_t>( Diag::Unit, A );
+    auto LH = conj_transpose( L );
+
+    trsm( Side::Left, one, L, B, opts );
+
+    scale_row_col( Equed::Row, Dinv, C, B, opts );
+
+    trsm( Side::Left, one, LH, B, opts );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void hetrs_nopiv<float>(
+    HermitianMatrix<float>& A,
+    Matrix<float>& B,
+    Options const& opts);
+
+template
+void hetrs_nopiv<double>(
+    HermitianMatrix<double>& A,
+    Matrix<double>& B,
+    Options const& opts);
+
+template
+void hetrs_nopiv< std::complex<float> >(
+    HermitianMatrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& B,
+    Options const& opts);
+
+template
+void hetrs_nopiv< std::complex<double> >(
+    HermitianMatrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& B,
+    Options const& opts);
+
+} // namespace slate
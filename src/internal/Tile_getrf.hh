@@ -12,7 +12,10 @@
 #include "slate/types.hh"
 #include "slate/internal/util.hh"
 
+#include <functional>
 #include <list>
+#include <map>
+#include <mutex>
 
 #include <blas.hh>
 #include <lapack.hh>
@@ -94,9 +97,262 @@ void getrf_swap(
     }
 }
 
+//------------------------------------------------------------------------------
+/// Pivot candidates of one column, reduced across the panel's ranks by a
+/// single MPI_Allreduce in getrf. The struct is followed in memory by three
+/// rows of nb entries each: the max candidate's row, the root's
+/// candidate row, and the root's current row j. Those rows replace the
+/// separate pivot, row swap, and top row messages.
+///
+template <typename scalar_t>
+struct PivotCandidates {
+    using real_t = blas::real_type<scalar_t>;
+
+    real_t  diag_value; ///< root: |A(j, j)|; others: threshold * local max
+    int     diag_rank;
+    real_t  max_value;  ///< root: local max; others: threshold * local max
+    int     max_rank;
+    int     root_rank;  ///< rank that set root_pivot and its rows, or -1
+    int64_t nb;         ///< length of each row
+    AuxPivot<scalar_t> max_pivot;
+    AuxPivot<scalar_t> root_pivot;
+
+    /// @return size in bytes of the struct and its rows.
+    static size_t bytes( int64_t nb )
+    {
+        return roundup( sizeof(PivotCandidates) + 3*nb*sizeof(scalar_t),
+                        alignof(PivotCandidates) );
+    }
+
+    scalar_t* max_row()        { return reinterpret_cast<scalar_t*>( this + 1 ); }
+    scalar_t* root_pivot_row() { return max_row() + nb; }
+    scalar_t* root_row()       { return max_row() + 2*nb; }
+};
+
+//------------------------------------------------------------------------------
+/// MPI reduction operation for PivotCandidates.
+/// Applies MAXLOC semantics (ties go to the lower rank) to both the
+/// diagonal and the max candidates, carrying the max candidate's pivot
+/// and row along, and passes the root's fields through.
+///
+template <typename scalar_t>
+void mpi_reduce_pivot_candidates(
+    void* invec, void* inoutvec, int* len, MPI_Datatype* datatype)
+{
+    char* in    = static_cast<char*>( invec );
+    char* inout = static_cast<char*>( inoutvec );
+    for (int i = 0; i < *len; ++i) {
+        auto* a = reinterpret_cast< PivotCandidates<scalar_t>* >( in );
+        auto* b = reinterpret_cast< PivotCandidates<scalar_t>* >( inout );
+        int64_t nb = a->nb;
+
+        if (a->diag_value > b->diag_value
+            || (a->diag_value == b->diag_value && a->diag_rank < b->diag_rank)) {
+            b->diag_value = a->diag_value;
+            b->diag_rank  = a->diag_rank;
+        }
+        if (a->max_value > b->max_value
+            || (a->max_value == b->max_value && a->max_rank < b->max_rank)) {
+            b->max_value = a->max_value;
+            b->max_rank  = a->max_rank;
+            b->max_pivot = a->max_pivot;
+            std::copy( a->max_row(), a->max_row() + nb, b->max_row() );
+        }
+        if (a->root_rank >= 0) {
+            b->root_rank  = a->root_rank;
+            b->root_pivot = a->root_pivot;
+            std::copy( a->root_pivot_row(), a->root_pivot_row() + 2*nb,
+                       b->root_pivot_row() );
+        }
+        in    += PivotCandidates<scalar_t>::bytes( nb );
+        inout += PivotCandidates<scalar_t>::bytes( nb );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @return MPI reduction operation for PivotCandidates<scalar_t>.
+/// Created on first use and kept for the life of the program,
+/// like the predefined types in mpi_type.
+///
+template <typename scalar_t>
+MPI_Op mpi_pivot_candidates_op()
+{
+    static MPI_Op op = [] {
+        MPI_Op new_op;
+        slate_mpi_call(
+            MPI_Op_create( mpi_reduce_pivot_candidates<scalar_t>, true,
+                           &new_op ));
+        return new_op;
+    }();
+    return op;
+}
+
+//------------------------------------------------------------------------------
+/// @return MPI datatype of one PivotCandidates record of the given size in
+/// bytes. Created on first use for each size and kept for the life of the
+/// program, so panels don't create and free a datatype on every call.
+///
+inline MPI_Datatype mpi_pivot_candidates_type( size_t bytes )
+{
+    static std::mutex mutex;
+    static std::map< size_t, MPI_Datatype > types;
+
+    std::lock_guard< std::mutex > guard( mutex );
+    auto iter = types.find( bytes );
+    if (iter != types.end())
+        return iter->second;
+
+    MPI_Datatype type;
+    slate_mpi_call(
+        MPI_Type_contiguous( bytes, MPI_BYTE, &type ));
+    slate_mpi_call(
+        MPI_Type_commit( &type ));
+    types[ bytes ] = type;
+    return type;
+}
+
+//------------------------------------------------------------------------------
+/// Find the pivot of column j and apply the row swap, using one
+/// MPI_Allreduce of PivotCandidates instead of an MPI_Allreduce,
+/// an MPI_Bcast of the pivot, a point-to-point row swap, and an MPI_Bcast
+/// of the top row. Called by thread 0 of each rank in the panel.
+/// Selects the same pivot as the unfused path in getrf.
+///
+/// On exit, every rank holds the pivot row, which is now row j of the
+/// diagonal tile, in row j of pivot_rows.
+///
+/// @param[in] j
+///     column of the panel
+///
+/// @param[in] local_max
+///     this rank's largest entry in column j, from the thread reduction
+///
+/// @param[in] local_index
+///     index in tiles of the tile containing local_max
+///
+/// @param[in] local_offset
+///     row offset of local_max in its tile
+///
+/// @param[in,out] in, out
+///     buffers of PivotCandidates<scalar_t>::bytes( nb ) bytes
+///
+/// @param[out] pivot_rows
+///     pivot rows of the panel, a column-major array with leading dimension ld
+///
+/// @param[in] ld
+///     leading dimension of pivot_rows, at least the panel diagonal length
+///
+template <typename scalar_t>
+void getrf_fused_pivot(
+    int64_t j,
+    std::vector< Tile<scalar_t> >& tiles,
+    std::vector<int64_t>& tile_indices,
+    std::vector< AuxPivot<scalar_t> >& pivot,
+    int mpi_rank, int mpi_root, MPI_Comm mpi_comm,
+    scalar_t local_max, int64_t local_index, int64_t local_offset,
+    blas::real_type<scalar_t> pivot_threshold,
+    PivotCandidates<scalar_t>* in, PivotCandidates<scalar_t>* out,
+    MPI_Datatype candidates_type, MPI_Op candidates_op,
+    scalar_t* pivot_rows, int64_t ld)
+{
+    bool root = mpi_rank == mpi_root;
+    auto diag_tile = tiles[0];
+    auto max_tile = tiles[local_index];
+    int64_t nb = diag_tile.nb();
+
+    in->nb = nb;
+    in->diag_rank = mpi_rank;
+    in->max_rank  = mpi_rank;
+    in->max_pivot = AuxPivot<scalar_t>(tile_indices[local_index],
+                                       local_offset, local_index,
+                                       local_max, mpi_rank);
+    blas::copy(nb, &max_tile.at(local_offset, 0), max_tile.stride(),
+               in->max_row(), 1);
+    if (root) {
+        // The root's pivot, if its diagonal beats the other ranks:
+        // the diagonal, unless it is below threshold * local max.
+        in->diag_value = cabs1(diag_tile(j, j));
+        in->max_value  = cabs1(local_max);
+        in->root_rank  = mpi_rank;
+        if (in->diag_value >= cabs1(local_max)*pivot_threshold) {
+            in->root_pivot = AuxPivot<scalar_t>(tile_indices[0], j, 0,
+                                                diag_tile(j, j), mpi_rank);
+            blas::copy(nb, &diag_tile.at(j, 0), diag_tile.stride(),
+                       in->root_pivot_row(), 1);
+        }
+        else {
+            in->root_pivot = in->max_pivot;
+            std::copy(in->max_row(), in->max_row() + nb,
+                      in->root_pivot_row());
+        }
+        blas::copy(nb, &diag_tile.at(j, 0), diag_tile.stride(),
+                   in->root_row(), 1);
+    }
+    else {
+        in->diag_value = cabs1(local_max)*pivot_threshold;
+        in->max_value  = in->diag_value;
+        in->root_rank  = -1;
+    }
+
+    slate_mpi_call(
+        MPI_Allreduce(in, out, 1, candidates_type, candidates_op, mpi_comm));
+
+    // If the diagonal isn't good enough for the remote entries,
+    // use the max candidate; otherwise, use the root's choice.
+    scalar_t* pivot_row;
+    if (out->diag_rank != mpi_root) {
+        pivot[j] = out->max_pivot;
+        pivot_row = out->max_row();
+    }
+    else {
+        pivot[j] = out->root_pivot;
+        pivot_row = out->root_pivot_row();
+    }
+
+    // pivot swap, taking remote rows from the reduction
+    if (root) {
+        if (pivot[j].rank() == mpi_rank) {
+            if (pivot[j].localTileIndex() > 0 ||
+                pivot[j].elementOffset() > j)
+            {
+                swapLocalRow(0, nb,
+                             tiles[0], j,
+                             tiles[pivot[j].localTileIndex()],
+                             pivot[j].elementOffset());
+            }
+        }
+        else {
+            blas::copy(nb, pivot_row, 1,
+                       &diag_tile.at(j, 0), diag_tile.stride());
+        }
+    }
+    else if (pivot[j].rank() == mpi_rank) {
+        auto pivot_tile = tiles[pivot[j].localTileIndex()];
+        blas::copy(nb, out->root_row(), 1,
+                   &pivot_tile.at(pivot[j].elementOffset(), 0),
+                   pivot_tile.stride());
+    }
+
+    blas::copy(nb, pivot_row, 1, &pivot_rows[j], ld);
+}
+
 //------------------------------------------------------------------------------
 /// Compute the LU factorization of a panel.
 ///
+/// When the panel spans several MPI ranks, the pivot search, row swap, and
+/// top row broadcast of each column are fused into one MPI_Allreduce
+/// (see getrf_fused_pivot), and since every rank then holds the pivot rows,
+/// top blocks are solved locally rather than broadcast.
+/// This replaces 3 collectives plus a swap per column with 1 collective.
+///
+/// The columns are factored recursively (Toledo's algorithm): the left half
+/// is factored, the right half is updated by trsm and gemm, then the right
+/// half is factored, down to leaves of ib columns that are factored one
+/// column at a time. Compared to ib-wide stripes, most of the update is
+/// done by gemm with a larger inner dimension. The threads synchronize once
+/// per recursion node: thread 0 factors each ib-wide leaf, which needs
+/// only BLAS-2 work on ib columns, while all threads share the gemm updates.
+///
 /// @param[in] diag_len
 ///     length of the panel diagonal
 ///
@@ -141,15 +397,16 @@ void getrf_swap(
 ///     workspace for per-thread pivot offset
 ///     (pivot offset in the tile)
 ///
-/// @param[in] tob_block
+/// @param[in] top_block
 ///     workspace for broadcasting the top row for the geru operation
-///     and the top block for the gemm operation.
+///     and the top block for the gemm operation,
+///     of size at least diag_len * nb.
 ///
 /// @param[in] pivot_threshold
 ///     threshold for pivoting.  1 is partial pivoting, 0 is no pivoting
 ///
 /// @param[in,out] info
-///     Exit status, updated by only the thread with the diagonal tile.
+///     Exit status, updated by only thread 0.
 ///     * 0: successful exit
 ///     * i > 0: U(i,i) is exactly zero (1-based index). The factorization
 ///       has been completed but the factor U is exactly singular.
@@ -184,14 +441,41 @@ void getrf(
 
     *info = 0;
 
-    // Loop over ib-wide stripes.
-    for (int64_t k = 0; k < diag_len; k += ib) {
-
-        //=======================
-        // ib panel factorization
-        int64_t kb = std::min(diag_len-k, ib);
+    // Panels spanning several ranks use the fused pivot search,
+    // with workspace used only by thread 0. pivot_rows holds the pivot
+    // rows as selected, a diag_len-by-nb column-major array.
+    bool fused = false;
+    std::vector<char> candidates;
+    std::vector<scalar_t> pivot_rows;
+    PivotCandidates<scalar_t>* cand_in = nullptr;
+    PivotCandidates<scalar_t>* cand_out = nullptr;
+    MPI_Datatype candidates_type = MPI_DATATYPE_NULL;
+    MPI_Op candidates_op = MPI_OP_NULL;
+    if (thread_rank == 0) {
+        int comm_size;
+        slate_mpi_call(MPI_Comm_size(mpi_comm, &comm_size));
+        fused = comm_size > 1;
+        if (fused) {
+            size_t bytes = PivotCandidates<scalar_t>::bytes(nb);
+            candidates.resize(2*bytes);
+            cand_in  = reinterpret_cast< PivotCandidates<scalar_t>* >(
+                           candidates.data() );
+            cand_out = reinterpret_cast< PivotCandidates<scalar_t>* >(
+                           candidates.data() + bytes );
+            pivot_rows.resize(diag_len*nb);
+            candidates_type = mpi_pivot_candidates_type(bytes);
+            candidates_op = mpi_pivot_candidates_op<scalar_t>();
+        }
+    }
 
-        // Loop over ib columns of a stripe.
+    //--------------------
+    // Factor the leaf of columns [k, k+kb), one column at a time,
+    // with BLAS-2 updates restricted to the leaf's columns.
+    // Each thread searches and updates its own tiles; only the pivot
+    // reduction, swap, and top row run on thread 0, inside the one
+    // barrier per column. A thread's max search reads only columns its
+    // own updates wrote, so no other barrier is needed.
+    auto factor_leaf = [&]( int64_t k, int64_t kb ) {
         for (int64_t j = k; j < k+kb; ++j) {
 
             if (root && thread_rank == 0) {
@@ -214,32 +498,18 @@ void getrf(
                 auto tile = tiles[idx];
                 auto i_index = tile_indices[idx];
 
-                // if diagonal tile
-                if (i_index == 0) {
-                    for (int64_t i = j+1; i < tile.mb(); ++i) {
-                        if (cabs1(tile(i, j)) > cabs1(max_value[thread_rank])) {
-                            max_value[thread_rank] = tile(i, j);
-                            max_index[thread_rank] = idx;
-                            max_offset[thread_rank] = i;
-                        }
-                    }
-                }
-                // off diagonal tiles
-                else {
-                    for (int64_t i = 0; i < tile.mb(); ++i) {
-                        if (cabs1(tile(i, j)) > cabs1(max_value[thread_rank])) {
-                            max_value[thread_rank] = tile(i, j);
-                            max_index[thread_rank] = idx;
-                            max_offset[thread_rank] = i;
-                        }
+                // diagonal tile starts below the diagonal
+                int64_t i_begin = (i_index == 0 ? j+1 : 0);
+                for (int64_t i = i_begin; i < tile.mb(); ++i) {
+                    if (cabs1(tile(i, j)) > cabs1(max_value[thread_rank])) {
+                        max_value[thread_rank] = tile(i, j);
+                        max_index[thread_rank] = idx;
+                        max_offset[thread_rank] = i;
                     }
                 }
             }
-            thread_barrier.wait(thread_size);
 
-            //------------------------------------
-            // global max reduction and pivot swap
-            if (thread_rank == 0) {
+            thread_barrier.wait(thread_size, thread_rank, [&] {
                 // threads max reduction
                 for (int rank = 1; rank < thread_size; ++rank) {
                     if (cabs1(max_value[rank]) > cabs1(max_value[0])) {
@@ -249,80 +519,97 @@ void getrf(
                     }
                 }
 
-                // MPI max abs reduction
-                // Do two reductions that differ in the root's value
-                // * the diagonal entry
-                // * the largest entry
-                struct { real_t max; int loc; } max_loc_in[2], max_loc[2];
-                if (mpi_rank == mpi_root) {
-                    max_loc_in[0].max = cabs1(tiles[0](j, j));
-                    max_loc_in[1].max = cabs1(max_value[0]);
-                }
-                else {
-                    max_loc_in[0].max = cabs1(max_value[0])*pivot_threshold;
-                    max_loc_in[1].max = max_loc_in[0].max;
-                }
-                max_loc_in[0].loc = mpi_rank;
-                max_loc_in[1].loc = mpi_rank;
-                slate_mpi_call(
-                    MPI_Allreduce(max_loc_in, max_loc, 2,
-                                  mpi_type< max_loc_type<real_t> >::value,
-                                  MPI_MAXLOC, mpi_comm));
-
-                int bcast_rank;
-                if (max_loc[0].loc != mpi_root) {
-                    // if diagonal isn't good enough for the remote entries,
-                    // use the result of the second reduction
-                    bcast_rank = max_loc[1].loc;
+                //------------------------------------
+                // global max reduction and pivot swap
+                if (fused) {
+                    getrf_fused_pivot(j, tiles, tile_indices, pivot,
+                                      mpi_rank, mpi_root, mpi_comm,
+                                      max_value[0], max_index[0],
+                                      max_offset[0], pivot_threshold,
+                                      cand_in, cand_out,
+                                      candidates_type, candidates_op,
+                                      pivot_rows.data(), diag_len);
+
+                    // The top row for the geru operation is the pivot row.
+                    if (k+kb > j+1) {
+                        blas::copy(k+kb-j-1,
+                                   &pivot_rows[j + (j+1)*diag_len], diag_len,
+                                   top_block.data(), 1);
+                    }
                 }
                 else {
-                    bcast_rank = mpi_root;
-
-                    // if the diagonal is good enough for the local entries,
-                    // update that max_* variables on the root
-                    if (mpi_rank == mpi_root
-                        && max_loc[0].max >= cabs1(max_value[0])*pivot_threshold) {
-                        max_offset[0] = j;
-                        max_index[0] = 0;
-                        max_value[0] = tiles[0](j, j);
+                    // MPI max abs reduction
+                    // Do two reductions that differ in the root's value
+                    // * the diagonal entry
+                    // * the largest entry
+                    struct { real_t max; int loc; } max_loc_in[2], max_loc[2];
+                    if (mpi_rank == mpi_root) {
+                        max_loc_in[0].max = cabs1(tiles[0](j, j));
+                        max_loc_in[1].max = cabs1(max_value[0]);
                     }
-                }
-
-
-                // todo: can this Bcast info be merged into the Allreduce?
-                // Broadcast the pivot information.
-                pivot[j] = AuxPivot<scalar_t>(tile_indices[max_index[0]],
-                                              max_offset[0],
-                                              max_index[0],
-                                              max_value[0],
-                                              bcast_rank);
-                slate_mpi_call(
-                    MPI_Bcast(&pivot[j], sizeof(AuxPivot<scalar_t>),
-                              MPI_BYTE, bcast_rank, mpi_comm));
-
-                // pivot swap
-                getrf_swap(j, 0, nb,
-                           tiles, pivot,
-                           mpi_rank, mpi_root, mpi_comm);
-
-                // Broadcast the top row for the geru operation.
-                if (k+kb > j+1) {
-                    if (root) {
-                        auto top_tile = tiles[0];
-                        // todo: make it a tile operation
-                        blas::copy(k+kb-j-1,
-                                   &top_tile.at(j, j+1), top_tile.stride(),
-                                   top_block.data(), 1);
+                    else {
+                        max_loc_in[0].max = cabs1(max_value[0])*pivot_threshold;
+                        max_loc_in[1].max = max_loc_in[0].max;
                     }
+                    max_loc_in[0].loc = mpi_rank;
+                    max_loc_in[1].loc = mpi_rank;
                     slate_mpi_call(
-                        MPI_Bcast(top_block.data(),
-                                  k+kb-j-1, mpi_type<scalar_t>::value,
-                                  mpi_root, mpi_comm));
+                        MPI_Allreduce(max_loc_in, max_loc, 2,
+                                      mpi_type< max_loc_type<real_t> >::value,
+                                      MPI_MAXLOC, mpi_comm));
+
+                    int bcast_rank;
+                    if (max_loc[0].loc != mpi_root) {
+                        // if diagonal isn't good enough for the remote
+                        // entries, use the result of the second reduction
+                        bcast_rank = max_loc[1].loc;
+                    }
+                    else {
+                        bcast_rank = mpi_root;
+
+                        // if the diagonal is good enough for the local
+                        // entries, update that max_* variables on the root
+                        if (mpi_rank == mpi_root
+                            && max_loc[0].max >= cabs1(max_value[0])*pivot_threshold) {
+                            max_offset[0] = j;
+                            max_index[0] = 0;
+                            max_value[0] = tiles[0](j, j);
+                        }
+                    }
+
+                    // Broadcast the pivot information.
+                    pivot[j] = AuxPivot<scalar_t>(tile_indices[max_index[0]],
+                                                  max_offset[0],
+                                                  max_index[0],
+                                                  max_value[0],
+                                                  bcast_rank);
+                    slate_mpi_call(
+                        MPI_Bcast(&pivot[j], sizeof(AuxPivot<scalar_t>),
+                                  MPI_BYTE, bcast_rank, mpi_comm));
+
+                    // pivot swap
+                    getrf_swap(j, 0, nb,
+                               tiles, pivot,
+                               mpi_rank, mpi_root, mpi_comm);
+
+                    // Broadcast the top row for the geru operation.
+                    if (k+kb > j+1) {
+                        if (root) {
+                            auto top_tile = tiles[0];
+                            // todo: make it a tile operation
+                            blas::copy(k+kb-j-1,
+                                       &top_tile.at(j, j+1), top_tile.stride(),
+                                       top_block.data(), 1);
+                        }
+                        slate_mpi_call(
+                            MPI_Bcast(top_block.data(),
+                                      k+kb-j-1, mpi_type<scalar_t>::value,
+                                      mpi_root, mpi_comm));
+                    }
                 }
-            }
-            thread_barrier.wait(thread_size);
+            });
 
-            // column scaling and trailing update
+            // column scaling and trailing update on this thread's tiles
             for (int64_t idx = thread_rank;
                  idx < int64_t(tiles.size());
                  idx += thread_size)
@@ -384,66 +671,110 @@ void getrf(
                     }
                 }
             }
-            // Next instructions only use thread's assigned tiles
-            // So no thread barrier is needed here
         }
-
-        // If there is a trailing submatrix.
-        if (k+kb < nb) {
-            if (thread_rank == 0) {
+    };
+
+    //--------------------
+    // Update columns [c, c+cn) using the factored columns [k, k+kb):
+    // the top block U12 = L11^{-1} A12, then A22 -= L21 U12.
+    auto update_right = [&]( int64_t k, int64_t kb, int64_t c, int64_t cn ) {
+        thread_barrier.wait(thread_size, thread_rank, [&] {
+            auto top_tile = tiles[0];
+            if (fused) {
+                // Every rank holds the pivot rows, so each solves for
+                // the top block locally instead of broadcasting it.
+                lapack::lacpy(lapack::MatrixType::General,
+                              kb, cn,
+                              &pivot_rows[k + c*diag_len], diag_len,
+                              top_block.data(), kb);
+                blas::trsm(Layout::ColMajor,
+                           Side::Left, Uplo::Lower,
+                           Op::NoTrans, Diag::Unit,
+                           kb, cn,
+                           one, &pivot_rows[k + k*diag_len], diag_len,
+                                top_block.data(), kb);
+                if (root) {
+                    lapack::lacpy(lapack::MatrixType::General,
+                                  kb, cn,
+                                  top_block.data(), kb,
+                                  &top_tile.at(k, c), top_tile.stride());
+                }
+            }
+            else {
                 if (root) {
                     // triangular solve
-                    auto top_tile = tiles[0];
                     blas::trsm(Layout::ColMajor,
                                Side::Left, Uplo::Lower,
                                Op::NoTrans, Diag::Unit,
-                               kb, nb-k-kb,
+                               kb, cn,
                                one, &top_tile.at(k, k), top_tile.stride(),
-                                    &top_tile.at(k, k+kb), top_tile.stride());
+                                    &top_tile.at(k, c), top_tile.stride());
 
                     // Broadcast the top block for gemm.
                     lapack::lacpy(lapack::MatrixType::General,
-                                  kb, nb-k-kb,
-                                  &top_tile.at(k, k+kb), top_tile.stride(),
+                                  kb, cn,
+                                  &top_tile.at(k, c), top_tile.stride(),
                                   top_block.data(), kb);
                 }
                 slate_mpi_call(
                     MPI_Bcast(top_block.data(),
-                              kb*(nb-k-kb), mpi_type<scalar_t>::value,
+                              kb*cn, mpi_type<scalar_t>::value,
                               mpi_root, mpi_comm));
             }
-            thread_barrier.wait(thread_size);
-
-            //============================
-            // rank-ib update to the right
-            for (int64_t idx = thread_rank;
-                 idx < int64_t(tiles.size());
-                 idx += thread_size)
-            {
-                auto tile = tiles[idx];
-                auto i_index = tile_indices[idx];
-
-                if (i_index == 0) {
-                    if (k+kb < tile.mb()) {
-                        blas::gemm(blas::Layout::ColMajor,
-                                   Op::NoTrans, Op::NoTrans,
-                                   tile.mb()-k-kb, nb-k-kb, kb,
-                                   -one, &tile.at( k+kb, k    ), tile.stride(),
-                                         &tile.at( k,    k+kb ), tile.stride(),
-                                   one,  &tile.at( k+kb, k+kb ), tile.stride());
-                    }
-                }
-                else {
+        });
+
+        //============================
+        // rank-kb update to the right
+        for (int64_t idx = thread_rank;
+             idx < int64_t(tiles.size());
+             idx += thread_size)
+        {
+            auto tile = tiles[idx];
+            auto i_index = tile_indices[idx];
+
+            if (i_index == 0) {
+                if (k+kb < tile.mb()) {
                     blas::gemm(blas::Layout::ColMajor,
                                Op::NoTrans, Op::NoTrans,
-                               tile.mb(), nb-k-kb, kb,
-                               -one, &tile.at(0, k), tile.stride(),
-                                     top_block.data(), kb,
-                               one,  &tile.at(0, k+kb), tile.stride());
+                               tile.mb()-k-kb, cn, kb,
+                               -one, &tile.at( k+kb, k ), tile.stride(),
+                                     &tile.at( k,    c ), tile.stride(),
+                               one,  &tile.at( k+kb, c ), tile.stride());
                 }
             }
+            else {
+                blas::gemm(blas::Layout::ColMajor,
+                           Op::NoTrans, Op::NoTrans,
+                           tile.mb(), cn, kb,
+                           -one, &tile.at(0, k), tile.stride(),
+                                 top_block.data(), kb,
+                           one,  &tile.at(0, c), tile.stride());
+            }
         }
-    }
+    };
+
+    //--------------------
+    // Recursive (Toledo-style) factorization of columns [k, k+kb):
+    // factor the left half, update the right half, factor the right half.
+    // Leaves are ib columns wide; above them, all updates are gemm.
+    std::function<void (int64_t, int64_t)> factor;
+    factor = [&]( int64_t k, int64_t kb ) {
+        if (kb <= ib) {
+            factor_leaf(k, kb);
+        }
+        else {
+            int64_t kb1 = (kb/ib + 1)/2 * ib;
+            factor(k, kb1);
+            update_right(k, kb1, k+kb1, kb-kb1);
+            factor(k+kb1, kb-kb1);
+        }
+    };
+    factor(0, diag_len);
+
+    // If there is a trailing submatrix.
+    if (diag_len < nb)
+        update_right(0, diag_len, diag_len, nb-diag_len);
+
 }
 
 } // namespace tile
@@ -0,0 +1,66 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef SLATE_TILE_HETRF_NOPIV_HH
+#define SLATE_TILE_HETRF_NOPIV_HH
+
+#include "internal/internal.hh"
+#include "slate/Tile.hh"
+#include "slate/types.hh"
+
+#include <blas.hh>
+#include <lapack.hh>
+
+namespace slate {
+namespace tile {
+
+//------------------------------------------------------------------------------
+/// Compute the $L D L^H$ factorization of a Hermitian tile without pivoting.
+/// Only the lower triangle is referenced and overwritten: on exit, $D$ is on
+/// the diagonal and the unit lower triangular $L$ is below it.
+///
+/// @param[in,out] tile
+///     tile to factor
+///
+/// @param[in,out] info
+///     Exit status.
+///     * 0: successful exit
+///     * i > 0: D(i,i) is exactly zero (1-based index). The factorization
+///       will have NaN due to division by zero.
+///
+/// @ingroup hesv_tile
+///
+template <typename scalar_t>
+void hetrf_nopiv(
+    Tile<scalar_t> tile, int64_t* info )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    const real_t r_zero = 0.0;
+    const real_t r_one  = 1.0;
+    int64_t nb = tile.nb();
+    int64_t lda = tile.stride();
+
+    for (int64_t j = 0; j < nb; ++j) {
+        // Detect exact singularity.
+        real_t d = blas::real( tile( j, j ) );
+        tile.at( j, j ) = d;
+        if (*info == 0 && d == r_zero)
+            *info = j + 1;
+
+        if (j+1 < nb) {
+            // A(j+1:nb, j+1:nb) -= d l l^H, where l = A(j+1:nb, j) / d.
+            blas::scal( nb-j-1, r_one/d, &tile.at( j+1, j ), 1 );
+            blas::her( Layout::ColMajor, Uplo::Lower, nb-j-1,
+                       -d, &tile.at( j+1, j ), 1,
+                           &tile.at( j+1, j+1 ), lda );
+        }
+    }
+}
+
+} // namespace tile
+} // namespace slate
+
+#endif // SLATE_TILE_HETRF_NOPIV_HH
@@ -17,6 +17,7 @@
 #include "slate/TriangularMatrix.hh"
 #include "slate/TriangularBandMatrix.hh"
 #include "slate/BandMatrix.hh"
+#include "slate/internal/PanelTeam.hh"
 #include "lapack.hh"
 
 namespace slate {
@@ -400,6 +401,9 @@ std::pair<Matrix<scalar_t>, Matrix<scalar_t>> rbt_generate(
         const int64_t d,
         const int64_t seed);
 
+template <typename scalar_t>
+void randn(Matrix<scalar_t>& A, int64_t seed);
+
 //------------------------------------------------------------------------------
 // Bidiagonal band reduction
 template <Target target, typename scalar_t>
@@ -483,7 +487,8 @@ void getrf_panel(
     Matrix<scalar_t>&& A, int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
     blas::real_type<scalar_t> remote_pivot_threshold,
-    int max_panel_threads, int priority, int tag, int64_t* info );
+    int max_panel_threads, int priority, int tag, int64_t* info,
+    PanelTeam* panel_team=nullptr );
 
 //-----------------------------------------
 // getrf_nopiv()
@@ -507,7 +512,8 @@ void getrf_tntpiv_panel(
 template <Target target=Target::HostTask, typename scalar_t>
 void geqrf(Matrix<scalar_t>&& A, Matrix<scalar_t>&& T,
            std::vector< scalar_t* > dwork_array, size_t work_size,
-           int64_t ib, int max_panel_threads, int priority=0);
+           int64_t ib, int max_panel_threads, int priority=0,
+           PanelTeam* panel_team=nullptr);
 
 //-----------------------------------------
 // For backwards compatibility of
@@ -638,6 +644,13 @@ int64_t potrf(
     int priority=0, int64_t queue_index=0,
     lapack::device_info_int* device_info=nullptr );
 
+//-----------------------------------------
+// hetrf_nopiv()
+template <Target target=Target::HostTask, typename scalar_t>
+void hetrf_nopiv(
+    HermitianMatrix<scalar_t>&& A,
+    int priority, int64_t* info );
+
 //-----------------------------------------
 // hegst()
 template <Target target=Target::HostTask, typename scalar_t>
@@ -655,6 +668,15 @@ void norm1est(
     int* kase,
     std::vector<int64_t>& isave );
 
+template <typename scalar_t>
+void norm1est_block(
+    Matrix<scalar_t>& X,
+    Matrix<scalar_t>& S,
+    blas::real_type<scalar_t>* one_normest,
+    int* kase,
+    std::vector<int64_t>& isave,
+    std::vector<int64_t>& ind_hist );
+
 //------------------------------------------------------------------------------
 // MPI reduce info, used in getrf, hetrf, etc.
 void reduce_info( int64_t* info, MPI_Comm mpi_comm );
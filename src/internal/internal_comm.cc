@@ -5,6 +5,8 @@
 
 #include "slate/Exception.hh"
 #include "slate/internal/comm.hh"
+#include "slate/internal/MpiProgress.hh"
+#include "slate/internal/Perf.hh"
 #include "internal/internal_util.hh"
 #include "slate/internal/Trace.hh"
 
@@ -23,15 +25,17 @@ MPI_Comm commFromSet(const std::set<int>& bcast_set,
 
     // Create the broadcast group.
     MPI_Group bcast_group;
-    #pragma omp critical(slate_mpi)
-    slate_mpi_call(
-        MPI_Group_incl(mpi_group, bcast_vec.size(), bcast_vec.data(),
-                       &bcast_group));
+    {
+        MpiCriticalGuard guard;
+        slate_mpi_call(
+            MPI_Group_incl(mpi_group, bcast_vec.size(), bcast_vec.data(),
+                           &bcast_group));
+    }
 
     // Create a broadcast communicator.
     MPI_Comm bcast_comm;
-    #pragma omp critical(slate_mpi)
     {
+        MpiCriticalGuard guard;
         trace::Block trace_block("MPI_Comm_create_group");
         slate_mpi_call(
             MPI_Comm_create_group(mpi_comm, bcast_group, tag, &bcast_comm));
@@ -39,10 +43,12 @@ MPI_Comm commFromSet(const std::set<int>& bcast_set,
     assert(bcast_comm != MPI_COMM_NULL);
 
     // Translate the input rank.
-    #pragma omp critical(slate_mpi)
-    slate_mpi_call(
-        MPI_Group_translate_ranks(mpi_group, 1, &in_rank,
-                                  bcast_group, &out_rank));
+    {
+        MpiCriticalGuard guard;
+        slate_mpi_call(
+            MPI_Group_translate_ranks(mpi_group, 1, &in_rank,
+                                      bcast_group, &out_rank));
+    }
 
     return bcast_comm;
 }
@@ -122,5 +128,44 @@ void cubeReducePattern(int size, int rank, int radix,
     cubeBcastPattern(size, rank, radix, send_to, recv_from);
 }
 
+//------------------------------------------------------------------------------
+/// Completes all requests, like MPI_Waitall.
+/// If mpi_progress() is enabled, the requests are handed to the MPI progress
+/// thread, and the calling task yields to other OpenMP tasks until they
+/// complete, rather than blocking its thread inside MPI.
+/// On return, all requests are MPI_REQUEST_NULL.
+///
+/// @param[in,out] requests
+///     Requests to complete. May include MPI_REQUEST_NULL.
+///
+void waitAll(std::vector<MPI_Request>& requests)
+{
+    perf::MpiWait perf_wait;
+
+    MpiProgress* progress = MpiProgress::engine();
+    if (progress == nullptr) {
+        slate_mpi_call(
+            MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE));
+        return;
+    }
+
+    trace::Block trace_block("MPI_Waitall");
+
+    std::vector<MPI_Request> active;
+    active.reserve( requests.size() );
+    for (auto& request : requests) {
+        if (request != MPI_REQUEST_NULL) {
+            active.push_back( request );
+            request = MPI_REQUEST_NULL;
+        }
+    }
+    if (active.empty())
+        return;
+
+    std::atomic<int> pending( int( active.size() ) );
+    progress->post( active, &pending );
+    progress->wait( &pending );
+}
+
 } // namespace internal
 } // namespace slate
@@ -0,0 +1,112 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+//------------------------------------------------------------------------------
+#ifndef SLATE_INTERNAL_COMPACT_BAND_HH
+#define SLATE_INTERNAL_COMPACT_BAND_HH
+
+#include "slate/CompactBandMatrix.hh"
+#include "slate/Matrix.hh"
+
+#include <vector>
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Checks that B is distributed to match the columns of compact band A,
+/// as from A.emptyRHS(), so each rank's rows are in its block row.
+///
+template <typename scalar_t>
+void compact_rhs_check(
+    BaseCompactBandMatrix<scalar_t> const& A, Matrix<scalar_t>& B)
+{
+    slate_assert( B.op() == Op::NoTrans );
+    slate_assert( B.m() == A.n() );
+    slate_assert( B.mt() == A.numRanks() );
+    for (int64_t i = 0; i < B.mt(); ++i) {
+        slate_assert( B.tileMb( i ) == std::min( A.nb(), A.n() - i*A.nb() ) );
+        for (int64_t j = 0; j < B.nt(); ++j)
+            slate_assert( B.tileRank( i, j ) == i );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Copies block row i of B, which is local, to the column-major array x.
+///
+template <typename scalar_t>
+void compact_rhs_get(
+    Matrix<scalar_t>& B, int64_t i, scalar_t* x, int64_t ldx)
+{
+    int64_t col = 0;
+    for (int64_t j = 0; j < B.nt(); ++j) {
+        B.tileGetForReading( i, j, LayoutConvert::ColMajor );
+        auto Bij = B( i, j );
+        lapack::lacpy( lapack::MatrixType::General, Bij.mb(), Bij.nb(),
+                       Bij.data(), Bij.stride(), &x[ col*ldx ], ldx );
+        col += Bij.nb();
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Copies the column-major array x to block row i of B, which is local.
+///
+template <typename scalar_t>
+void compact_rhs_set(
+    scalar_t const* x, int64_t ldx, Matrix<scalar_t>& B, int64_t i)
+{
+    int64_t col = 0;
+    for (int64_t j = 0; j < B.nt(); ++j) {
+        B.tileGetForWriting( i, j, LayoutConvert::ColMajor );
+        auto Bij = B( i, j );
+        lapack::lacpy( lapack::MatrixType::General, Bij.mb(), Bij.nb(),
+                       &x[ col*ldx ], ldx, Bij.data(), Bij.stride() );
+        col += Bij.nb();
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Sends an m-by-n block of the column-major array x to rank dst.
+///
+template <typename scalar_t>
+void compact_send_rows(
+    int64_t m, int64_t n, scalar_t const* x, int64_t ldx,
+    int dst, int tag, MPI_Comm mpi_comm)
+{
+    std::vector<scalar_t> buffer( m*n );
+    lapack::lacpy( lapack::MatrixType::General, m, n,
+                   x, ldx, buffer.data(), m );
+    slate_mpi_call(
+        MPI_Send( buffer.data(), m*n, mpi_type<scalar_t>::value,
+                  dst, tag, mpi_comm ) );
+}
+
+//------------------------------------------------------------------------------
+/// Receives an m-by-n block from rank src into the column-major array x.
+/// If add is true, adds the block to x, otherwise overwrites x.
+///
+template <typename scalar_t>
+void compact_recv_rows(
+    int64_t m, int64_t n, scalar_t* x, int64_t ldx,
+    int src, int tag, MPI_Comm mpi_comm, bool add)
+{
+    std::vector<scalar_t> buffer( m*n );
+    slate_mpi_call(
+        MPI_Recv( buffer.data(), m*n, mpi_type<scalar_t>::value,
+                  src, tag, mpi_comm, MPI_STATUS_IGNORE ) );
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < m; ++i) {
+            if (add)
+                x[ i + j*ldx ] += buffer[ i + j*m ];
+            else
+                x[ i + j*ldx ] = buffer[ i + j*m ];
+        }
+    }
+}
+
+} // namespace internal
+} // namespace slate
+
+#endif // SLATE_INTERNAL_COMPACT_BAND_HH
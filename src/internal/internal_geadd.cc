@@ -6,6 +6,7 @@
 #include "slate/internal/device.hh"
 #include "internal/internal_batch.hh"
 #include "internal/internal.hh"
+#include "internal/internal_util.hh"
 #include "slate/internal/util.hh"
 #include "slate/Matrix.hh"
 #include "internal/Tile_lapack.hh"
@@ -36,6 +37,7 @@ void add(scalar_t alpha, Matrix<scalar_t>&& A,
 /// assumes A & B have same tile layout and dimensions, and have same distribution
 /// TODO handle transpose A case
 /// Host OpenMP task implementation.
+/// With several host NUMA domains, tasks run in the domain owning B(i, j).
 /// @ingroup add_internal
 ///
 /// todo: this function should just be named "add".
@@ -52,6 +54,17 @@ void add(internal::TargetType<Target::HostTask>,
     assert(A_mt == B.mt());
     assert(A_nt == B.nt());
 
+    if (B.numNumaDomains() > 1) {
+        numa_tile_tasks( B, priority, [&]( int64_t i, int64_t j ) {
+            A.tileGetForReading(i, j, LayoutConvert::None);
+            B.tileGetForWriting(i, j, LayoutConvert::None);
+            tile::add(
+                alpha, A(i, j),
+                beta,  B(i, j) );
+        } );
+        return;
+    }
+
     #pragma omp taskgroup
     for (int64_t i = 0; i < A_mt; ++i) {
         for (int64_t j = 0; j < A_nt; ++j) {
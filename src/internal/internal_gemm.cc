@@ -8,6 +8,7 @@
 #include "slate/Tile_blas.hh"
 #include "internal/internal.hh"
 #include "internal/internal_batch.hh"
+#include "internal/internal_util.hh"
 
 namespace slate {
 namespace internal {
@@ -42,6 +43,16 @@ void gemm(scalar_t alpha, Matrix<scalar_t>&& A,
         throw std::exception();
     }
 
+    perf::Region perf_region( "gemm" );
+    if (perf::Perf::enabled()) {
+        double flops = 0;
+        for (int64_t i = 0; i < C.mt(); ++i)
+            for (int64_t j = 0; j < C.nt(); ++j)
+                if (C.tileIsLocal( i, j ))
+                    flops += 2. * C.tileMb( i ) * C.tileNb( j ) * A.n();
+        perf_region.flops( perf::flop_factor<scalar_t>() * flops );
+    }
+
     gemm(internal::TargetType<target>(),
          alpha, A,
                 B,
@@ -53,6 +64,14 @@ void gemm(scalar_t alpha, Matrix<scalar_t>&& A,
 /// General matrix multiply to update trailing matrix,
 /// where A is a single block column and B is a single block row.
 /// Host OpenMP task implementation.
+///
+/// Local tiles of C are updated in Morton order (see morton_local_tiles),
+/// in chains of 4 consecutive tiles per task when there are enough tiles,
+/// so each task's tiles share tiles of A and B in cache. Within a chain,
+/// the next tiles of C and A are prefetched into cache while the current
+/// tile is updated, which helps small tiles that are memory bound.
+/// With multiple host NUMA domains, chains run in the domain of their
+/// first tile (see numa_tasks).
 /// @ingroup gemm_internal
 ///
 template <typename scalar_t>
@@ -86,26 +105,58 @@ void gemm(internal::TargetType<Target::HostTask>,
     A.tileGetForReading(A_tiles_set, LayoutConvert(layout));
     B.tileGetForReading(B_tiles_set, LayoutConvert(layout));
 
-    #pragma omp taskgroup
-    for (int64_t i = 0; i < C.mt(); ++i) {
-        for (int64_t j = 0; j < C.nt(); ++j) {
-            if (C.tileIsLocal(i, j)) {
-                #pragma omp task slate_omp_default_none \
-                    shared( A, B, C, err, err_msg ) \
-                    firstprivate(i, j, layout, alpha, beta ) \
-                    priority(priority)
-                {
-                    try {
-                        C.tileGetForWriting(i, j, LayoutConvert(layout));
-                        tile::gemm(
-                            alpha, A(i, 0), B(0, j),
-                            beta,  C(i, j) );
-                    }
-                    catch (std::exception& e) {
-                        err = __LINE__;
-                        err_msg = std::string(e.what());
-                    }
+    // Tiles larger than this are not prefetched, as they would evict the
+    // tiles in use from cache.
+    const size_t prefetch_max_bytes = 256*1024;
+
+    std::vector<ij_tuple> tiles = morton_local_tiles( C );
+    int64_t num_tiles = tiles.size();
+    int64_t chain = num_tiles >= 4*omp_get_num_threads() ? 4 : 1;
+    int64_t num_chains = ceildiv( num_tiles, chain );
+
+    auto update_chain = [&]( int64_t c ) {
+        try {
+            int64_t k_begin = c*chain;
+            int64_t k_end = std::min( k_begin + chain, num_tiles );
+            for (int64_t k = k_begin; k < k_end; ++k) {
+                auto [ i, j ] = tiles[ k ];
+                C.tileGetForWriting( i, j, LayoutConvert( layout ) );
+            }
+            for (int64_t k = k_begin; k < k_end; ++k) {
+                auto [ i, j ] = tiles[ k ];
+                if (k+1 < k_end) {
+                    auto [ i_next, j_next ] = tiles[ k+1 ];
+                    prefetch_tile( C( i_next, j_next ), prefetch_max_bytes, true );
+                    if (i_next != i)
+                        prefetch_tile( A( i_next, 0 ), prefetch_max_bytes, false );
                 }
+                tile::gemm(
+                    alpha, A( i, 0 ), B( 0, j ),
+                    beta,  C( i, j ) );
+            }
+        }
+        catch (std::exception& e) {
+            err = __LINE__;
+            err_msg = std::string(e.what());
+        }
+    };
+
+    if (C.numNumaDomains() > 1) {
+        std::vector< std::vector<int64_t> > queues( C.numNumaDomains() );
+        for (int64_t c = 0; c < num_chains; ++c) {
+            auto [ i, j ] = tiles[ c*chain ];
+            queues[ C.tileNumaDomain( i, j ) ].push_back( c );
+        }
+        numa_tasks( queues, priority, update_chain );
+    }
+    else {
+        #pragma omp taskgroup
+        for (int64_t c = 0; c < num_chains; ++c) {
+            #pragma omp task slate_omp_default_none \
+                shared( update_chain ) firstprivate( c ) \
+                priority( priority )
+            {
+                update_chain( c );
             }
         }
     }
@@ -24,15 +24,18 @@ template <Target target, typename scalar_t>
 void geqrf(
     Matrix<scalar_t>&& A, Matrix<scalar_t>&& T,
     std::vector< scalar_t* > dwork_array, size_t work_size,
-    int64_t ib, int max_panel_threads, int priority)
+    int64_t ib, int max_panel_threads, int priority,
+    PanelTeam* panel_team)
 {
     geqrf(internal::TargetType<target>(),
           A, T, dwork_array, work_size,
-          ib, max_panel_threads, priority);
+          ib, max_panel_threads, priority, panel_team);
 }
 
 //------------------------------------------------------------------------------
 /// QR factorization of a column of tiles, HostTask implementation.
+/// If panel_team is given, its threads factor the panel; otherwise,
+/// a nested OpenMP parallel region does.
 /// @ingroup geqrf_internal
 ///
 template <typename scalar_t>
@@ -40,7 +43,8 @@ void geqrf(
     internal::TargetType<Target::HostTask>,
     Matrix<scalar_t>& A, Matrix<scalar_t>& T,
     std::vector< scalar_t* > dwork_array, size_t work_size,
-    int64_t ib, int max_panel_threads, int priority)
+    int64_t ib, int max_panel_threads, int priority,
+    PanelTeam* panel_team)
 {
     using real_t = blas::real_type<scalar_t>;
 
@@ -91,29 +95,34 @@ void geqrf(
         real_t xnorm;
         std::vector< std::vector<scalar_t> > W(thread_size);
 
-        #if 1
-            #pragma omp parallel slate_omp_default_none \
-                num_threads(thread_size) \
-                shared(thread_barrier, scale, sumsq, xnorm, W, A, T00) \
-                shared(tile_indices, tiles) \
-                firstprivate(ib, thread_size)
-        #else
-            #pragma omp taskloop slate_omp_default_none \
-                num_tasks(thread_size) \
-                shared(thread_barrier, scale, sumsq, xnorm, W, A, T00) \
-                shared(tile_indices, tiles) \
-                firstprivate(ib, thread_size)
-        #endif
-        {
-            // Factor the panel in parallel.
+        // Factor the panel in parallel.
+        auto panel = [&]( int thread_rank ) {
             // todo: double check the size of W.
-            int thread_rank = omp_get_thread_num();
             W.at(thread_rank).resize(ib*A.tileNb(0));
             tile::geqrf( ib,
                          tiles, tile_indices, T00,
                          thread_rank, thread_size,
                          thread_barrier,
                          scale, sumsq, xnorm, W );
+        };
+        if (panel_team != nullptr && thread_size <= panel_team->size()) {
+            // The factorization's persistent team is already running,
+            // so no threads are created for the panel.
+            panel_team->run( thread_size, panel );
+        }
+        else {
+            #if 1
+                #pragma omp parallel slate_omp_default_none \
+                    num_threads(thread_size) \
+                    shared(panel)
+            #else
+                #pragma omp taskloop slate_omp_default_none \
+                    num_tasks(thread_size) \
+                    shared(panel)
+            #endif
+            {
+                panel( omp_get_thread_num() );
+            }
         }
     }
 }
@@ -129,11 +138,12 @@ void geqrf(
     internal::TargetType<Target::HostNest>,
     Matrix<scalar_t>& A, Matrix<scalar_t>& T,
     std::vector< scalar_t* > dwork_array, size_t work_size,
-    int64_t ib, int max_panel_threads, int priority)
+    int64_t ib, int max_panel_threads, int priority,
+    PanelTeam* panel_team)
 {
     geqrf( internal::TargetType<Target::HostTask>(),
           A, T, dwork_array, work_size,
-          ib, max_panel_threads, priority);
+          ib, max_panel_threads, priority, panel_team);
 }
 
 //------------------------------------------------------------------------------
@@ -147,11 +157,12 @@ void geqrf(
     internal::TargetType<Target::HostBatch>,
     Matrix<scalar_t>& A, Matrix<scalar_t>& T,
     std::vector< scalar_t* > dwork_array, size_t work_size,
-    int64_t ib, int max_panel_threads, int priority)
+    int64_t ib, int max_panel_threads, int priority,
+    PanelTeam* panel_team)
 {
     geqrf( internal::TargetType<Target::HostTask>(),
           A, T, dwork_array, work_size,
-          ib, max_panel_threads, priority);
+          ib, max_panel_threads, priority, panel_team);
 }
 
 //------------------------------------------------------------------------------
@@ -163,7 +174,8 @@ void geqrf(
     internal::TargetType<Target::Devices>,
     Matrix<scalar_t>& A, Matrix<scalar_t>& T,
     std::vector< scalar_t* > dwork_array, size_t work_size,
-    int64_t ib, int max_panel_threads, int priority)
+    int64_t ib, int max_panel_threads, int priority,
+    PanelTeam* panel_team)
 {
 
     assert(A.nt() == 1);
@@ -336,112 +348,128 @@ template
 void geqrf<Target::HostTask, float>(
     Matrix<float>&& A, Matrix<float>&& T,
     std::vector< float* > dwork_array, size_t work_size,
-    int64_t ib, int max_panel_threads, int priority);
+    int64_t ib, int max_panel_threads, int priority,
+    PanelTeam* panel_team);
 
 // ----------------------------------------
 template
 void geqrf<Target::HostTask, double>(
     Matrix<double>&& A, Matrix<double>&& T,
     std::vector< double* > dwork_array, size_t work_size,
-    int64_t ib, int max_panel_threads, int priority);
+    int64_t ib, int max_panel_threads, int priority,
+    PanelTeam* panel_team);
 
 // ----------------------------------------
 template
 void geqrf<Target::HostTask, std::complex<float> >(
     Matrix<std::complex<float>>&& A, Matrix< std::complex<float> >&& T,
     std::vector< std::complex<float>* > dwork_array, size_t work_size,
-    int64_t ib, int max_panel_threads, int priority);
+    int64_t ib, int max_panel_threads, int priority,
+    PanelTeam* panel_team);
 
 // ----------------------------------------
 template
 void geqrf<Target::HostTask, std::complex<double> >(
     Matrix<std::complex<double>>&& A, Matrix< std::complex<double> >&& T,
     std::vector< std::complex<double>* > dwork_array, size_t work_size,
-    int64_t ib, int max_panel_threads, int priority);
+    int64_t ib, int max_panel_threads, int priority,
+    PanelTeam* panel_team);
 
 // ----------------------------------------
 template
 void geqrf<Target::HostNest, float>(
     Matrix<float>&& A, Matrix<float>&& T,
     std::vector< float* > dwork_array, size_t work_size,
-    int64_t ib, int max_panel_threads, int priority);
+    int64_t ib, int max_panel_threads, int priority,
+    PanelTeam* panel_team);
 
 // ----------------------------------------
 template
 void geqrf<Target::HostNest, double>(
     Matrix<double>&& A, Matrix<double>&& T,
     std::vector< double* > dwork_array, size_t work_size,
-    int64_t ib, int max_panel_threads, int priority);
+    int64_t ib, int max_panel_threads, int priority,
+    PanelTeam* panel_team);
 
 // ----------------------------------------
 template
 void geqrf<Target::HostNest, std::complex<float> >(
     Matrix<std::complex<float>>&& A, Matrix< std::complex<float> >&& T,
     std::vector< std::complex<float>* > dwork_array, size_t work_size,
-    int64_t ib, int max_panel_threads, int priority);
+    int64_t ib, int max_panel_threads, int priority,
+    PanelTeam* panel_team);
 
 // ----------------------------------------
 template
 void geqrf<Target::HostNest, std::complex<double> >(
     Matrix<std::complex<double>>&& A, Matrix< std::complex<double> >&& T,
     std::vector< std::complex<double>* > dwork_array, size_t work_size,
-    int64_t ib, int max_panel_threads, int priority);
+    int64_t ib, int max_panel_threads, int priority,
+    PanelTeam* panel_team);
 
 // ----------------------------------------
 template
 void geqrf<Target::HostBatch, float>(
     Matrix<float>&& A, Matrix<float>&& T,
     std::vector< float* > dwork_array, size_t work_size,
-    int64_t ib, int max_panel_threads, int priority);
+    int64_t ib, int max_panel_threads, int priority,
+    PanelTeam* panel_team);
 
 // ----------------------------------------
 template
 void geqrf<Target::HostBatch, double>(
     Matrix<double>&& A, Matrix<double>&& T,
     std::vector< double* > dwork_array, size_t work_size,
-    int64_t ib, int max_panel_threads, int priority);
+    int64_t ib, int max_panel_threads, int priority,
+    PanelTeam* panel_team);
 
 // ----------------------------------------
 template
 void geqrf<Target::HostBatch, std::complex<float> >(
     Matrix<std::complex<float>>&& A, Matrix< std::complex<float> >&& T,
     std::vector< std::complex<float>* > dwork_array, size_t work_size,
-    int64_t ib, int max_panel_threads, int priority);
+    int64_t ib, int max_panel_threads, int priority,
+    PanelTeam* panel_team);
 
 // ----------------------------------------
 template
 void geqrf<Target::HostBatch, std::complex<double> >(
     Matrix<std::complex<double>>&& A, Matrix< std::complex<double> >&& T,
     std::vector< std::complex<double>* > dwork_array, size_t work_size,
-    int64_t ib, int max_panel_threads, int priority);
+    int64_t ib, int max_panel_threads, int priority,
+    PanelTeam* panel_team);
 
 // ----------------------------------------
 template
 void geqrf<Target::Devices, float>(
     Matrix<float>&& A, Matrix<float>&& T,
     std::vector< float* > dwork_array, size_t work_size,
-    int64_t ib, int max_panel_threads, int priority);
+    int64_t ib, int max_panel_threads, int priority,
+    PanelTeam* panel_team);
 
 // ----------------------------------------
 template
 void geqrf<Target::Devices, double>(
     Matrix<double>&& A, Matrix<double>&& T,
     std::vector< double* > dwork_array, size_t work_size,
-    int64_t ib, int max_panel_threads, int priority);
+    int64_t ib, int max_panel_threads, int priority,
+    PanelTeam* panel_team);
 
 // ----------------------------------------
 template
 void geqrf<Target::Devices, std::complex<float> >(
     Matrix<std::complex<float>>&& A, Matrix< std::complex<float> >&& T,
     std::vector< std::complex<float>* > dwork_array, size_t work_size,
-    int64_t ib, int max_panel_threads, int priority);
+    int64_t ib, int max_panel_threads, int priority,
+    PanelTeam* panel_team);
 
 // ----------------------------------------
 template
 void geqrf<Target::Devices, std::complex<double> >(
     Matrix<std::complex<double>>&& A, Matrix< std::complex<double> >&& T,
     std::vector< std::complex<double>* > dwork_array, size_t work_size,
-    int64_t ib, int max_panel_threads, int priority);
+    int64_t ib, int max_panel_threads, int priority,
+    PanelTeam* panel_team);
 
 } // namespace internal
 } // namespace slate
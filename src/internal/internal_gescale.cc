@@ -6,6 +6,7 @@
 #include "slate/internal/device.hh"
 #include "internal/internal_batch.hh"
 #include "internal/internal.hh"
+#include "internal/internal_util.hh"
 #include "slate/internal/util.hh"
 #include "slate/Matrix.hh"
 #include "internal/Tile_lapack.hh"
@@ -32,6 +33,7 @@ void scale(
 /// Scale matrix entries by the real scalar numer/denom.
 /// TODO handle transpose A case
 /// Host OpenMP task implementation.
+/// With several host NUMA domains, tasks run in the domain owning A(i, j).
 /// @ingroup scale_internal
 ///
 template <typename scalar_t>
@@ -41,6 +43,14 @@ void scale(
     Matrix<scalar_t>& A, int priority, int queue_index)
 {
     // trace::Block trace_block("scale");
+    if (A.numNumaDomains() > 1) {
+        numa_tile_tasks( A, priority, [&]( int64_t i, int64_t j ) {
+            A.tileGetForWriting(i, j, LayoutConvert::None);
+            tile::scale( numer, denom, A( i, j ) );
+        } );
+        return;
+    }
+
     #pragma omp taskgroup
     for (int64_t i = 0; i < A.mt(); ++i) {
         for (int64_t j = 0; j < A.nt(); ++j) {
@@ -15,6 +15,8 @@ namespace internal {
 
 //------------------------------------------------------------------------------
 /// LU factorization of a column of tiles, host implementation.
+/// If panel_team is given, its threads factor the panel; otherwise,
+/// a nested OpenMP parallel region does.
 /// @ingroup gesv_internal
 ///
 template <typename scalar_t>
@@ -23,7 +25,8 @@ void getrf_panel(
     Matrix<scalar_t>& A, int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
     blas::real_type<scalar_t> pivot_threshold,
-    int max_panel_threads, int priority, int tag, int64_t* info )
+    int max_panel_threads, int priority, int tag, int64_t* info,
+    PanelTeam* panel_team )
 {
     using ij_tuple = typename BaseMatrix<scalar_t>::ij_tuple;
     assert(A.nt() == 1);
@@ -78,27 +81,11 @@ void getrf_panel(
         std::vector<scalar_t> max_value(thread_size);
         std::vector<int64_t> max_index(thread_size);
         std::vector<int64_t> max_offset(thread_size);
-        std::vector<scalar_t> top_block(ib*A.tileNb(0));
+        std::vector<scalar_t> top_block(diag_len*A.tileNb(0));
         std::vector< AuxPivot<scalar_t> > aux_pivot(diag_len);
 
-        #if 1
-            // Launching new threads for the panel guarantees progression.
-            // This should never deadlock, but may be detrimental to performance.
-            #pragma omp parallel for num_threads( thread_size ) slate_omp_default_none \
-                shared( thread_barrier, max_value, max_index, max_offset ) \
-                shared( top_block, aux_pivot, tiles, bcast_comm, info ) \
-                firstprivate( tile_indices, bcast_root, bcast_rank, ib, \
-                              diag_len, thread_size, pivot_threshold )
-        #else
-            // Issuing panel operation as tasks may cause a deadlock.
-            #pragma omp taskloop num_tasks(thread_size) slate_omp_default_none \
-                shared( thread_barrier, max_value, max_index, max_offset ) \
-                shared( top_block, aux_pivot, tiles, bcast_comm, info ) \
-                firstprivate( tile_indices, bcast_root, bcast_rank, ib, \
-                              diag_len, thread_size, pivot_threshold )
-        #endif
-        for (int thread_rank = 0; thread_rank < thread_size; ++thread_rank) {
-            // Factor the panel in parallel.
+        // Factor the panel in parallel.
+        auto panel = [&]( int thread_rank ) {
             tile::getrf( diag_len, ib,
                          tiles, tile_indices,
                          aux_pivot,
@@ -107,6 +94,26 @@ void getrf_panel(
                          thread_barrier,
                          max_value, max_index, max_offset, top_block,
                          pivot_threshold, info );
+        };
+        if (panel_team != nullptr && thread_size <= panel_team->size()) {
+            // The factorization's persistent team is already running,
+            // so no threads are created for the panel.
+            panel_team->run( thread_size, panel );
+        }
+        else {
+            #if 1
+                // Launching new threads for the panel guarantees progression.
+                // This should never deadlock, but may be detrimental to performance.
+                #pragma omp parallel for num_threads( thread_size ) slate_omp_default_none \
+                    shared( panel ) firstprivate( thread_size )
+            #else
+                // Issuing panel operation as tasks may cause a deadlock.
+                #pragma omp taskloop num_tasks(thread_size) slate_omp_default_none \
+                    shared( panel ) firstprivate( thread_size )
+            #endif
+            for (int thread_rank = 0; thread_rank < thread_size; ++thread_rank) {
+                panel( thread_rank );
+            }
         }
 
         // Copy pivot information from aux_pivot to pivot.
@@ -130,12 +137,13 @@ void getrf_panel(
     Matrix<scalar_t>&& A, int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
     blas::real_type<scalar_t> pivot_threshold,
-    int max_panel_threads, int priority, int tag, int64_t* info )
+    int max_panel_threads, int priority, int tag, int64_t* info,
+    PanelTeam* panel_team )
 {
     getrf_panel(
         internal::TargetType<target>(),
         A, diag_len, ib, pivot,
-        pivot_threshold, max_panel_threads, priority, tag, info );
+        pivot_threshold, max_panel_threads, priority, tag, info, panel_team );
 }
 
 //------------------------------------------------------------------------------
@@ -146,7 +154,8 @@ void getrf_panel<Target::HostTask, float>(
     Matrix<float>&& A, int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
     float pivot_threshold,
-    int max_panel_threads, int priority, int tag, int64_t* info );
+    int max_panel_threads, int priority, int tag, int64_t* info,
+    PanelTeam* panel_team );
 
 // ----------------------------------------
 template
@@ -154,7 +163,8 @@ void getrf_panel<Target::HostTask, double>(
     Matrix<double>&& A, int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
     double pivot_threshold,
-    int max_panel_threads, int priority, int tag, int64_t* info );
+    int max_panel_threads, int priority, int tag, int64_t* info,
+    PanelTeam* panel_team );
 
 // ----------------------------------------
 template
@@ -162,7 +172,8 @@ void getrf_panel< Target::HostTask, std::complex<float> >(
     Matrix< std::complex<float> >&& A, int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
     float pivot_threshold,
-    int max_panel_threads, int priority, int tag, int64_t* info );
+    int max_panel_threads, int priority, int tag, int64_t* info,
+    PanelTeam* panel_team );
 
 // ----------------------------------------
 template
@@ -170,7 +181,8 @@ void getrf_panel< Target::HostTask, std::complex<double> >(
     Matrix< std::complex<double> >&& A, int64_t diag_len, int64_t ib,
     std::vector<Pivot>& pivot,
     double pivot_threshold,
-    int max_panel_threads, int priority, int tag, int64_t* info );
+    int max_panel_threads, int priority, int tag, int64_t* info,
+    PanelTeam* panel_team );
 
 } // namespace internal
 } // namespace slate
@@ -347,6 +347,230 @@ void getrf_tntpiv_local(
     }
 }
 
+//------------------------------------------------------------------------------
+/// Hierarchical tournament over the local tiles of a panel, on the CPU.
+/// Used instead of the flat multi-threaded stage 0 when several threads
+/// are available.
+///
+/// Local tiles are split into thread_size leaves of consecutive tiles.
+/// Each thread factors its leaf independently, without barriers, and keeps
+/// its diag_len pivot rows as candidates. Pairs of candidate sets are then
+/// reduced up a binary tree, as in the tournament between MPI ranks, until
+/// one set remains. Adjacent leaves meet first, so with threads bound
+/// close together (e.g., OMP_PROC_BIND=close), the first levels reduce
+/// within a NUMA domain and only the last levels cross domains.
+///
+/// Candidates always hold rows of the original, unfactored panel.
+///
+/// @param[in] original_tiles
+///     Local tiles of the original panel A; not modified.
+///
+/// @param[in,out] tiles
+///     Local tiles of the panel workspace, initially a copy of A.
+///     On exit, the top diag_len rows of tiles[ 0 ] hold the selected
+///     rows: their LU factors if factor_root, else their original values.
+///     Other rows are overwritten.
+///
+/// @param[in] tile_indices
+///     Block row indices of tiles in tiles array.
+///
+/// @param[in] diag_len
+///     Number of pivots, min( mb, nb ) of tiles[ 0 ].
+///
+/// @param[in] ib
+///     Inner blocking.
+///
+/// @param[out] aux_pivot
+///     On exit, aux_pivot[ 0 ][ 0 : diag_len-1 ] holds the (tile index,
+///     offset) of the selected rows, in the order they are pivoted to,
+///     i.e., in permutation form rather than sequential row swaps.
+///
+/// @param[in] mpi_rank
+///     MPI rank of this process.
+///
+/// @param[in] thread_size
+///     Number of leaves and threads, >= 2.
+///
+/// @param[in] factor_root
+///     Whether to keep the LU factors of the final selection,
+///     when this rank is the only one in the panel.
+///
+/// @param[out] info
+///     Singularity of the final selection, if factor_root.
+///
+/// @ingroup gesv_internal
+///
+template <typename scalar_t>
+void getrf_tntpiv_local_tree(
+    std::vector< Tile< scalar_t > >& original_tiles,
+    std::vector< Tile< scalar_t > >& tiles,
+    std::vector< int64_t >& tile_indices,
+    int64_t diag_len, int64_t ib,
+    std::vector< std::vector< AuxPivot< scalar_t > > >& aux_pivot,
+    int mpi_rank, int thread_size, bool factor_root, int64_t* info )
+{
+    // Candidate rows of one tree node, as a len-by-nb column-major block,
+    // with the (tile index, offset) of each row in pivot.
+    struct Candidates {
+        int64_t len;
+        std::vector< scalar_t > data;
+        std::vector< AuxPivot< scalar_t > > pivot;
+    };
+
+    int64_t nb = tiles[ 0 ].nb();
+    int64_t ntiles = tiles.size();
+    assert( thread_size >= 2 && thread_size <= ntiles );
+
+    std::vector< Candidates > nodes( thread_size );
+
+    //------------------
+    // Leaves: each thread factors its consecutive tiles.
+    #pragma omp parallel for num_threads( thread_size ) shared( nodes )
+    for (int leaf = 0; leaf < thread_size; ++leaf) {
+        int64_t begin = leaf * ntiles / thread_size;
+        int64_t end   = (leaf + 1) * ntiles / thread_size;
+
+        std::vector< Tile< scalar_t > > leaf_tiles(
+            tiles.begin() + begin, tiles.begin() + end );
+        std::vector< int64_t > leaf_indices(
+            tile_indices.begin() + begin, tile_indices.begin() + end );
+
+        // Only the last tile can be short, and it's first only if alone.
+        int64_t len = std::min( leaf_tiles[ 0 ].mb(), nb );
+
+        std::vector< std::vector< AuxPivot< scalar_t > > > leaf_pivot( 2 );
+        leaf_pivot[ 0 ].resize( len );
+
+        ThreadBarrier thread_barrier;
+        std::vector< scalar_t > max_value( 1 );
+        std::vector< int64_t >  max_index( 1 );
+        std::vector< int64_t >  max_offset( 1 );
+        std::vector< scalar_t > top_block( ib * nb );
+        int64_t leaf_info = 0;  // a singular leaf isn't a singular panel
+
+        tile::getrf_tntpiv_local(
+            len, ib, 0, leaf_tiles, leaf_indices, leaf_pivot,
+            mpi_rank, 0, 1, thread_barrier,
+            max_value, max_index, max_offset, top_block, &leaf_info );
+
+        // Apply the leaf's sequential swaps to find its selected rows,
+        // as (tile in leaf, offset) pairs.
+        std::vector< std::vector< std::pair< int64_t, int64_t > > >
+            permute( leaf_tiles.size() );
+        for (int64_t t = 0; t < int64_t( leaf_tiles.size() ); ++t) {
+            for (int64_t ii = 0; ii < leaf_tiles[ t ].mb(); ++ii) {
+                permute[ t ].push_back( { t, ii } );
+            }
+        }
+        for (int64_t ii = 0; ii < len; ++ii) {
+            int64_t ip  = leaf_pivot[ 0 ][ ii ].localTileIndex();
+            int64_t iip = leaf_pivot[ 0 ][ ii ].localOffset();
+            if (ip > 0 || iip > ii) {
+                std::swap( permute[ 0 ][ ii ], permute[ ip ][ iip ] );
+            }
+        }
+
+        // Gather the selected rows from the original panel.
+        Candidates& node = nodes[ leaf ];
+        node.len = len;
+        node.data.resize( len * nb );
+        node.pivot.resize( len );
+        for (int64_t ii = 0; ii < len; ++ii) {
+            int64_t t  = permute[ 0 ][ ii ].first;
+            int64_t it = permute[ 0 ][ ii ].second;
+            auto Ait = original_tiles[ begin + t ];
+            blas::copy( nb, &Ait.at( it, 0 ), Ait.stride(),
+                            &node.data[ ii ], len );
+            node.pivot[ ii ] = AuxPivot< scalar_t >(
+                tile_indices[ begin + t ], it, 0, ii, scalar_t( 0 ), mpi_rank );
+        }
+    }
+
+    //------------------
+    // Binary reduction tree over leaves; node i absorbs node i + step.
+    std::vector< scalar_t > root_lu;
+    for (int step = 1; step < thread_size; step *= 2) {
+        int npairs = (thread_size + 2*step - 1) / (2*step);
+        bool root_level = (2*step >= thread_size);
+
+        #pragma omp parallel for num_threads( npairs ) \
+                    shared( nodes, root_lu )
+        for (int pair = 0; pair < npairs; ++pair) {
+            int i1 = pair * 2*step;
+            int i2 = i1 + step;
+            if (i2 < thread_size) {
+                Candidates& node1 = nodes[ i1 ];
+                Candidates& node2 = nodes[ i2 ];
+                int64_t len = node1.len;
+
+                // Factor copies, keeping original rows in the nodes.
+                std::vector< scalar_t > data1( node1.data );
+                std::vector< scalar_t > data2( node2.data );
+                std::vector< Tile< scalar_t > > tmp_tiles;
+                tmp_tiles.push_back( Tile< scalar_t >(
+                    node1.len, nb, data1.data(), node1.len,
+                    slate::HostNum, TileKind::Workspace ) );
+                tmp_tiles.push_back( Tile< scalar_t >(
+                    node2.len, nb, data2.data(), node2.len,
+                    slate::HostNum, TileKind::Workspace ) );
+
+                std::vector< std::vector< AuxPivot< scalar_t > > >
+                    pair_pivot = { node1.pivot, node2.pivot };
+
+                ThreadBarrier thread_barrier;
+                std::vector< scalar_t > max_value( 1 );
+                std::vector< int64_t >  max_index( 1 );
+                std::vector< int64_t >  max_offset( 1 );
+                std::vector< scalar_t > top_block( ib * nb );
+                int64_t pair_info = 0;
+
+                tile::getrf_tntpiv_local(
+                    len, ib, 1, tmp_tiles, tile_indices, pair_pivot,
+                    mpi_rank, 0, 1, thread_barrier,
+                    max_value, max_index, max_offset, top_block,
+                    (root_level && factor_root ? info : &pair_info) );
+
+                // Apply the same swaps to the original rows.
+                Tile< scalar_t > tile1(
+                    node1.len, nb, node1.data.data(), node1.len,
+                    slate::HostNum, TileKind::Workspace );
+                Tile< scalar_t > tile2(
+                    node2.len, nb, node2.data.data(), node2.len,
+                    slate::HostNum, TileKind::Workspace );
+                std::vector< Tile< scalar_t > > orig_tiles = { tile1, tile2 };
+                for (int64_t ii = 0; ii < len; ++ii) {
+                    int64_t ip  = pair_pivot[ 0 ][ ii ].localTileIndex();
+                    int64_t iip = pair_pivot[ 0 ][ ii ].localOffset();
+                    if (ip > 0 || iip > ii) {
+                        swapLocalRow( 0, nb,
+                                      orig_tiles[ 0  ], ii,
+                                      orig_tiles[ ip ], iip );
+                    }
+                }
+                node1.pivot.assign( pair_pivot[ 0 ].begin(),
+                                    pair_pivot[ 0 ].begin() + len );
+
+                if (root_level && factor_root)
+                    root_lu = std::move( data1 );
+            }
+        }
+    }
+
+    //------------------
+    // Store the final selection in the top rows of tiles[ 0 ].
+    Candidates& root = nodes[ 0 ];
+    assert( root.len == diag_len );
+    scalar_t* selected = factor_root ? root_lu.data() : root.data.data();
+    auto tile0 = tiles[ 0 ];
+    lapack::lacpy( lapack::MatrixType::General, diag_len, nb,
+                   selected, diag_len,
+                   &tile0.at( 0, 0 ), tile0.stride() );
+    for (int64_t ii = 0; ii < diag_len; ++ii) {
+        aux_pivot[ 0 ][ ii ].set_tileIndex(     root.pivot[ ii ].tileIndex() );
+        aux_pivot[ 0 ][ ii ].set_elementOffset( root.pivot[ ii ].elementOffset() );
+    }
+}
+
 //------------------------------------------------------------------------------
 /// LU factorization of a column of tiles.
 /// @ingroup gesv_internal
@@ -483,13 +707,34 @@ void getrf_tntpiv_panel(
         // piv_len can be < diag_len, if a rank's only tile is short.
         int64_t piv_len = std::min( tiles[ 0 ].mb(), nb );
 
-        getrf_tntpiv_local(
-            internal::TargetType<target>(),
-            tiles, dwork_array, work_bytes, mlocal, device, queue,
-            piv_len, ib, 0, mb, nb, tile_indices, aux_pivot,
-            A.mpiRank(), max_panel_threads, priority, info );
+        // On the CPU with several threads, play a hierarchical tournament
+        // over local tiles, rather than one flat factorization with
+        // barriers between threads for every column.
+        // Requires mb <= nb, so the selected rows fill the diagonal tile.
+        int thread_size = std::min( max_panel_threads, int( tiles.size() ) );
+        bool local_tree = target != Target::Devices
+                          && thread_size > 1
+                          && tiles[ 0 ].mb() <= nb;
+
+        if (local_tree) {
+            getrf_tntpiv_local_tree(
+                original_tiles, tiles, tile_indices, piv_len, ib,
+                aux_pivot, A.mpiRank(), thread_size, nranks == 1, info );
+
+            if (nranks == 1) {
+                permutation_to_sequential_pivot(
+                    aux_pivot[ 0 ], diag_len, A.mt(), mb );
+            }
+        }
+        else {
+            getrf_tntpiv_local(
+                internal::TargetType<target>(),
+                tiles, dwork_array, work_bytes, mlocal, device, queue,
+                piv_len, ib, 0, mb, nb, tile_indices, aux_pivot,
+                A.mpiRank(), max_panel_threads, priority, info );
+        }
 
-        if (nranks > 1) {
+        if (nranks > 1 && ! local_tree) {
             // For s = tile_indices.size(), permute is an s-length vector
             // of mb-length vectors of pairs (tile_index, offset):
             //     permute = [ [ (0, 0) ... (0, mb-1) ],
@@ -535,7 +780,12 @@ void getrf_tntpiv_panel(
                 aux_pivot[ 0 ][ ii ].set_tileIndex(     permute[ 0 ][ ii ].first  );
                 aux_pivot[ 0 ][ ii ].set_elementOffset( permute[ 0 ][ ii ].second );
             }
+        }
 
+        if (nranks > 1) {
+            // The top piv_len rows of Awork( tile_indices[ 0 ], 0 ) now hold
+            // this rank's candidate rows, with their (tile index, offset)
+            // in aux_pivot[ 0 ]. Play the tournament between ranks.
             int64_t step = 1;
             for (int level = 0; level < nlevels; ++level) {
                 if (index % (2*step) == 0) {
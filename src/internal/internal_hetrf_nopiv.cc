@@ -0,0 +1,88 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/HermitianMatrix.hh"
+#include "slate/types.hh"
+#include "internal/Tile_hetrf_nopiv.hh"
+#include "internal/internal.hh"
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// $L D L^H$ factorization of single Hermitian tile without pivoting.
+/// Dispatches to target implementations.
+/// @ingroup hesv_internal
+///
+template <Target target, typename scalar_t>
+void hetrf_nopiv(
+    HermitianMatrix< scalar_t >&& A,
+    int priority, int64_t* info )
+{
+    hetrf_nopiv( internal::TargetType<target>(), A, priority, info );
+}
+
+//------------------------------------------------------------------------------
+/// $L D L^H$ factorization of single Hermitian tile without pivoting,
+/// host implementation.
+///
+/// @param[in,out] info
+///     Exit status.
+///     * 0: successful exit
+///     * i > 0: D(i,i) is exactly zero (1-based index). The factorization
+///       will have NaN due to division by zero.
+///
+/// @ingroup hesv_internal
+///
+template <typename scalar_t>
+void hetrf_nopiv(
+    internal::TargetType<Target::HostTask>,
+    HermitianMatrix<scalar_t>& A,
+    int priority, int64_t* info )
+{
+    assert(A.mt() == 1);
+    assert(A.nt() == 1);
+    assert(A.uploPhysical() == Uplo::Lower);
+
+    *info = 0;
+
+    if (A.tileIsLocal(0, 0)) {
+        A.tileGetForWriting(0, 0, LayoutConvert::ColMajor);
+        tile::hetrf_nopiv( A( 0, 0 ), info );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+// ----------------------------------------
+template
+void hetrf_nopiv<Target::HostTask, float>(
+    HermitianMatrix<float>&& A,
+    int priority,
+    int64_t* info );
+
+// ----------------------------------------
+template
+void hetrf_nopiv<Target::HostTask, double>(
+    HermitianMatrix<double>&& A,
+    int priority,
+    int64_t* info );
+
+// ----------------------------------------
+template
+void hetrf_nopiv< Target::HostTask, std::complex<float> >(
+    HermitianMatrix< std::complex<float> >&& A,
+    int priority,
+    int64_t* info );
+
+// ----------------------------------------
+template
+void hetrf_nopiv< Target::HostTask, std::complex<double> >(
+    HermitianMatrix< std::complex<double> >&& A,
+    int priority,
+    int64_t* info );
+
+} // namespace internal
+} // namespace slate
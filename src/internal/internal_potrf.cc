@@ -23,6 +23,12 @@ int64_t potrf(
     int priority, int64_t queue_index,
     lapack::device_info_int* device_info)
 {
+    perf::Region perf_region( "potrf" );
+    if (perf::Perf::enabled() && A.tileIsLocal( 0, 0 )) {
+        double n = A.tileMb( 0 );
+        perf_region.flops( perf::flop_factor<scalar_t>() * n*n*n / 3 );
+    }
+
     return potrf( internal::TargetType<target>(), A, priority,
                   queue_index, device_info );
 }
@@ -0,0 +1,79 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/Matrix.hh"
+#include "internal/internal.hh"
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Fills the local tiles of A with independent standard normal entries,
+/// as used for randomized sketches.
+/// Each tile is seeded from its global tile indices, so the result does not
+/// depend on the process grid.
+/// Tiles must already be inserted.
+///
+/// @param[in,out] A
+///     The matrix to fill.
+///
+/// @param[in] seed
+///     A seed for controlling the random number generation.
+///
+/// @ingroup heev_internal
+///
+template <typename scalar_t>
+void randn(Matrix<scalar_t>& A, int64_t seed)
+{
+    const int64_t idist_normal = 3;
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        for (int64_t j = 0; j < A.nt(); ++j) {
+            for (int64_t i = 0; i < A.mt(); ++i) {
+                if (A.tileIsLocal( i, j )) {
+                    #pragma omp task slate_omp_default_none \
+                        firstprivate( i, j, seed ) shared( A )
+                    {
+                        A.tileGetForWriting( i, j, LayoutConvert::ColMajor );
+                        auto T = A( i, j );
+                        // larnv requires iseed in [0, 4095], with iseed[3] odd.
+                        int64_t iseed[4] = { (seed + i) % 4096,
+                                             j % 4096,
+                                             (i / 4096) % 4096,
+                                             2*((j / 4096) % 2048) + 1 };
+                        for (int64_t jj = 0; jj < T.nb(); ++jj) {
+                            lapack::larnv( idist_normal, iseed, T.mb(),
+                                           &T.at( 0, jj ) );
+                        }
+                    }
+                }
+            }
+        }
+        #pragma omp taskwait
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void randn<float>(
+    Matrix<float>& A, int64_t seed);
+
+template
+void randn<double>(
+    Matrix<double>& A, int64_t seed);
+
+template
+void randn< std::complex<float> >(
+    Matrix< std::complex<float> >& A, int64_t seed);
+
+template
+void randn< std::complex<double> >(
+    Matrix< std::complex<double> >& A, int64_t seed);
+
+} // namespace internal
+} // namespace slate
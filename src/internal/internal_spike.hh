@@ -0,0 +1,206 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+//------------------------------------------------------------------------------
+#ifndef SLATE_INTERNAL_SPIKE_HH
+#define SLATE_INTERNAL_SPIKE_HH
+
+#include "slate/Exception.hh"
+#include "slate/types.hh"
+#include "slate/internal/mpi.hh"
+#include "slate/internal/util.hh"
+
+#include "blas.hh"
+#include "lapack.hh"
+
+#include <algorithm>
+#include <vector>
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Sizes of the SPIKE partitions, one per rank owning columns.
+/// Partition j has rows [ j*nb, j*nb + size( j ) ). Its interface unknowns
+/// are its first top( j ) rows, which partition j-1 couples to, and its
+/// last bottom( j ) rows, which partition j+1 couples to.
+///
+class SpikePartition {
+public:
+    SpikePartition(int64_t n, int64_t nb, int64_t kl, int64_t ku, int nparts)
+        : n_( n ), nb_( nb ), kl_( kl ), ku_( ku ), nparts_( nparts )
+    {}
+
+    int64_t size(int j) const
+    {
+        return j < nparts_ ? std::min( nb_, n_ - j*nb_ ) : 0;
+    }
+
+    int64_t top(int j) const
+    {
+        return 0 < j && j < nparts_ ? std::min( ku_, size( j ) ) : 0;
+    }
+
+    int64_t bottom(int j) const
+    {
+        return 0 <= j && j + 1 < nparts_ ? kl_ : 0;
+    }
+
+    /// @return offset of partition j's unknowns in the reduced system.
+    int64_t offset(int j) const
+    {
+        int64_t off = 0;
+        for (int i = 0; i < j; ++i)
+            off += top( i ) + bottom( i );
+        return off;
+    }
+
+private:
+    int64_t n_, nb_, kl_, ku_;
+    int nparts_;
+};
+
+//------------------------------------------------------------------------------
+/// Solves the SPIKE reduced system and recovers the local solution.
+///
+/// On entry, Y = A_j^{-1} [ C_j  B_j  F_j ] for this rank's partition j,
+/// where A_j is the diagonal block, C_j is the coupling to the last kl
+/// rows of partition j-1 (only if j > 0), B_j is the coupling to the first
+/// top( j+1 ) rows of partition j+1, and F_j is the right-hand side.
+/// The spikes W = A_j^{-1} C_j and V = A_j^{-1} B_j give the reduced system
+/// \[
+///     x_j + V x_{j+1}^{top} + W x_{j-1}^{bottom} = A_j^{-1} F_j,
+/// \]
+/// restricted to the interface rows of all partitions. It is block
+/// tridiagonal with O( (kl + ku) p ) unknowns, so every rank gathers it
+/// and solves it redundantly as a band system, instead of a round trip
+/// to a root.
+///
+/// On exit, X = x_j, the rows of the solution in partition j.
+///
+/// @return 0, or i > 0 if the reduced system is singular, where i is a
+/// 1-based global row index of an interface unknown.
+///
+template <typename scalar_t>
+int64_t spike_reduced_solve(
+    SpikePartition const& part, int64_t kl, int64_t ku, int64_t nrhs,
+    int rank, int nranks, MPI_Comm mpi_comm,
+    std::vector<scalar_t> const& Y, scalar_t* X, int64_t ldx)
+{
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    int mpi_size;
+    slate_mpi_call( MPI_Comm_size( mpi_comm, &mpi_size ) );
+
+    int64_t nj     = part.size( rank );
+    int64_t top    = part.top( rank );
+    int64_t bottom = part.bottom( rank );
+    int64_t kw = part.bottom( rank - 1 );  // columns of W
+    int64_t kv = part.top( rank + 1 );     // columns of V
+    scalar_t const* W = Y.data();
+    scalar_t const* V = Y.data() + kw*nj;
+    scalar_t const* G = Y.data() + (kw + kv)*nj;
+
+    // Pack this partition's interface rows of [ W  V  G ],
+    // padded to a fixed width.
+    int64_t width = kl + ku + nrhs;
+    std::vector<scalar_t> rows( (top + bottom)*width, zero );
+    for (int64_t r = 0; r < top + bottom; ++r) {
+        int64_t i = r < top ? r : nj - bottom + (r - top);
+        scalar_t* row = &rows[ r*width ];
+        for (int64_t c = 0; c < kw; ++c)
+            row[ c ] = W[ i + c*nj ];
+        for (int64_t c = 0; c < kv; ++c)
+            row[ kl + c ] = V[ i + c*nj ];
+        for (int64_t c = 0; c < nrhs; ++c)
+            row[ kl + ku + c ] = G[ i + c*nj ];
+    }
+
+    std::vector<int> counts( mpi_size ), displs( mpi_size );
+    int64_t nreduced = 0;
+    for (int r = 0; r < mpi_size; ++r) {
+        int64_t rows_r = part.top( r ) + part.bottom( r );
+        counts[ r ] = int( rows_r*width );
+        displs[ r ] = int( nreduced*width );
+        nreduced += rows_r;
+    }
+    std::vector<scalar_t> all_rows( nreduced*width );
+    slate_mpi_call(
+        MPI_Allgatherv( rows.data(), counts[ rank ], mpi_type<scalar_t>::value,
+                        all_rows.data(), counts.data(), displs.data(),
+                        mpi_type<scalar_t>::value, mpi_comm ) );
+
+    // Assemble and solve the reduced system in LAPACK band storage.
+    // Rows of partition j reach back to the bottom of j-1 and forward
+    // to the top of j+1, so kl + ku bounds both bandwidths, doubled.
+    std::vector<scalar_t> Z( nreduced*nrhs );
+    int64_t info = 0;
+    if (nreduced > 0) {
+        int64_t kr = std::min( 2*(kl + ku), nreduced - 1 );
+        int64_t ldab = 3*kr + 1;
+        std::vector<scalar_t> AB( ldab*nreduced, zero );
+        auto elem = [&](int64_t i, int64_t j) -> scalar_t& {
+            return AB[ 2*kr + i - j + j*ldab ];
+        };
+        for (int j = 0; j < nranks; ++j) {
+            int64_t off = part.offset( j );
+            int64_t off_prev = off - part.bottom( j - 1 );
+            int64_t off_next = off + part.top( j ) + part.bottom( j );
+            int64_t rows_j = part.top( j ) + part.bottom( j );
+            for (int64_t r = 0; r < rows_j; ++r) {
+                scalar_t const* row = &all_rows[ (off + r)*width ];
+                elem( off + r, off + r ) = one;
+                for (int64_t c = 0; c < part.bottom( j - 1 ); ++c)
+                    elem( off + r, off_prev + c ) = row[ c ];
+                for (int64_t c = 0; c < part.top( j + 1 ); ++c)
+                    elem( off + r, off_next + c ) = row[ kl + c ];
+                for (int64_t c = 0; c < nrhs; ++c)
+                    Z[ off + r + c*nreduced ] = row[ kl + ku + c ];
+            }
+        }
+        std::vector<int64_t> ipiv( nreduced );
+        info = lapack::gbsv( nreduced, kr, kr, nrhs, AB.data(), ldab,
+                             ipiv.data(), Z.data(), nreduced );
+        if (info > 0) {
+            // Map the reduced unknown to its global row.
+            int64_t p = info - 1;
+            int j = 0;
+            while (part.offset( j + 1 ) <= p)
+                ++j;
+            int64_t r = p - part.offset( j );
+            int64_t nb = part.size( 0 );
+            info = (r < part.top( j )
+                    ? j*nb + r
+                    : j*nb + part.size( j ) - part.bottom( j )
+                      + (r - part.top( j ))) + 1;
+            return info;
+        }
+    }
+
+    if (nj == 0)
+        return 0;
+
+    // x_j = G - V x_{j+1}^{top} - W x_{j-1}^{bottom}
+    lapack::lacpy( lapack::MatrixType::General, nj, nrhs, G, nj, X, ldx );
+    if (kv > 0) {
+        int64_t off_next = part.offset( rank + 1 );
+        blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans, nj, nrhs, kv,
+                    -one, V, nj, &Z[ off_next ], nreduced,
+                    one,  X, ldx );
+    }
+    if (kw > 0) {
+        int64_t off_prev = part.offset( rank ) - kw;
+        blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans, nj, nrhs, kw,
+                    -one, W, nj, &Z[ off_prev ], nreduced,
+                    one,  X, ldx );
+    }
+    return 0;
+}
+
+} // namespace internal
+} // namespace slate
+
+#endif // SLATE_INTERNAL_SPIKE_HH
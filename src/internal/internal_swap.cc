@@ -7,7 +7,9 @@
 #include "slate/types.hh"
 #include "internal/internal.hh"
 #include "internal/internal_swap.hh"
+#include "internal/internal_util.hh"
 
+#include <algorithm>
 #include <map>
 #include <vector>
 
@@ -190,6 +192,21 @@ void permuteRows(
 //------------------------------------------------------------------------------
 /// Permutes rows of a general matrix according to the pivot vector.
 /// Host implementation.
+///
+/// By default, each block column is swapped in its own exchange:
+/// the root rank (owner of tile (0, j)) gathers the remote rows,
+/// swaps rows locally, then scatters the rows back.
+///
+/// If aggregate_swaps() is set, block columns whose pivoted tiles live on
+/// the same set of ranks, i.e., block columns in the same process column
+/// for 2D block cyclic, are swapped together, in one aggregated exchange
+/// of rows spanning all those block columns. This reduces the number of
+/// messages and MPI datatypes per call from nt to the number of distinct
+/// process columns, which matters for the latency-bound swaps of tall
+/// matrices on many ranks.
+/// With several host NUMA domains, the root swaps each block column in a
+/// task in the domain owning its tile (0, j).
+///
 /// todo: Restructure similarly to Hermitian permuteRowsCols
 ///       (use the auxiliary swap functions).
 ///
@@ -220,40 +237,78 @@ void permuteRows(
 
         MPI_Datatype mpi_scalar = mpi_type<scalar_t>::value;
 
-        // todo: what about parallelizing this? MPI blocking?
-        for (int64_t j = 0; j < A.nt(); ++j) {
-            int root_rank = A.tileRank(0, j);
-            bool root = A.mpiRank() == A.tileRank(0, j);
-
-            int tag = tag_base + j;
-
-            // Apply pivots forward (0, ..., k-1) or reverse (k-1, ..., 0)
-            int64_t begin, end, inc;
-            if (direction == Direction::Forward) {
-                begin = 0;
-                end   = pivot.size();
-                inc   = 1;
+        // Groups of block columns swapped in one exchange each.
+        // By default, each block column is its own group.
+        // Every rank computes the same groups, ordered by first column.
+        std::vector< std::vector<int64_t> > groups;
+        if (aggregate_swaps()) {
+            // Group block columns by the ranks owning their pivoted tiles.
+            // The first entry is the root rank, owning tile (0, j).
+            std::map< std::vector<int>, std::vector<int64_t> > group_map;
+            for (int64_t j = 0; j < A.nt(); ++j) {
+                std::vector<int> ranks;
+                for (int64_t i : pivoted_tile_rows) {
+                    ranks.push_back( A.tileRank(i, j) );
+                }
+                group_map[ ranks ].push_back( j );
+            }
+            for (auto& group : group_map) {
+                groups.push_back( std::move( group.second ) );
             }
-            else {
-                begin = pivot.size() - 1;
-                end   = -1;
-                inc   = -1;
+            std::sort( groups.begin(), groups.end() );
+        }
+        else {
+            for (int64_t j = 0; j < A.nt(); ++j) {
+                groups.push_back( { j } );
             }
+        }
+
+        // Apply pivots forward (0, ..., k-1) or reverse (k-1, ..., 0)
+        int64_t begin, end, inc;
+        if (direction == Direction::Forward) {
+            begin = 0;
+            end   = pivot.size();
+            inc   = 1;
+        }
+        else {
+            begin = pivot.size() - 1;
+            end   = -1;
+            inc   = -1;
+        }
 
-            // Get tiles needed locally for this block column
+        // todo: what about parallelizing this? MPI blocking?
+        for (auto const& group : groups) {
+            // Ranks are the same for all block columns in the group,
+            // so use the first one to look them up.
+            int64_t j0 = group[0];
+            int root_rank = A.tileRank(0, j0);
+            bool root = A.mpiRank() == root_rank;
+
+            // The communication for the group uses the tag of its first
+            // block column, which is unique among groups.
+            int tag = tag_base + j0;
+
+            // Get tiles needed locally for these block columns.
+            // Each row in workspace spans all block columns of the group:
+            // row_offset[ jj ] is the offset of block column group[ jj ],
+            // and width is the total number of columns.
             std::set< ij_tuple > local_tiles;
-            for (int64_t i : pivoted_tile_rows) {
-                if (A.tileIsLocal(i, j)) {
-                    local_tiles.insert({i, j});
+            std::vector<int64_t> row_offset( group.size() );
+            int64_t width = 0;
+            for (size_t jj = 0; jj < group.size(); ++jj) {
+                int64_t j = group[ jj ];
+                for (int64_t i : pivoted_tile_rows) {
+                    if (A.tileIsLocal(i, j)) {
+                        local_tiles.insert({i, j});
+                    }
                 }
+                row_offset[ jj ] = width;
+                width += A.tileNb(j);
             }
             A.tileGetForWriting( local_tiles, LayoutConvert(layout) );
 
-            // process pivots
-            int64_t nb = A.tileNb(j);
-
             MPI_Datatype row_type;
-            MPI_Type_contiguous(nb, mpi_scalar, &row_type);
+            MPI_Type_contiguous(width, mpi_scalar, &row_type);
             MPI_Type_commit(&row_type);
 
             if (root) {
@@ -270,7 +325,7 @@ void permuteRows(
                 std::vector<int> remote_count(comm_size + 1);
                 for (int64_t i = begin; i != end; i += inc) {
                     auto piv = pivot[i];
-                    auto swap_rank = A.tileRank(piv.tileIndex(), j);
+                    auto swap_rank = A.tileRank(piv.tileIndex(), j0);
                     if (root_rank != swap_rank) {
                         ++remote_count[swap_rank];
                     }
@@ -284,7 +339,7 @@ void permuteRows(
                 std::map<Pivot, int> remote_pivot_table;
                 for (int64_t i = begin; i != end; i += inc) {
                     auto piv = pivot[i];
-                    auto swap_rank = A.tileRank(piv.tileIndex(), j);
+                    auto swap_rank = A.tileRank(piv.tileIndex(), j0);
                     if (root_rank != swap_rank
                         && remote_pivot_table.find(piv) == remote_pivot_table.end()) {
                         int index = remote_index[swap_rank];
@@ -298,7 +353,7 @@ void permuteRows(
                     remote_count[r] = remote_index[r] - remote_offsets[r];
                 }
 
-                std::vector<scalar_t> remote_rows_vect (remote_offsets[comm_size]*nb);
+                std::vector<scalar_t> remote_rows_vect (remote_offsets[comm_size]*width);
                 scalar_t* remote_rows = remote_rows_vect.data();
 
                 // Gather remote rows to root.
@@ -307,7 +362,7 @@ void permuteRows(
                 for (int r = 0; r < comm_size; ++r) {
                     // Assumes remote_count[root_rank] == 0
                     if (remote_count[r] != 0) {
-                        scalar_t* rows_r = remote_rows + nb*remote_offsets[r];
+                        scalar_t* rows_r = remote_rows + width*remote_offsets[r];
                         MPI_Irecv(rows_r, remote_count[r], row_type,
                                   r, tag, comm, &requests[request_count]);
                         ++request_count;
@@ -315,36 +370,56 @@ void permuteRows(
                 }
                 MPI_Waitall(request_count, requests.data(), MPI_STATUSES_IGNORE);
 
-                int64_t stride_0j = A(0, j).rowIncrement();
+                // Swap rows locally, one block column at a time.
+                auto swap_column = [&]( int64_t jj ) {
+                    int64_t j = group[ jj ];
+                    int64_t nb = A.tileNb(j);
+                    int64_t stride_0j = A(0, j).rowIncrement();
 
-                // Swap rows locally.
-            for (int64_t i = begin; i != end; i += inc) {
-                int pivot_rank = A.tileRank(pivot[i].tileIndex(), j);
+                    for (int64_t i = begin; i != end; i += inc) {
+                        int pivot_rank = A.tileRank(pivot[i].tileIndex(), j);
 
-                    if (pivot_rank == root_rank) {
-                        // If pivot not on the diagonal.
-                        if (pivot[i].tileIndex() > 0 ||
-                            pivot[i].elementOffset() > i)
-                        {
-                            // todo: assumes 1-D block cyclic distribution on devices
-                            int64_t i1 = i;
-                            int64_t i2 = pivot[i].elementOffset();
-                            int64_t idx2 = pivot[i].tileIndex();
+                        if (pivot_rank == root_rank) {
+                            // If pivot not on the diagonal.
+                            if (pivot[i].tileIndex() > 0 ||
+                                pivot[i].elementOffset() > i)
+                            {
+                                // todo: assumes 1-D block cyclic distribution on devices
+                                int64_t i1 = i;
+                                int64_t i2 = pivot[i].elementOffset();
+                                int64_t idx2 = pivot[i].tileIndex();
 
-                            int64_t stride_idx2j = A(idx2, j).rowIncrement();
+                                int64_t stride_idx2j = A(idx2, j).rowIncrement();
 
+                                blas::swap(
+                                    nb,
+                                    &A(0,    j).at(i1, 0), stride_0j,
+                                    &A(idx2, j).at(i2, 0), stride_idx2j);
+                            }
+                        }
+                        else {
+                            auto remote_idx = remote_pivot_table.at(pivot[i]);
                             blas::swap(
-                                A.tileNb(j),
-                                &A(0,    j).at(i1, 0), stride_0j,
-                                &A(idx2, j).at(i2, 0), stride_idx2j);
+                                nb,
+                                &A(0, j).at(i, 0), stride_0j,
+                                remote_rows + width*remote_idx + row_offset[ jj ], 1);
                         }
                     }
-                    else {
-                        auto remote_idx = remote_pivot_table[pivot[i]];
-                        blas::swap(
-                            A.tileNb(j),
-                            &A(0, j).at(i, 0), stride_0j,
-                            remote_rows + nb*remote_idx, 1);
+                };
+                if (A.numNumaDomains() > 1 && group.size() > 1) {
+                    // Block columns are independent, so swap them in
+                    // tasks in the NUMA domain owning tile (0, j).
+                    std::vector< std::vector<int64_t> >
+                        queues( A.numNumaDomains() );
+                    for (size_t jj = 0; jj < group.size(); ++jj) {
+                        queues[ A.tileNumaDomain( 0, group[ jj ] ) ]
+                            .push_back( jj );
+                    }
+                    numa_tasks( queues, priority, swap_column );
+                }
+                else {
+                    for (size_t jj = 0; jj < group.size(); ++jj) {
+                        swap_column( jj );
                     }
                 }
 
@@ -354,7 +429,7 @@ void permuteRows(
                 for (int r = 0; r < comm_size; ++r) {
                     // Assumes remote_count[root_rank] == 0
                     if (remote_count[r] != 0) {
-                        scalar_t* rows_r = remote_rows + nb*remote_offsets[r];
+                        scalar_t* rows_r = remote_rows + width*remote_offsets[r];
                         MPI_Isend(rows_r, remote_count[r], row_type,
                                   r, tag, comm, &requests[request_count]);
                         ++request_count;
@@ -368,7 +443,7 @@ void permuteRows(
                 int remote_length = 0;
                 for (int64_t i = begin; i != end; i += inc) {
                     auto piv = pivot[i];
-                    auto swap_rank = A.tileRank(piv.tileIndex(), j);
+                    auto swap_rank = A.tileRank(piv.tileIndex(), j0);
                     if (swap_rank == A.mpiRank()
                         && remote_pivot_table.find(piv) == remote_pivot_table.end()) {
 
@@ -378,26 +453,21 @@ void permuteRows(
                 }
 
                 if (remote_length > 0) {
-                    std::vector<scalar_t> remote_rows_vect (nb*remote_length);
+                    std::vector<scalar_t> remote_rows_vect (width*remote_length);
                     scalar_t* remote_rows = remote_rows_vect.data();
 
                     // Pack pivot rows into workspace.
-                    int64_t count = 0;
-                    for (int64_t i = begin; i != end; i += inc) {
-                        int pivot_rank = A.tileRank(pivot[i].tileIndex(), j);
-                        if (pivot_rank == A.mpiRank()) {
-                            auto remote_idx = remote_pivot_table[pivot[i]];
-                            auto tile_index = pivot[i].tileIndex();
-                            auto tile_offset = pivot[i].elementOffset();
-
-                            if (remote_idx >= count) {
-                                int64_t stride_idxj = A(tile_index, j).rowIncrement();
-                                blas::copy(
-                                    A.tileNb(j),
-                                    &A(tile_index, j).at(tile_offset, 0), stride_idxj,
-                                    remote_rows + nb*remote_idx, 1);
-                                ++count;
-                            }
+                    for (auto const& piv_idx : remote_pivot_table) {
+                        auto tile_index  = piv_idx.first.tileIndex();
+                        auto tile_offset = piv_idx.first.elementOffset();
+                        scalar_t* row = remote_rows + width*piv_idx.second;
+                        for (size_t jj = 0; jj < group.size(); ++jj) {
+                            int64_t j = group[ jj ];
+                            int64_t stride_idxj = A(tile_index, j).rowIncrement();
+                            blas::copy(
+                                A.tileNb(j),
+                                &A(tile_index, j).at(tile_offset, 0), stride_idxj,
+                                row + row_offset[ jj ], 1);
                         }
                     }
 
@@ -408,22 +478,17 @@ void permuteRows(
                              root_rank, tag, comm, MPI_STATUS_IGNORE);
 
                     // Unpack pivot rows from workspace.
-                    count = 0;
-                    for (int64_t i = begin; i != end; i += inc) {
-                        int pivot_rank = A.tileRank(pivot[i].tileIndex(), j);
-                        if (pivot_rank == A.mpiRank()) {
-                            auto remote_idx = remote_pivot_table[pivot[i]];
-                            auto tile_index = pivot[i].tileIndex();
-                            auto tile_offset = pivot[i].elementOffset();
-
-                            if (remote_idx >= count) {
-                                int64_t stride_idxj = A(tile_index, j).rowIncrement();
-                                blas::copy(
-                                    A.tileNb(j),
-                                    remote_rows + nb*remote_idx, 1,
-                                    &A(tile_index, j).at(tile_offset, 0), stride_idxj);
-                                ++count;
-                            }
+                    for (auto const& piv_idx : remote_pivot_table) {
+                        auto tile_index  = piv_idx.first.tileIndex();
+                        auto tile_offset = piv_idx.first.elementOffset();
+                        scalar_t* row = remote_rows + width*piv_idx.second;
+                        for (size_t jj = 0; jj < group.size(); ++jj) {
+                            int64_t j = group[ jj ];
+                            int64_t stride_idxj = A(tile_index, j).rowIncrement();
+                            blas::copy(
+                                A.tileNb(j),
+                                row + row_offset[ jj ], 1,
+                                &A(tile_index, j).at(tile_offset, 0), stride_idxj);
                         }
                     }
                 }
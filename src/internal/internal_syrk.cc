@@ -31,6 +31,24 @@ void syrk(scalar_t alpha, Matrix<scalar_t>&& A,
                           A.op() != Op::ConjTrans))))
         throw std::exception();
 
+    perf::Region perf_region( "syrk" );
+    if (perf::Perf::enabled()) {
+        // Lower triangle of C; diagonal tiles are half computed.
+        double flops = 0;
+        for (int64_t j = 0; j < C.nt(); ++j) {
+            for (int64_t i = j; i < C.mt(); ++i) {
+                if (C.tileIsLocal( i, j )) {
+                    double mb = C.tileMb( i );
+                    if (i == j)
+                        flops += mb * (mb + 1) * A.n();
+                    else
+                        flops += 2. * mb * C.tileNb( j ) * A.n();
+                }
+            }
+        }
+        perf_region.flops( perf::flop_factor<scalar_t>() * flops );
+    }
+
     syrk(internal::TargetType<target>(),
          alpha, A,
          beta,  C,
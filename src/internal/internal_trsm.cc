@@ -24,6 +24,16 @@ void trsm(Side side,
                                     Matrix<scalar_t>&& B,
           int priority, Layout layout, int64_t queue_index )
 {
+    perf::Region perf_region( "trsm" );
+    if (perf::Perf::enabled()) {
+        double flops = 0;
+        for (int64_t i = 0; i < B.mt(); ++i)
+            for (int64_t j = 0; j < B.nt(); ++j)
+                if (B.tileIsLocal( i, j ))
+                    flops += double( A.m() ) * B.tileMb( i ) * B.tileNb( j );
+        perf_region.flops( perf::flop_factor<scalar_t>() * flops );
+    }
+
     trsm(internal::TargetType<target>(),
          side,
          alpha, A,
@@ -12,6 +12,8 @@
 #include "slate/internal/mpi.hh"
 #include "slate/Matrix.hh"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <complex>
 
@@ -116,6 +118,175 @@ std::vector< int64_t > gelqf_compute_first_indices(
 }
 
 
+//------------------------------------------------------------------------------
+/// Runs body( item ) for each item in queues, in OpenMP tasks placed by
+/// host NUMA domain: queues[ d ] holds the items owned by domain d.
+/// One worker task per thread of the team pulls items from the queue of
+/// its thread's domain (see thread_numa_domain), then from the other
+/// domains once its own queue is empty. Waits for all items.
+/// OpenMP task affinity clauses would be the standard way to do this,
+/// but current runtimes ignore them.
+///
+/// @param[in] queues
+///     Items to process, one queue per NUMA domain.
+///
+/// @param[in] priority
+///     OpenMP priority of the worker tasks.
+///
+/// @param[in] body
+///     Function called on each item.
+///
+template <typename body_t>
+void numa_tasks(
+    std::vector< std::vector<int64_t> > const& queues, int priority,
+    body_t const& body )
+{
+    int num_domains = queues.size();
+    int64_t num_items = 0;
+    for (auto const& queue : queues)
+        num_items += queue.size();
+    int num_workers = std::min( int64_t( omp_get_num_threads() ), num_items );
+
+    // next[ d ] is the index of the next item to take from queues[ d ].
+    std::vector< std::atomic<int64_t> > next( num_domains );
+    for (auto& n : next)
+        n.store( 0 );
+
+    #pragma omp taskgroup
+    for (int w = 0; w < num_workers; ++w) {
+        #pragma omp task slate_omp_default_none \
+            shared( queues, next, body ) firstprivate( num_domains ) \
+            priority( priority )
+        {
+            int home = thread_numa_domain( num_domains );
+            for (int dd = 0; dd < num_domains; ++dd) {
+                int d = (home + dd) % num_domains;
+                int64_t size = queues[ d ].size();
+                int64_t k;
+                while ((k = next[ d ]++) < size)
+                    body( queues[ d ][ k ] );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Runs body( i, j ) for each local tile {i, j} of A, in OpenMP tasks
+/// placed on threads of the host NUMA domain owning the tile
+/// (see BaseMatrix::tileNumaDomain and numa_tasks).
+/// Used by HostTask routines when A.numNumaDomains() > 1.
+///
+template <typename scalar_t, typename body_t>
+void numa_tile_tasks( BaseMatrix<scalar_t>& A, int priority, body_t const& body )
+{
+    using ij_tuple = typename BaseMatrix<scalar_t>::ij_tuple;
+
+    std::vector< ij_tuple > tiles;
+    std::vector< std::vector<int64_t> > queues( A.numNumaDomains() );
+    for (int64_t i = 0; i < A.mt(); ++i) {
+        for (int64_t j = 0; j < A.nt(); ++j) {
+            if (A.tileIsLocal( i, j )) {
+                queues[ A.tileNumaDomain( i, j ) ].push_back( tiles.size() );
+                tiles.push_back( { i, j } );
+            }
+        }
+    }
+    numa_tasks( queues, priority, [ &tiles, &body ]( int64_t k ) {
+        body( std::get<0>( tiles[ k ] ), std::get<1>( tiles[ k ] ) );
+    } );
+}
+
+//------------------------------------------------------------------------------
+/// @return Morton (Z-order) index of {i, j}, interleaving the bits of i and j.
+/// Consecutive indices stay within small square blocks at every scale.
+///
+inline uint64_t morton_index( uint32_t i, uint32_t j )
+{
+    auto spread = []( uint64_t x ) {
+        x = (x | (x << 16)) & 0x0000ffff0000ffffull;
+        x = (x | (x <<  8)) & 0x00ff00ff00ff00ffull;
+        x = (x | (x <<  4)) & 0x0f0f0f0f0f0f0f0full;
+        x = (x | (x <<  2)) & 0x3333333333333333ull;
+        x = (x | (x <<  1)) & 0x5555555555555555ull;
+        return x;
+    };
+    return (spread( i ) << 1) | spread( j );
+}
+
+//------------------------------------------------------------------------------
+/// @return local tiles {i, j} of A in Morton order of their local block
+/// row and column, i.e., their positions among the block rows and columns
+/// this rank has tiles in. Then each 4 consecutive tiles of a 2D
+/// block-cyclic matrix form a 2-by-2 block of local tiles, which shares
+/// block rows and columns, e.g., tiles of A and B in C = AB.
+///
+template <typename scalar_t>
+std::vector< typename BaseMatrix<scalar_t>::ij_tuple >
+    morton_local_tiles( BaseMatrix<scalar_t>& A )
+{
+    using ij_tuple = typename BaseMatrix<scalar_t>::ij_tuple;
+
+    // Local block row and column of each block row and column, or -1.
+    std::vector<int64_t> local_i( A.mt(), -1 ), local_j( A.nt(), -1 );
+    for (int64_t i = 0; i < A.mt(); ++i) {
+        for (int64_t j = 0; j < A.nt(); ++j) {
+            if (A.tileIsLocal( i, j )) {
+                local_i[ i ] = 0;
+                local_j[ j ] = 0;
+            }
+        }
+    }
+    int64_t count = 0;
+    for (auto& ii : local_i) {
+        if (ii >= 0)
+            ii = count++;
+    }
+    count = 0;
+    for (auto& jj : local_j) {
+        if (jj >= 0)
+            jj = count++;
+    }
+
+    std::vector< std::pair<uint64_t, ij_tuple> > keyed;
+    for (int64_t i = 0; i < A.mt(); ++i) {
+        for (int64_t j = 0; j < A.nt(); ++j) {
+            if (A.tileIsLocal( i, j )) {
+                keyed.push_back( { morton_index( local_i[ i ], local_j[ j ] ),
+                                   { i, j } } );
+            }
+        }
+    }
+    std::sort( keyed.begin(), keyed.end(),
+               []( auto const& a, auto const& b ) { return a.first < b.first; } );
+
+    std::vector< ij_tuple > tiles;
+    tiles.reserve( keyed.size() );
+    for (auto const& k : keyed)
+        tiles.push_back( k.second );
+    return tiles;
+}
+
+//------------------------------------------------------------------------------
+/// Prefetches the host data of tile T into cache (see cache_prefetch),
+/// one column (or row, if row-major) at a time, if T has at most max_bytes,
+/// so it fits in cache along with the tiles in use.
+///
+template <typename scalar_t>
+void prefetch_tile( Tile<scalar_t> const& T, size_t max_bytes, bool for_write )
+{
+    if (T.bytes() > max_bytes)
+        return;
+
+    // Dimensions of T as stored, ignoring op.
+    bool col_major = (T.op() == Op::NoTrans) == (T.layout() == Layout::ColMajor);
+    int64_t len   = col_major ? T.mb() : T.nb();
+    int64_t count = col_major ? T.nb() : T.mb();
+    for (int64_t k = 0; k < count; ++k) {
+        cache_prefetch( T.data() + k*T.stride(), len*sizeof(scalar_t),
+                        for_write );
+    }
+}
+
 //------------------------------------------------------------------------------
 /// Helper function to check convergence in iterative methods
 template <typename scalar_t>
@@ -182,6 +353,38 @@ std::vector<int64_t> tile_offsets( RowCol dim, slate::BaseMatrix<scalar_t>& A )
     return offset_list;
 }
 
+//------------------------------------------------------------------------------
+/// Rounds the local tiles of A to A.tilePrecision(), so that the values
+/// stored locally are exactly those that tile broadcasts of A transfer.
+/// Broadcasts already round the tiles they send on the owner; this
+/// rounds the tiles that were not broadcast.
+/// For triangular and Hermitian matrices, only the stored triangle's tiles
+/// exist. Tiles are converted on the host.
+///
+/// @ingroup copy_internal
+///
+template <typename scalar_t>
+void round_to_tile_precision( BaseMatrix<scalar_t>& A )
+{
+    TilePrecision precision = A.tilePrecision();
+    if (precision == TilePrecision::Working)
+        return;
+
+    #pragma omp parallel
+    #pragma omp master
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        for (int64_t i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal( i, j ) && A.tileExists( i, j )) {
+                #pragma omp task slate_omp_default_none \
+                    shared( A ) firstprivate( i, j, precision )
+                {
+                    A.tileGetForWriting( i, j, LayoutConvert::None );
+                    tile::round16( precision, A( i, j ) );
+                }
+            }
+        }
+    }
+}
 
 } // namespace internal
 } // namespace slate
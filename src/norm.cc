@@ -65,14 +65,14 @@ norm(
         }
 
         MPI_Op op_max_nan;
-        #pragma omp critical(slate_mpi)
         {
+            internal::MpiCriticalGuard guard;
             slate_mpi_call(
                 MPI_Op_create(mpi_max_nan, true, &op_max_nan));
         }
 
-        #pragma omp critical(slate_mpi)
         {
+            internal::MpiCriticalGuard guard;
             trace::Block trace_block("MPI_Allreduce");
             slate_mpi_call(
                 MPI_Allreduce(&local_max, &global_max,
@@ -80,8 +80,8 @@ norm(
                               op_max_nan, A.mpiComm()));
         }
 
-        #pragma omp critical(slate_mpi)
         {
+            internal::MpiCriticalGuard guard;
             slate_mpi_call(
                 MPI_Op_free(&op_max_nan));
         }
@@ -105,8 +105,8 @@ norm(
 
         std::vector<real_t> global_sums(A.n());
 
-        #pragma omp critical(slate_mpi)
         {
+            internal::MpiCriticalGuard guard;
             trace::Block trace_block("MPI_Allreduce");
             slate_mpi_call(
                 MPI_Allreduce(local_sums.data(), global_sums.data(),
@@ -133,8 +133,8 @@ norm(
 
         std::vector<real_t> global_sums(A.m());
 
-        #pragma omp critical(slate_mpi)
         {
+            internal::MpiCriticalGuard guard;
             trace::Block trace_block("MPI_Allreduce");
             slate_mpi_call(
                 MPI_Allreduce(local_sums.data(), global_sums.data(),
@@ -161,8 +161,8 @@ norm(
             internal::norm<target>(in_norm, NormScope::Matrix, std::move(A), local_values);
         }
 
-        #pragma omp critical(slate_mpi)
         {
+            internal::MpiCriticalGuard guard;
             trace::Block trace_block("MPI_Allreduce");
             // todo: propogate scale
             local_sumsq = local_values[0] * local_values[0] * local_values[1];
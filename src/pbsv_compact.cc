@@ -0,0 +1,93 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed band Cholesky factorization and solve in compact band storage,
+/// for narrow bands.
+///
+/// Computes the solution to a system of linear equations
+/// \[
+///     A X = B,
+/// \]
+/// where $A$ is an n-by-n Hermitian positive definite band matrix and
+/// $X$ and $B$ are n-by-nrhs matrices,
+/// using pbtrf( CompactHermitianBandMatrix ) and
+/// pbtrs( CompactHermitianBandMatrix ).
+///
+/// Compared to pbsv( HermitianBandMatrix ), this stores only the band
+/// instead of nb-by-nb tiles, so it is preferred when kd is much less than nb.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the n-by-n Hermitian positive definite band matrix $A$,
+///     lower triangle.
+///     On exit, if return value = 0, the factor $L$ from the Cholesky
+///     factorization $A = L L^H$.
+///
+/// @param[in,out] B
+///     On entry, the n-by-nrhs right hand side matrix $B$,
+///     distributed to match A, as from A.emptyRHS( nrhs ).
+///     On exit, if return value = 0, the n-by-nrhs solution matrix $X$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently unused.
+///
+/// @return 0: successful exit
+/// @return i > 0: the leading minor of order $i$ of $A$ is not
+///         positive definite, so the factorization could not
+///         be completed, and the solution has not been computed.
+///
+/// @ingroup pbsv
+///
+template <typename scalar_t>
+int64_t pbsv(
+    CompactHermitianBandMatrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    Options const& opts)
+{
+    perf::Region perf_region( "pbsv" );
+
+    int64_t info = pbtrf( A, opts );
+
+    if (info == 0) {
+        pbtrs( A, B, opts );
+    }
+    return info;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t pbsv<float>(
+    CompactHermitianBandMatrix<float>& A,
+    Matrix<float>& B,
+    Options const& opts);
+
+template
+int64_t pbsv<double>(
+    CompactHermitianBandMatrix<double>& A,
+    Matrix<double>& B,
+    Options const& opts);
+
+template
+int64_t pbsv< std::complex<float> >(
+    CompactHermitianBandMatrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& B,
+    Options const& opts);
+
+template
+int64_t pbsv< std::complex<double> >(
+    CompactHermitianBandMatrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& B,
+    Options const& opts);
+
+} // namespace slate
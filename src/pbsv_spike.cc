@@ -0,0 +1,184 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "internal/internal.hh"
+#include "internal/internal_compact_band.hh"
+#include "internal/internal_spike.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed Hermitian positive definite band solve using the SPIKE
+/// algorithm, for narrow bands.
+///
+/// Computes the solution to a system of linear equations
+/// \[
+///     A X = B,
+/// \]
+/// where $A$ is an n-by-n Hermitian positive definite band matrix and
+/// $X$ and $B$ are n-by-nrhs matrices.
+///
+/// As in gbsv_spike, each rank independently factors its diagonal block
+/// $A_j = L_j L_j^H$ with lapack::pbtrf, then all ranks solve a small
+/// reduced system coupling the blocks. Diagonal blocks of a positive definite
+/// matrix are positive definite, so this succeeds whenever pbsv does.
+/// The coupling to the next block is the conjugate transpose of the next
+/// block's coupling to this one, so only one neighbor exchange is needed.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the n-by-n Hermitian positive definite band matrix $A$,
+///     lower triangle. With more than one rank, nb >= 2 kd.
+///     On exit, the Cholesky factors of each rank's diagonal block $A_j$.
+///
+/// @param[in,out] B
+///     On entry, the n-by-nrhs right hand side matrix $B$,
+///     distributed to match A, as from A.emptyRHS( nrhs ).
+///     On exit, if return value = 0, the n-by-nrhs solution matrix $X$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently unused.
+///
+/// @return 0: successful exit
+/// @return i > 0: the leading minor of order $i$ of $A$ is not
+///         positive definite, so the factorization could not
+///         be completed, and the solution has not been computed.
+///
+/// @ingroup pbsv
+///
+template <typename scalar_t>
+int64_t pbsv_spike(
+    CompactHermitianBandMatrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    Options const& opts)
+{
+    using blas::conj;
+
+    perf::Region perf_region( "pbsv_spike" );
+
+    // Constants
+    const scalar_t zero = 0.0;
+    const int tag_lower = 0;
+
+    internal::compact_rhs_check( A, B );
+
+    int64_t n    = A.n();
+    int64_t kd   = A.bandwidth();
+    int64_t ldab = A.stride();
+    int64_t nrhs = B.n();
+    int64_t c_begin = A.colBegin();
+    int64_t c_end   = A.colEnd();
+    int64_t nj = c_end - c_begin;
+    int rank   = A.mpiRank();
+    int nranks = A.numRanks();
+    MPI_Comm mpi_comm = A.mpiComm();
+
+    // Interface rows at the top and bottom of a block must not overlap.
+    slate_error_if( nranks > 1 && A.nb() < 2*kd );
+
+    internal::SpikePartition part( n, A.nb(), kd, kd, nranks );
+    int64_t kw = part.bottom( rank - 1 );  // couples to previous block
+    int64_t kv = part.top( rank + 1 );     // couples to next block
+
+    scalar_t* AB = A.data();
+    auto elem = [&](int64_t i, int64_t j) -> scalar_t& {
+        return AB[ i - j + (j - c_begin)*ldab ];
+    };
+
+    // Y = [ C_j  B_j  F_j ], overwritten by A_j^{-1} Y.
+    int64_t ncols = kw + kv + nrhs;
+    std::vector<scalar_t> Y( nj*ncols, zero );
+    int64_t info = 0;
+
+    if (nj > 0) {
+        // C_j is nonzero in its first min( kd, nj ) rows,
+        // from the previous rank's last kd columns.
+        int64_t c_rows = std::min( kd, nj );
+        std::vector<scalar_t> Cj( c_rows*kw );
+        MPI_Request request = MPI_REQUEST_NULL;
+        if (kw > 0) {
+            slate_mpi_call(
+                MPI_Irecv( Cj.data(), Cj.size(), mpi_type<scalar_t>::value,
+                           rank - 1, tag_lower, mpi_comm, &request ) );
+        }
+
+        // Our entries below the diagonal block are C_{j+1} for the next
+        // rank, and B_j = C_{j+1}^H for us. Clear them, leaving only A_j.
+        if (kv > 0) {
+            int64_t m = kv;
+            std::vector<scalar_t> D( m*kd, zero );
+            for (int64_t c = 0; c < kd; ++c) {
+                for (int64_t r = 0; r <= std::min( c, m - 1 ); ++r) {
+                    scalar_t& a = elem( c_end + r, c_end - kd + c );
+                    D[ r + c*m ] = a;
+                    Y[ (nj - kd + c) + (kw + r)*nj ] = conj( a );
+                    a = zero;
+                }
+            }
+            internal::compact_send_rows(
+                m*kd, 1, D.data(), m*kd, rank + 1, tag_lower, mpi_comm );
+        }
+
+        info = lapack::pbtrf( Uplo::Lower, nj, kd, AB, ldab );
+        if (info > 0)
+            info += c_begin;
+
+        slate_mpi_call( MPI_Wait( &request, MPI_STATUS_IGNORE ) );
+        if (kw > 0) {
+            lapack::lacpy( lapack::MatrixType::General, c_rows, kw,
+                           Cj.data(), c_rows, &Y[ 0 ], nj );
+        }
+        internal::compact_rhs_get( B, rank, &Y[ (kw + kv)*nj ], nj );
+    }
+
+    internal::reduce_info( &info, mpi_comm );
+    if (info != 0)
+        return info;
+
+    if (nj > 0) {
+        lapack::pbtrs( Uplo::Lower, nj, kd, ncols, AB, ldab, Y.data(), nj );
+    }
+
+    std::vector<scalar_t> X( nj*nrhs );
+    info = internal::spike_reduced_solve(
+        part, kd, kd, nrhs, rank, nranks, mpi_comm, Y, X.data(), nj );
+
+    if (info == 0 && nj > 0)
+        internal::compact_rhs_set( X.data(), nj, B, rank );
+
+    return info;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t pbsv_spike<float>(
+    CompactHermitianBandMatrix<float>& A,
+    Matrix<float>& B,
+    Options const& opts);
+
+template
+int64_t pbsv_spike<double>(
+    CompactHermitianBandMatrix<double>& A,
+    Matrix<double>& B,
+    Options const& opts);
+
+template
+int64_t pbsv_spike< std::complex<float> >(
+    CompactHermitianBandMatrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& B,
+    Options const& opts);
+
+template
+int64_t pbsv_spike< std::complex<double> >(
+    CompactHermitianBandMatrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& B,
+    Options const& opts);
+
+} // namespace slate
@@ -0,0 +1,145 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "internal/internal.hh"
+#include "internal/internal_compact_band.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed band Cholesky factorization in compact band storage,
+/// for narrow bands.
+///
+/// Computes the Cholesky factorization of an n-by-n Hermitian positive
+/// definite band matrix $A$, as lapack::pbtrf does with Uplo::Lower.
+/// The factorization has the form
+/// \[
+///     A = L L^H,
+/// \]
+/// where $L$ is lower triangular with kd subdiagonals.
+///
+/// Ranks factor their block columns in order. Since there is no pivoting,
+/// a rank's updates to the next rank's first kd columns are accumulated
+/// from zero in its halo and added there, so each rank sends and receives
+/// one message of size (kd + 1) kd.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in,out] A
+///     On entry, the n-by-n Hermitian positive definite band matrix $A$.
+///     On exit, if return value = 0, the factor $L$ from the Cholesky
+///     factorization $A = L L^H$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently unused.
+///
+/// @return 0: successful exit
+/// @return i > 0: the leading minor of order $i$ of $A$ is not
+///         positive definite, so the factorization could not
+///         be completed.
+///
+/// @ingroup pbsv_computational
+///
+template <typename scalar_t>
+int64_t pbtrf(
+    CompactHermitianBandMatrix<scalar_t>& A,
+    Options const& opts)
+{
+    using blas::real;
+    using real_t = blas::real_type<scalar_t>;
+
+    perf::Region perf_region( "pbtrf" );
+
+    // Constants
+    const real_t r_zero = 0.0;
+    const real_t r_one  = 1.0;
+    const int tag_update = 0;
+
+    int64_t n    = A.n();
+    int64_t kd   = A.bandwidth();
+    int64_t ldab = A.stride();
+    int64_t c_begin = A.colBegin();
+    int64_t c_end   = A.colEnd();
+    int64_t h_end   = A.haloEnd();
+    int rank   = A.mpiRank();
+    int nranks = A.numRanks();
+    MPI_Comm mpi_comm = A.mpiComm();
+
+    int64_t info = 0;
+    if (c_begin < c_end) {
+        scalar_t* AB = A.data();
+
+        // The halo accumulates updates to the next rank's columns.
+        std::fill( &AB[ (c_end - c_begin)*ldab ],
+                   &AB[ (h_end - c_begin)*ldab ], scalar_t( 0 ) );
+
+        // Add the previous rank's updates to our first columns.
+        int64_t prev_halo = std::min( c_begin + kd, n ) - c_begin;
+        if (rank > 0 && prev_halo > 0) {
+            internal::compact_recv_rows(
+                prev_halo*ldab, 1, AB, prev_halo*ldab,
+                rank - 1, tag_update, mpi_comm, true );
+        }
+
+        // Unblocked band Cholesky, as in lapack::pbtf2 with Uplo::Lower.
+        // Rows of the band have stride ldab - 1.
+        for (int64_t j = c_begin; j < c_end; ++j) {
+            scalar_t* Ajj = &AB[ (j - c_begin)*ldab ];
+            real_t ajj = real( Ajj[ 0 ] );
+            if (ajj <= r_zero) {
+                // Stop here, but keep the pipeline going for other ranks.
+                info = j + 1;
+                break;
+            }
+            ajj = std::sqrt( ajj );
+            Ajj[ 0 ] = ajj;
+
+            int64_t kn = std::min( kd, n - 1 - j );
+            if (kn > 0) {
+                blas::scal( kn, r_one / ajj, &Ajj[ 1 ], 1 );
+                blas::her( Layout::ColMajor, Uplo::Lower, kn,
+                           -r_one, &Ajj[ 1 ], 1,
+                                   &Ajj[ ldab ], ldab - 1 );
+            }
+        }
+
+        // Pass the accumulated updates to the next rank.
+        if (rank + 1 < nranks && h_end > c_end) {
+            internal::compact_send_rows(
+                (h_end - c_end)*ldab, 1, &AB[ (c_end - c_begin)*ldab ],
+                (h_end - c_end)*ldab, rank + 1, tag_update, mpi_comm );
+        }
+    }
+
+    internal::reduce_info( &info, mpi_comm );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t pbtrf<float>(
+    CompactHermitianBandMatrix<float>& A,
+    Options const& opts);
+
+template
+int64_t pbtrf<double>(
+    CompactHermitianBandMatrix<double>& A,
+    Options const& opts);
+
+template
+int64_t pbtrf< std::complex<float> >(
+    CompactHermitianBandMatrix< std::complex<float> >& A,
+    Options const& opts);
+
+template
+int64_t pbtrf< std::complex<double> >(
+    CompactHermitianBandMatrix< std::complex<double> >& A,
+    Options const& opts);
+
+} // namespace slate
@@ -0,0 +1,178 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "internal/internal.hh"
+#include "internal/internal_compact_band.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Distributed band Cholesky solve in compact band storage, for narrow bands.
+///
+/// Solves a system of linear equations
+/// \[
+///     A X = B
+/// \]
+/// with an n-by-n Hermitian positive definite band matrix $A$ using the
+/// Cholesky factorization $A = L L^H$ computed by
+/// pbtrf( CompactHermitianBandMatrix ).
+///
+/// The forward solve with $L$ runs over ranks in order, passing kd rows
+/// of updates to the next rank; the backward solve with $L^H$ runs in
+/// reverse order, passing kd rows of the solution to the previous rank.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     The factor $L$ from the Cholesky factorization $A = L L^H$
+///     computed by pbtrf.
+///
+/// @param[in,out] B
+///     On entry, the n-by-nrhs right hand side matrix $B$,
+///     distributed to match A, as from A.emptyRHS( nrhs ).
+///     On exit, the n-by-nrhs solution matrix $X$.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently unused.
+///
+/// @ingroup pbsv_computational
+///
+template <typename scalar_t>
+void pbtrs(
+    CompactHermitianBandMatrix<scalar_t>& A,
+    Matrix<scalar_t>& B,
+    Options const& opts)
+{
+    using blas::conj;
+    using blas::real;
+    using real_t = blas::real_type<scalar_t>;
+
+    perf::Region perf_region( "pbtrs" );
+
+    // Constants
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+    const real_t r_one  = 1.0;
+    const int tag_forward  = 0;
+    const int tag_backward = 1;
+
+    internal::compact_rhs_check( A, B );
+
+    int64_t n    = A.n();
+    int64_t kd   = A.bandwidth();
+    int64_t ldab = A.stride();
+    int64_t nrhs = B.n();
+    int64_t c_begin = A.colBegin();
+    int64_t c_end   = A.colEnd();
+    int rank   = A.mpiRank();
+    int nranks = A.numRanks();
+    MPI_Comm mpi_comm = A.mpiComm();
+
+    if (c_begin == c_end)
+        return;
+
+    scalar_t const* AB = A.data();
+
+    // Local rows [c_begin, r_end) of B: our rows, and kd rows of the next
+    // rank, which are updated by the forward solve and read by the
+    // backward solve.
+    int64_t r_end = std::min( c_end + kd, n );
+    int64_t ldx = r_end - c_begin;
+    std::vector<scalar_t> X( ldx*nrhs, zero );
+    auto Xrow = [&](int64_t i) { return &X[ i - c_begin ]; };
+
+    internal::compact_rhs_get( B, rank, Xrow( c_begin ), ldx );
+
+    //----------------------------------------
+    // Forward solve with L.
+    // Updates to the next rank's rows are accumulated from zero
+    // and added there.
+    int64_t prev_halo = std::min( c_begin + kd, n ) - c_begin;
+    if (rank > 0 && prev_halo > 0) {
+        internal::compact_recv_rows(
+            prev_halo, nrhs, Xrow( c_begin ), ldx,
+            rank - 1, tag_forward, mpi_comm, true );
+    }
+
+    for (int64_t j = c_begin; j < c_end; ++j) {
+        scalar_t const* Ajj = &AB[ (j - c_begin)*ldab ];
+        int64_t kn = std::min( kd, n - 1 - j );
+        blas::scal( nrhs, r_one / real( Ajj[ 0 ] ), Xrow( j ), ldx );
+        if (kn > 0) {
+            blas::geru( Layout::ColMajor, kn, nrhs,
+                        -one, &Ajj[ 1 ], 1, Xrow( j ), ldx,
+                              Xrow( j + 1 ), ldx );
+        }
+    }
+
+    if (rank + 1 < nranks && r_end > c_end) {
+        internal::compact_send_rows(
+            r_end - c_end, nrhs, Xrow( c_end ), ldx,
+            rank + 1, tag_forward, mpi_comm );
+    }
+
+    //----------------------------------------
+    // Backward solve with L^H, using the next rank's first kd rows
+    // of the solution.
+    if (rank + 1 < nranks && r_end > c_end) {
+        internal::compact_recv_rows(
+            r_end - c_end, nrhs, Xrow( c_end ), ldx,
+            rank + 1, tag_backward, mpi_comm, false );
+    }
+
+    std::vector<scalar_t> Lj( kd );
+    for (int64_t j = c_end - 1; j >= c_begin; --j) {
+        scalar_t const* Ajj = &AB[ (j - c_begin)*ldab ];
+        int64_t kn = std::min( kd, n - 1 - j );
+        if (kn > 0) {
+            // X( j, : ) -= L( j+1 : j+kn, j )^H X( j+1 : j+kn, : )
+            for (int64_t i = 0; i < kn; ++i)
+                Lj[ i ] = conj( Ajj[ i + 1 ] );
+            blas::gemv( Layout::ColMajor, Op::Trans, kn, nrhs,
+                        -one, Xrow( j + 1 ), ldx, Lj.data(), 1,
+                        one,  Xrow( j ), ldx );
+        }
+        blas::scal( nrhs, r_one / real( Ajj[ 0 ] ), Xrow( j ), ldx );
+    }
+
+    if (rank > 0 && prev_halo > 0) {
+        internal::compact_send_rows(
+            prev_halo, nrhs, Xrow( c_begin ), ldx,
+            rank - 1, tag_backward, mpi_comm );
+    }
+
+    internal::compact_rhs_set( Xrow( c_begin ), ldx, B, rank );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void pbtrs<float>(
+    CompactHermitianBandMatrix<float>& A,
+    Matrix<float>& B,
+    Options const& opts);
+
+template
+void pbtrs<double>(
+    CompactHermitianBandMatrix<double>& A,
+    Matrix<double>& B,
+    Options const& opts);
+
+template
+void pbtrs< std::complex<float> >(
+    CompactHermitianBandMatrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& B,
+    Options const& opts);
+
+template
+void pbtrs< std::complex<double> >(
+    CompactHermitianBandMatrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& B,
+    Options const& opts);
+
+} // namespace slate
@@ -47,6 +47,10 @@ namespace slate {
 ///       - HostNest:  nested OpenMP parallel for loop on CPU host.
 ///       - HostBatch: batched BLAS on CPU host.
 ///       - Devices:   batched BLAS on GPU device.
+///     - Option::NormEstColumns:
+///       Number of columns t >= 1 for the block 1-norm estimator,
+///       so each solve has t right-hand sides. Default 1.
+///       t = 1 uses the LAPACK lacn2 estimator; t = 2 is often more reliable.
 ///
 /// @return rcond
 ///     The reciprocal of the condition number of the matrix A,
@@ -85,37 +89,66 @@ blas::real_type<scalar_t> pocondest(
 
     real_t Ainvnorm = 0.0;
 
-    std::vector<int64_t> isave = {0, 0, 0, 0};
+    // Overwrites X by inv(A) X.
+    auto solve = [&]( int, Matrix<scalar_t>& X ) {
+        // A is symmetric, so both cases are equivalent
+        potrs( A, X, opts );
+    };
 
     auto tileMb = A.tileMbFunc();
-    auto tileNb = func::uniform_blocksize(1, 1);
     auto tileRank = A.tileRankFunc();
     auto tileDevice = A.tileDeviceFunc();
-    slate::Matrix<scalar_t> X (m, 1, tileMb, tileNb,
-                               tileRank, tileDevice, A.mpiComm());
-    X.insertLocalTiles(Target::Host);
-    slate::Matrix<scalar_t> V (m, 1, tileMb, tileNb,
-                               tileRank, tileDevice, A.mpiComm());
-    V.insertLocalTiles(Target::Host);
-    slate::Matrix<int64_t> isgn (m, 1, tileMb, tileNb,
-                                 tileRank, tileDevice, A.mpiComm());
-    isgn.insertLocalTiles(Target::Host);
+
+    int64_t t = get_option<int64_t>( opts, Option::NormEstColumns, 1 );
+    t = std::max( int64_t( 1 ), std::min( t, m ) );
 
     // initial and final value of kase is 0
     kase = 0;
-    internal::norm1est( X, V, isgn, &Ainvnorm, &kase, isave );
-
-    MPI_Bcast( &isave[0], 4, MPI_INT64_T, X.tileRank(0, 0), A.mpiComm() );
-    MPI_Bcast( &kase, 1, MPI_INT, X.tileRank(0, 0), A.mpiComm() );
-
-    while (kase != 0) {
-        // A is symmetric, so both cases are equivalent
-        potrs( A, X, opts );
+    if (t > 1) {
+        // Block estimator: each iteration is one solve with t columns.
+        auto tileNb = func::uniform_blocksize(t, t);
+        slate::Matrix<scalar_t> X (m, t, tileMb, tileNb,
+                                   tileRank, tileDevice, A.mpiComm());
+        X.insertLocalTiles(Target::Host);
+        slate::Matrix<scalar_t> S (m, t, tileMb, tileNb,
+                                   tileRank, tileDevice, A.mpiComm());
+        S.insertLocalTiles(Target::Host);
+
+        std::vector<int64_t> isave( 3 + t );
+        std::vector<int64_t> ind_hist;
+
+        internal::norm1est_block( X, S, &Ainvnorm, &kase, isave, ind_hist );
+        while (kase != 0) {
+            solve( kase, X );
+            internal::norm1est_block( X, S, &Ainvnorm, &kase, isave, ind_hist );
+        }
+    }
+    else {
+        std::vector<int64_t> isave = {0, 0, 0, 0};
+
+        auto tileNb = func::uniform_blocksize(1, 1);
+        slate::Matrix<scalar_t> X (m, 1, tileMb, tileNb,
+                                   tileRank, tileDevice, A.mpiComm());
+        X.insertLocalTiles(Target::Host);
+        slate::Matrix<scalar_t> V (m, 1, tileMb, tileNb,
+                                   tileRank, tileDevice, A.mpiComm());
+        V.insertLocalTiles(Target::Host);
+        slate::Matrix<int64_t> isgn (m, 1, tileMb, tileNb,
+                                     tileRank, tileDevice, A.mpiComm());
+        isgn.insertLocalTiles(Target::Host);
 
         internal::norm1est( X, V, isgn, &Ainvnorm, &kase, isave );
         MPI_Bcast( &isave[0], 4, MPI_INT64_T, X.tileRank(0, 0), A.mpiComm() );
         MPI_Bcast( &kase, 1, MPI_INT, X.tileRank(0, 0), A.mpiComm() );
-    } // while (kase != 0)
+
+        while (kase != 0) {
+            solve( kase, X );
+
+            internal::norm1est( X, V, isgn, &Ainvnorm, &kase, isave );
+            MPI_Bcast( &isave[0], 4, MPI_INT64_T, X.tileRank(0, 0), A.mpiComm() );
+            MPI_Bcast( &kase, 1, MPI_INT, X.tileRank(0, 0), A.mpiComm() );
+        } // while (kase != 0)
+    }
 
     // Compute the estimate of the reciprocal condition number.
     if (Ainvnorm != 0.0) {
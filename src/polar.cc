@@ -0,0 +1,415 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "slate/HermitianMatrix.hh"
+#include "slate/TriangularMatrix.hh"
+#include "internal/internal.hh"
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Copies each local tile of A into the top-left of the same tile of B,
+/// whose tiles may be taller. Both must have the same distribution.
+/// @ingroup heev_impl
+///
+template <typename scalar_t>
+void polar_pad_copy(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& B )
+{
+    #pragma omp parallel for collapse( 2 ) slate_omp_default_none \
+        shared( A, B )
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        for (int64_t i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal( i, j )) {
+                A.tileGetForReading( i, j, LayoutConvert::ColMajor );
+                B.tileGetForWriting( i, j, LayoutConvert::ColMajor );
+                auto Aij = A( i, j );
+                auto Bij = B( i, j );
+                lapack::lacpy( lapack::MatrixType::General,
+                               Aij.mb(), Aij.nb(),
+                               Aij.data(), Aij.stride(),
+                               Bij.data(), Bij.stride() );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Copies the top-left of each local tile of A into the same tile of B,
+/// the inverse of polar_pad_copy.
+/// @ingroup heev_impl
+///
+template <typename scalar_t>
+void polar_unpad_copy(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& B )
+{
+    #pragma omp parallel for collapse( 2 ) slate_omp_default_none \
+        shared( A, B )
+    for (int64_t j = 0; j < B.nt(); ++j) {
+        for (int64_t i = 0; i < B.mt(); ++i) {
+            if (B.tileIsLocal( i, j )) {
+                A.tileGetForReading( i, j, LayoutConvert::ColMajor );
+                B.tileGetForWriting( i, j, LayoutConvert::ColMajor );
+                auto Aij = A( i, j );
+                auto Bij = B( i, j );
+                lapack::lacpy( lapack::MatrixType::General,
+                               Bij.mb(), Bij.nb(),
+                               Aij.data(), Aij.stride(),
+                               Bij.data(), Bij.stride() );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// One QR-based QDWH step,
+/// \[
+///     \begin{bmatrix} \sqrt{c} X \\ I \end{bmatrix}
+///         = \begin{bmatrix} Q_1 \\ Q_2 \end{bmatrix} R,
+///     \quad
+///     X = \frac{b}{c} X + \frac{1}{\sqrt{c}} \left( a - \frac{b}{c} \right)
+///         Q_1 Q_2^H.
+/// \]
+/// Used while c is large, where forming $I + c X^H X$ would square the
+/// condition number.
+/// @ingroup heev_impl
+///
+template <typename scalar_t>
+void polar_qr_step(
+    Matrix<scalar_t>& X,
+    blas::real_type<scalar_t> a,
+    blas::real_type<scalar_t> b,
+    blas::real_type<scalar_t> c,
+    Options const& opts )
+{
+    using real_t = blas::real_type<scalar_t>;
+    using ij_tuple = typename BaseMatrix<scalar_t>::ij_tuple;
+
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    int64_t n  = X.n();
+    int64_t mt = X.mt();
+    int64_t nt = X.nt();
+
+    // W = [ X; I ] is stacked from block rows of X and block rows shaped
+    // like the columns of X, with the same distribution. The block rows
+    // of X are padded with zero rows to a full tile, since geqrf requires
+    // that only the last tile is short.
+    int64_t mb = X.tileNb( 0 );
+    for (int64_t i = 0; i < mt; ++i)
+        mb = std::max( mb, X.tileMb( i ) );
+    std::function<int64_t (int64_t)> tileMb = [ &X, mt, mb ]( int64_t i ) {
+        return i < mt ? mb : X.tileNb( i - mt );
+    };
+    std::function<int64_t (int64_t)> tileNb = X.tileNbFunc();
+    auto X_rank = X.tileRankFunc();
+    std::function<int (ij_tuple)> tileRank = [ X_rank, mt ]( ij_tuple ij ) {
+        int64_t i = std::get<0>( ij );
+        int64_t j = std::get<1>( ij );
+        return X_rank( { i < mt ? i : i - mt, j } );
+    };
+    std::function<int (ij_tuple)> tileDevice = X.tileDeviceFunc();
+
+    Matrix<scalar_t> W( mt*mb + n, n, tileMb, tileNb, tileRank, tileDevice,
+                        X.mpiComm() );
+    W.insertLocalTiles();
+    auto Q = W.emptyLike();
+    Q.insertLocalTiles();
+
+    auto W1 = W.sub( 0, mt-1, 0, nt-1 );
+    auto W2 = W.sub( mt, mt+nt-1, 0, nt-1 );
+    set( zero, zero, W1, opts );
+    polar_pad_copy( X, W1 );
+    scale( std::sqrt( c ), real_t( 1.0 ), W1, opts );
+    set( zero, one, W2, opts );
+
+    TriangularFactors<scalar_t> T;
+    geqrf( W, T, opts );
+
+    // Explicit Q = op( Q_W ) [ I; 0 ].
+    set( zero, one, Q, opts );
+    unmqr( Side::Left, Op::NoTrans, W, T, Q, opts );
+
+    // X = b/c X + (a - b/c)/sqrt(c) Q1 Q2^H, computed in the padded W1.
+    auto Q1 = Q.sub( 0, mt-1, 0, nt-1 );
+    auto Q2 = Q.sub( mt, mt+nt-1, 0, nt-1 );
+    auto Q2H = conj_transpose( Q2 );
+    set( zero, zero, W1, opts );
+    polar_pad_copy( X, W1 );
+    scalar_t alpha = (a - b/c) / std::sqrt( c );
+    scalar_t beta  = b / c;
+    gemm( alpha, Q1, Q2H, beta, W1, opts );
+    polar_unpad_copy( W1, X );
+}
+
+//------------------------------------------------------------------------------
+/// One Cholesky-based QDWH step,
+/// \[
+///     Z = I + c X^H X = U^H U,
+///     \quad
+///     X = \frac{b}{c} X + \left( a - \frac{b}{c} \right) X U^{-1} U^{-H}.
+/// \]
+/// Stable once c is moderate, and half the cost of the QR-based step.
+/// Y is m-by-n workspace.
+/// @ingroup heev_impl
+///
+template <typename scalar_t>
+void polar_chol_step(
+    Matrix<scalar_t>& X,
+    Matrix<scalar_t>& Y,
+    blas::real_type<scalar_t> a,
+    blas::real_type<scalar_t> b,
+    blas::real_type<scalar_t> c,
+    Options const& opts )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+    const real_t r_one  = 1.0;
+
+    int64_t n = X.n();
+
+    // Z = I + c X^H X, with Z distributed like the top of X, as in cholqr.
+    auto Z_general = X.emptyLike();
+    Z_general = Z_general.slice( 0, n-1, 0, n-1 );
+    Z_general.insertLocalTiles();
+    set( zero, one, Z_general, opts );
+
+    HermitianMatrix<scalar_t> Z( Uplo::Upper, Z_general );
+    auto XH = conj_transpose( X );
+    herk( c, XH, r_one, Z, opts );
+
+    // Z = U^H U.
+    int64_t info = potrf( Z, opts );
+    slate_error_if( info != 0 );
+
+    auto U  = TriangularMatrix<scalar_t>( Diag::NonUnit, Z );
+    auto UH = conj_transpose( U );
+
+    // Y = X Z^{-1} = X U^{-1} U^{-H}.
+    slate::copy( X, Y, opts );
+    trsm( Side::Right, one, U,  Y, opts );
+    trsm( Side::Right, one, UH, Y, opts );
+
+    add( scalar_t( a - b/c ), Y, scalar_t( b/c ), X, opts );
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel polar decomposition,
+/// \[
+///     A = U H,
+/// \]
+/// where $U$ has orthonormal columns and $H$ is Hermitian positive
+/// semi-definite. Uses the QR-based dynamically weighted Halley (QDWH)
+/// iteration,
+/// \[
+///     X_{k+1} = X_k (a_k I + b_k X_k^H X_k) (I + c_k X_k^H X_k)^{-1},
+/// \]
+/// starting from $X_0 = A / \|A\|_F$, with weights chosen from a lower
+/// bound on the smallest singular value of $X_k$ so that at most 6
+/// iterations are needed in double precision.
+/// While $c_k > 100$, each step is a QR factorization of a stacked
+/// (m + n)-by-n matrix (geqrf and unmqr); later steps use a Cholesky
+/// factorization of $I + c_k X_k^H X_k$ (herk, potrf, trsm). All work is in
+/// level 3 routines on distributed data, with no reduction to condensed form.
+///
+/// Complexity (in real): between $\approx 10 m n^2$ and $\approx 40 m n^2$
+/// flops, depending on the condition of $A$.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     The m-by-n matrix $A$, with m >= n. Not modified.
+///     Currently, tiles must be square (mb = nb).
+///
+/// @param[out] U
+///     The m-by-n matrix $U$, with the same tiling as $A$.
+///     On exit, the orthonormal polar factor.
+///
+/// @param[out] H
+///     On entry, if H is empty, does not compute the Hermitian factor.
+///     Otherwise, the n-by-n matrix $H$ to store $U^H A$.
+///     On exit, the Hermitian polar factor, which is Hermitian only up to
+///     rounding errors since both triangles are computed.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::MaxIterations:
+///       Maximum number of QDWH iterations. Default 20.
+///     - Option::Lookahead:
+///       Number of panels to overlap with matrix updates.
+///       lookahead >= 0. Default 1.
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// @return the number of QDWH iterations taken.
+///
+/// @ingroup heev
+///
+template <typename scalar_t>
+int64_t polar(
+    Matrix<scalar_t>& A,
+    Matrix<scalar_t>& U,
+    Matrix<scalar_t>& H,
+    Options const& opts )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    perf::Region perf_region( "polar" );
+
+    Timer t_polar;
+
+    // Constants
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+    const real_t r_one  = 1.0;
+    const real_t eps    = std::numeric_limits<real_t>::epsilon();
+
+    int64_t m = A.m();
+    int64_t n = A.n();
+    bool wanth = (H.mt() > 0);
+
+    slate_error_if( m < n );
+    slate_error_if( U.m() != m || U.n() != n );
+    slate_error_if( wanth && (H.m() != n || H.n() != n) );
+
+    int64_t itermax = get_option<int64_t>( opts, Option::MaxIterations, 20 );
+
+    if (n == 0)
+        return 0;
+
+    // X = A / ||A||_F, so sigma_max( X ) <= 1.
+    real_t Anorm = norm( Norm::Fro, A, opts );
+    if (Anorm == 0) {
+        // Any matrix with orthonormal columns is a polar factor of 0.
+        set( zero, one, U, opts );
+        if (wanth)
+            set( zero, zero, H, opts );
+        return 0;
+    }
+
+    auto X = A.emptyLike();
+    X.insertLocalTiles();
+    slate::copy( A, X, opts );
+    scale( r_one, Anorm, X, opts );
+
+    // Lower bound on sigma_min( X ) = sigma_min( R ) from a condition
+    // estimate of R in X = QR, using
+    // sigma_min( R ) >= 1 / (sqrt( n ) ||R^{-1}||_1).
+    Timer t_bound;
+    real_t L;
+    {
+        auto W = X.emptyLike();
+        W.insertLocalTiles();
+        slate::copy( X, W, opts );
+        TriangularFactors<scalar_t> T;
+        geqrf( W, T, opts );
+        auto W_nn = W.slice( 0, n-1, 0, n-1 );
+        auto R = TriangularMatrix<scalar_t>( Uplo::Upper, Diag::NonUnit, W_nn );
+        real_t Rnorm = norm( Norm::One, R, opts );
+        real_t rcond = trcondest( Norm::One, R, Rnorm, opts );
+        L = rcond * Rnorm / std::sqrt( real_t( n ) );
+        L = std::min( std::max( L, eps ), r_one );
+    }
+    timers[ "polar::bound" ] = t_bound.stop();
+
+    // Workspace for the previous iterate and the Cholesky step.
+    auto X_prev = X.emptyLike();
+    X_prev.insertLocalTiles();
+    auto Y = X.emptyLike();
+    Y.insertLocalTiles();
+
+    const real_t tol = std::cbrt( 5*eps );
+
+    Timer t_iter;
+    int64_t iter = 0;
+    real_t diff = 1;
+    while (iter < itermax
+           && (diff > tol || std::abs( r_one - L ) > 5*eps)) {
+        // Dynamically weighted Halley parameters.
+        real_t L2 = L*L;
+        real_t dd = std::cbrt( 4*(1 - L2) / (L2*L2) );
+        real_t sqd = std::sqrt( 1 + dd );
+        real_t a = sqd + std::sqrt( 8 - 4*dd + 8*(2 - L2) / (L2*sqd) ) / 2;
+        real_t b = (a - 1)*(a - 1) / 4;
+        real_t c = a + b - 1;
+        L = std::min( L*(a + b*L2) / (1 + c*L2), r_one );
+
+        slate::copy( X, X_prev, opts );
+        if (c > 100) {
+            impl::polar_qr_step( X, a, b, c, opts );
+        }
+        else {
+            impl::polar_chol_step( X, Y, a, b, c, opts );
+        }
+
+        // diff = || X - X_prev ||_F
+        add( one, X, -one, X_prev, opts );
+        diff = norm( Norm::Fro, X_prev, opts );
+        ++iter;
+    }
+    timers[ "polar::iter" ] = t_iter.stop();
+
+    slate::copy( X, U, opts );
+
+    if (wanth) {
+        Timer t_h;
+        auto UH = conj_transpose( U );
+        gemm( one, UH, A, zero, H, opts );
+        timers[ "polar::h" ] = t_h.stop();
+    }
+
+    timers[ "polar" ] = t_polar.stop();
+    return iter;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t polar<float>(
+    Matrix<float>& A,
+    Matrix<float>& U,
+    Matrix<float>& H,
+    Options const& opts);
+
+template
+int64_t polar<double>(
+    Matrix<double>& A,
+    Matrix<double>& U,
+    Matrix<double>& H,
+    Options const& opts);
+
+template
+int64_t polar< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    Matrix< std::complex<float> >& U,
+    Matrix< std::complex<float> >& H,
+    Options const& opts);
+
+template
+int64_t polar< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    Matrix< std::complex<double> >& U,
+    Matrix< std::complex<double> >& H,
+    Options const& opts);
+
+} // namespace slate
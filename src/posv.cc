@@ -73,6 +73,8 @@ int64_t posv(
     Matrix<scalar_t>& B,
     Options const& opts)
 {
+    perf::Region perf_region( "posv" );
+
     Timer t_posv;
 
     slate_assert(B.mt() == A.mt());
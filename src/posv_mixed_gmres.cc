@@ -34,6 +34,19 @@ namespace slate {
 /// the size of the matrix into account. This might be automated in the future.
 /// Up to now, we always try iterative refinement.
 ///
+/// Optionally, a third precision level communicates the low-precision
+/// factors in a 16-bit format (Option::TilePrecision).
+/// potrf still computes in single precision, but the tile broadcasts in
+/// potrf and in each solve inside the GMRES loop send fp16 or bfloat16
+/// values, halving their volume again. Each tile is rounded to that
+/// format on its owner before it is sent, and the remaining factor tiles
+/// are rounded after potrf, so all ranks use the same factors. Tiles
+/// are still stored in single precision, so memory use is unchanged.
+/// The refinement in double precision corrects for the less accurate
+/// preconditioner, at the cost of more GMRES iterations;
+/// bfloat16 has the range of single but only 8 significant bits,
+/// while fp16 has 11 bits but overflows above 65504.
+///
 /// GMRES-IR process is stopped if iter > itermax or for all the RHS,
 /// $1 \le j \le nrhs$, we have:
 ///     $\norm{r_j}_{inf} < tol \norm{x_j}_{inf} \norm{A}_{inf},$
@@ -98,6 +111,10 @@ namespace slate {
 ///     - Option::UseFallbackSolver:
 ///       If true and iterative refinement fails to converge, the problem is
 ///       resolved with partial-pivoted LU. Default true
+///     - Option::TilePrecision:
+///       Precision to communicate the low-precision factors.
+///       Working (single) [default], Half (fp16), or BFloat16.
+///       Ignored for Target::Devices, since conversion is done on the host.
 ///
 /// @return 0: successful exit
 /// @return i > 0: the leading minor of order $i$ of $A$ is not
@@ -131,6 +148,11 @@ int64_t posv_mixed_gmres(
     int64_t itermax = get_option<int64_t>( opts, Option::MaxIterations, 30 );
     double tol = get_option<double>( opts, Option::Tolerance, eps*std::sqrt(A.m()) );
     bool use_fallback = get_option<int64_t>( opts, Option::UseFallbackSolver, true );
+    TilePrecision tile_precision = get_option(
+        opts, Option::TilePrecision, TilePrecision::Working );
+    // 16-bit conversions are done in software on the host.
+    if (target == Target::Devices)
+        tile_precision = TilePrecision::Working;
     int64_t restart = blas::min( 30, itermax, A.tileMb( 0 )-1 );
     bool converged = false;
     iter = 0;
@@ -148,6 +170,7 @@ int64_t posv_mixed_gmres(
     R.insertLocalTiles( target );
     auto A_lo = A.template emptyLike<scalar_lo>();
     A_lo.insertLocalTiles( target );
+    A_lo.setTilePrecision( tile_precision );
     auto X_lo = X.template emptyLike<scalar_lo>();
     X_lo.insertLocalTiles( target );
 
@@ -209,6 +232,10 @@ int64_t posv_mixed_gmres(
         iter = -3;
     }
     else {
+        // Round the factor tiles that potrf didn't broadcast, so all
+        // tiles match what the potrs broadcasts transfer.
+        internal::round_to_tile_precision( A_lo );
+
         // Solve the system A * X = B in low precision.
         slate::copy( B, X_lo, opts );
         Timer t_potrs_lo;
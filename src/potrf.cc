@@ -90,6 +90,12 @@ int64_t potrf(
             #pragma omp task depend(inout:column[k]) priority( priority_0 ) \
                 shared( info )
             {
+                // In out-of-core mode, start reading in the column that
+                // enters the lookahead window in the next step.
+                int64_t kl = k+1+lookahead;
+                if (kl < A_nt)
+                    A.sub(kl, A_nt-1, kl, kl).prefetchLocalTiles();
+
                 // factor A(k, k)
                 int64_t iinfo;
                 if (target == Target::Devices) {
@@ -189,6 +195,9 @@ int64_t potrf(
 
                 // Erase local workspace on devices.
                 panel.releaseLocalWorkspace();
+
+                // Column k is final; in out-of-core mode, drop it from RAM.
+                panel.evictLocalTiles();
             }
             kk += A.tileNb( k );
         }
@@ -263,6 +272,8 @@ int64_t potrf(
     HermitianMatrix<scalar_t>& A,
     Options const& opts)
 {
+    perf::Region perf_region( "potrf" );
+
     using internal::TargetType;
 
     Target target = get_option<Option::Target>( opts, Target::HostTask );
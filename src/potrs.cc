@@ -56,6 +56,8 @@ void potrs(HermitianMatrix<scalar_t>& A,
            Matrix<scalar_t>& B,
            Options const& opts)
 {
+    perf::Region perf_region( "potrs" );
+
     // Constants
     const scalar_t one  = 1;
 
@@ -0,0 +1,280 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "internal/internal.hh"
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Orthonormalizes the columns of the tall matrix Y in place.
+/// A single Cholesky QR pass loses orthogonality in proportion to
+/// $\kappa(Y)^2$, so a second pass is applied to the computed Q.
+/// R is l-by-l workspace, overwritten.
+/// @ingroup svd_impl
+///
+template <typename scalar_t>
+void rsvd_orth(
+    Matrix<scalar_t>& Y,
+    Matrix<scalar_t>& R,
+    Options const& opts )
+{
+    cholqr( Y, R, opts );
+    cholqr( Y, R, opts );
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Distributed parallel randomized truncated singular value decomposition.
+/// Computes approximations to the k largest singular values and,
+/// optionally, the corresponding singular vectors of an m-by-n matrix A,
+/// so that
+/// \[
+///     A \approx U \Sigma V^H,
+/// \]
+/// where $U$ is m-by-k, $V$ is n-by-k, and $\Sigma$ is k-by-k.
+///
+/// The range of $A$ is sampled by a Gaussian sketch $Y = A \Omega$ with
+/// $l = \min( k + oversample, m, n )$ columns. Each of the power iterations
+/// applies $A A^H$ to $Y$, re-orthonormalizing after every product with
+/// Cholesky QR, which sharpens the decay of the spectrum. Finally,
+/// $Z = A^H Y$ is orthonormalized to $Q_z$, and the small
+/// l-by-l projected matrix $C^H = Z^H Q_z$ is factored with svd,
+/// $C^H = U_c \Sigma V_c^H$, giving $U = Y U_c$ and $V = Q_z V_c$.
+/// Only gemm, cholqr, and an svd of order l operate on distributed data,
+/// so the cost is dominated by the $2 q + 2$ products with $A$.
+///
+/// Complexity (in real): $\approx 2 (2 q + 2) m n l$ flops,
+/// where q = power_iters.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] A
+///     The m-by-n matrix $A$. Not modified.
+///     Currently, tiles must be square (mb = nb).
+///
+/// @param[in] k
+///     The number of singular triplets to compute. 0 <= k <= min( m, n ).
+///
+/// @param[in] oversample
+///     The number of extra sketch columns, oversample >= 0.
+///     Typically 5 to 20.
+///
+/// @param[in] power_iters
+///     The number of power iterations, power_iters >= 0. Typically 1 to 3;
+///     more iterations improve accuracy when the spectrum decays slowly.
+///
+/// @param[out] Sigma
+///     On exit, resized to k and containing approximations to the k largest
+///     singular values, in descending order.
+///
+/// @param[out] U
+///     On entry, if U is empty, does not compute the left singular vectors.
+///     Otherwise, the m-by-k matrix $U$ to store the left singular vectors.
+///     On exit, the approximate left orthonormal singular vectors.
+///
+/// @param[out] VT
+///     On entry, if VT is empty, does not compute the right singular vectors.
+///     Otherwise, the k-by-n matrix $VT$ to store the right singular vectors.
+///     On exit, the approximate right orthonormal singular vectors.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::Lookahead:
+///       Number of panels to overlap with matrix updates.
+///       lookahead >= 0. Default 1.
+///     - Option::MethodCholQR:
+///       Algorithm to compute the Gram matrix in cholqr; see cholqr.
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// @ingroup svd
+///
+template <typename scalar_t>
+void rsvd(
+    Matrix<scalar_t>& A,
+    int64_t k,
+    int64_t oversample,
+    int64_t power_iters,
+    std::vector< blas::real_type<scalar_t> >& Sigma,
+    Matrix<scalar_t>& U,
+    Matrix<scalar_t>& VT,
+    Options const& opts )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    perf::Region perf_region( "rsvd" );
+
+    Timer t_rsvd;
+
+    // Constants
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+    const int64_t seed = 42;
+
+    int64_t m = A.m();
+    int64_t n = A.n();
+    int64_t min_mn = std::min( m, n );
+
+    slate_error_if( k < 0 || k > min_mn );
+    slate_error_if( oversample < 0 );
+    slate_error_if( power_iters < 0 );
+
+    bool wantu  = (U.mt() > 0);
+    bool wantvt = (VT.mt() > 0);
+    slate_error_if( wantu  && (U.m()  != m || U.n()  != k) );
+    slate_error_if( wantvt && (VT.m() != k || VT.n() != n) );
+
+    Sigma.resize( k );
+    if (k == 0)
+        return;
+
+    int64_t l = std::min( k + oversample, min_mn );
+
+    auto AH = conj_transpose( A );
+
+    // Y is m-by-l, Z is n-by-l, and R is l-by-l,
+    // sharing the tile distribution of A.
+    auto Y = A.emptyLike();
+    Y = Y.slice( 0, m-1, 0, l-1 );
+    Y.insertLocalTiles();
+
+    auto Z = A.emptyLike( 0, 0, Op::ConjTrans );
+    Z = Z.slice( 0, n-1, 0, l-1 );
+    Z.insertLocalTiles();
+
+    auto R = A.emptyLike();
+    R = R.slice( 0, l-1, 0, l-1 );
+    R.insertLocalTiles();
+
+    // Y = orth( A Omega ), with the Gaussian sketch Omega held in Z.
+    Timer t_sketch;
+    internal::randn( Z, seed );
+    gemm( one, A, Z, zero, Y, opts );
+    impl::rsvd_orth( Y, R, opts );
+    double time_sketch = t_sketch.stop();
+
+    // Power iterations: Y = orth( A orth( A^H Y ) ).
+    Timer t_power;
+    for (int64_t iter = 0; iter < power_iters; ++iter) {
+        gemm( one, AH, Y, zero, Z, opts );
+        impl::rsvd_orth( Z, R, opts );
+        gemm( one, A, Z, zero, Y, opts );
+        impl::rsvd_orth( Y, R, opts );
+    }
+    double time_power = t_power.stop();
+
+    // Project: Y^H A = Z^H = (Qz C)^H, where Z = A^H Y,
+    // Qz = orth( Z ), and C = Qz^H Z is l-by-l.
+    // R = C^H = Z^H Qz is formed directly.
+    Timer t_project;
+    gemm( one, AH, Y, zero, Z, opts );
+
+    auto Qz = Z.emptyLike();
+    Qz.insertLocalTiles();
+    slate::copy( Z, Qz, opts );
+    impl::rsvd_orth( Qz, R, opts );
+
+    auto ZH = conj_transpose( Z );
+    gemm( one, ZH, Qz, zero, R, opts );
+    double time_project = t_project.stop();
+
+    // SVD of the small matrix, C^H = Uc Sigma Vc^H.
+    // svd clears the timers, so they are saved after it.
+    Timer t_svd;
+    std::vector<real_t> Sigma_l( l );
+    Matrix<scalar_t> Uc, VcT;
+    if (wantu) {
+        Uc = R.emptyLike();
+        Uc.insertLocalTiles();
+    }
+    if (wantvt) {
+        VcT = R.emptyLike();
+        VcT.insertLocalTiles();
+    }
+    svd( R, Sigma_l, Uc, VcT, opts );
+    std::copy( Sigma_l.begin(), Sigma_l.begin() + k, Sigma.begin() );
+    double time_svd = t_svd.stop();
+
+    // Back-transform the leading k vectors.
+    Timer t_vectors;
+    if (wantu) {
+        // U = Y Uc( :, 0:k-1 )
+        auto Uc_k = Uc.slice( 0, l-1, 0, k-1 );
+        gemm( one, Y, Uc_k, zero, U, opts );
+    }
+    if (wantvt) {
+        // VT = Vc( :, 0:k-1 )^H Qz^H
+        auto VcT_k = VcT.slice( 0, k-1, 0, l-1 );
+        auto QzH = conj_transpose( Qz );
+        gemm( one, VcT_k, QzH, zero, VT, opts );
+    }
+
+    timers[ "rsvd::sketch"  ] = time_sketch;
+    timers[ "rsvd::power"   ] = time_power;
+    timers[ "rsvd::project" ] = time_project;
+    timers[ "rsvd::svd"     ] = time_svd;
+    timers[ "rsvd::vectors" ] = t_vectors.stop();
+    timers[ "rsvd" ] = t_rsvd.stop();
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void rsvd<float>(
+    Matrix<float>& A,
+    int64_t k,
+    int64_t oversample,
+    int64_t power_iters,
+    std::vector<float>& Sigma,
+    Matrix<float>& U,
+    Matrix<float>& VT,
+    Options const& opts);
+
+template
+void rsvd<double>(
+    Matrix<double>& A,
+    int64_t k,
+    int64_t oversample,
+    int64_t power_iters,
+    std::vector<double>& Sigma,
+    Matrix<double>& U,
+    Matrix<double>& VT,
+    Options const& opts);
+
+template
+void rsvd< std::complex<float> >(
+    Matrix< std::complex<float> >& A,
+    int64_t k,
+    int64_t oversample,
+    int64_t power_iters,
+    std::vector<float>& Sigma,
+    Matrix< std::complex<float> >& U,
+    Matrix< std::complex<float> >& VT,
+    Options const& opts);
+
+template
+void rsvd< std::complex<double> >(
+    Matrix< std::complex<double> >& A,
+    int64_t k,
+    int64_t oversample,
+    int64_t power_iters,
+    std::vector<double>& Sigma,
+    Matrix< std::complex<double> >& U,
+    Matrix< std::complex<double> >& VT,
+    Options const& opts);
+
+} // namespace slate
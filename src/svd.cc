@@ -152,6 +152,8 @@ void svd(
     Matrix<scalar_t>& VT,
     Options const& opts)
 {
+    perf::Region perf_region( "svd" );
+
     Timer t_svd;
     timers.clear();
 
@@ -86,6 +86,8 @@ void trsm(blas::Side side,
                                     Matrix<scalar_t>& B,
           Options const& opts)
 {
+    perf::Region perf_region( "trsm" );
+
     MethodTrsm method = get_option(
         opts, Option::MethodTrsm, MethodTrsm::Auto );
 
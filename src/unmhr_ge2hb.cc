@@ -0,0 +1,128 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "internal/internal.hh"
+#include "internal/internal_util.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Multiplies the general m-by-n matrix C by Q from `slate::ge2hb` as
+/// follows:
+///
+/// op              |  side = Left  |  side = Right
+/// --------------- | ------------- | --------------
+/// op = NoTrans    |  $Q C  $      |  $C Q  $
+/// op = ConjTrans  |  $Q^H C$      |  $C Q^H$
+///
+/// where $Q$ is a unitary matrix defined as the product of the
+/// block reflectors of each panel,
+/// \[
+///     Q = Q_0 Q_1 . . . Q_{nt-2}.
+/// \]
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] side
+///     - Side::Left:  apply $Q$ or $Q^H$ from the left;
+///     - Side::Right: apply $Q$ or $Q^H$ from the right.
+///
+/// @param[in] op
+///     - Op::NoTrans    apply $Q$;
+///     - Op::ConjTrans: apply $Q^H$;
+///     - Op::Trans:     apply $Q^T$ (only if real).
+///       In the real case, Op::Trans is equivalent to Op::ConjTrans.
+///       In the complex case, Op::Trans is not allowed.
+///
+/// @param[in] A
+///     On entry, the n-by-n matrix $A$, as returned by `slate::ge2hb`.
+///
+/// @param[in] T
+///     On entry, triangular matrices of the block reflectors,
+///     as returned by `slate::ge2hb`.
+///
+/// @param[in,out] C
+///     On entry, the m-by-n matrix $C$.
+///     On exit, $C$ is overwritten by $Q C$, $Q^H C$, $C Q$, or $C Q^H$.
+///     Tiles of C must be nb-by-nb, as for A. For side = Left, the rows
+///     of C must be distributed like the rows of A; for side = Right,
+///     the columns of C must be distributed like the rows of A, e.g.,
+///     C on the same square process grid as A.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - HostBatch: batched BLAS on CPU host.
+///       - Devices:   batched BLAS on GPU device.
+///
+/// @ingroup geev_computational
+///
+template <typename scalar_t>
+void unmhr_ge2hb(
+    Side side, Op op,
+    Matrix<scalar_t>& A,
+    TriangularFactors<scalar_t>& T,
+    Matrix<scalar_t>& C,
+    Options const& opts)
+{
+    // Q = Q_0 ... Q_{nt-2} is the Q of the QR factorization of A
+    // shifted down one block row, as in unmtr_he2hb.
+    slate::TriangularFactors<scalar_t> T_sub = {
+        T[ 0 ].sub( 1, A.mt()-1, 0, A.nt()-1 ),
+        T[ 1 ].sub( 1, A.mt()-1, 0, A.nt()-1 )
+    };
+    auto A_sub = A.sub( 1, A.mt()-1, 0, A.nt()-1 );
+
+    int64_t i0 = (side == Side::Left) ? 1 : 0;
+    int64_t i1 = (side == Side::Left) ? 0 : 1;
+
+    auto C_sub = C.sub( i0, C.mt()-1, i1, C.nt()-1 );
+
+    slate::unmqr( side, op, A_sub, T_sub, C_sub, opts );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void unmhr_ge2hb<float>(
+    Side side, Op op,
+    Matrix<float>& A,
+    TriangularFactors<float>& T,
+    Matrix<float>& C,
+    Options const& opts);
+
+template
+void unmhr_ge2hb<double>(
+    Side side, Op op,
+    Matrix<double>& A,
+    TriangularFactors<double>& T,
+    Matrix<double>& C,
+    Options const& opts);
+
+template
+void unmhr_ge2hb< std::complex<float> >(
+    Side side, Op op,
+    Matrix< std::complex<float> >& A,
+    TriangularFactors< std::complex<float> >& T,
+    Matrix< std::complex<float> >& C,
+    Options const& opts);
+
+template
+void unmhr_ge2hb< std::complex<double> >(
+    Side side, Op op,
+    Matrix< std::complex<double> >& A,
+    TriangularFactors< std::complex<double> >& T,
+    Matrix< std::complex<double> >& C,
+    Options const& opts);
+
+} // namespace slate
@@ -368,6 +368,7 @@ if (opts.blas3):
     [ 'gemm',  gen + dtype + la + transA + transB + mnk + ab + matrixBC + nonuniform_nb + ge_matrix ],
     [ 'gemmA', gen + dtype + la + transA + transB + mnk + ab + matrixBC + nonuniform_nb + ge_matrix ],
     [ 'gemmC', gen + dtype + la + transA + transB + mnk + ab + matrixBC + nonuniform_nb + ge_matrix ],
+    [ 'gemm',  gen + dtype + la + n + mnk + ab + matrixBC + ' --method-gemm strassen --depth 0,1,2' ],
 
     [ 'hemm',  gen + dtype         + la + side + he_matrix     + mn + ab + matrixBC ],
     # todo: hemmA GPU support
@@ -425,9 +426,33 @@ if (opts.lu):
     #[ 'geequ', gen + dtype + la + n ],
     [ 'gesv_mixed',   gen + dtype_double + la + n + ge_matrix + nonuniform_nb ],
     [ 'gesv_mixed_gmres',  gen + dtype_double + la + n + ' --nrhs 1' + ge_matrix + nonuniform_nb ],
+    [ 'gesv_mixed_gmres',  gen + dtype_double + la + n + ' --nrhs 1 --tile-prec fp16,bf16' + ge_matrix + nonuniform_nb ],
     [ 'gesv_rbt', gen + dtype + la + n + ge_matrix ],
     ]
 
+    # Non-square process grids, so pivot rows of a block column have
+    # several owners and permuteRows exchanges rows between them.
+    # Small nb gives each rank several tiles.
+    nprocs = int( opts.np )
+    grids = [ '%dx%d' % (p, nprocs // p) for p in range( 1, nprocs + 1 )
+              if (nprocs % p == 0 and p*p != nprocs) ]
+    if (grids and not opts.grid):
+        grid_nonsquare = ' --grid ' + ','.join( grids ) + ' --nb 16'
+        cmds += [
+        [ 'getrf',        gen_no_nb + grid_nonsquare + dtype + la + n + ge_matrix + threshold ],
+        [ 'getrf_tntpiv', gen_no_nb + grid_nonsquare + dtype + la + n + ge_matrix ],
+        [ 'gesv',         gen_no_nb + grid_nonsquare + dtype + la + n + ge_matrix + threshold ],
+        ]
+
+    # CALU panel with the in-rank reduction tree, which is used for
+    # host targets with more than 1 panel thread. Odd thread counts give
+    # unpaired leaves; 8 threads exceeds the local tiles of small panels.
+    gen_calu_tree = origin + ' --target t' + grid + check + ref + tol + repeat
+    cmds += [
+    [ 'getrf_tntpiv', gen_calu_tree + ' --nb 16 --panel-threads 1,2,3,8' + dtype + la + n + ge_matrix ],
+    [ 'gesv_tntpiv',  gen_calu_tree + ' --nb 16 --panel-threads 1,2,3,8' + dtype + la + n + ge_matrix ],
+    ]
+
 # LU banded
 if (opts.lu_band):
     cmds += [
@@ -449,6 +474,7 @@ if (opts.chol):
     #[ 'poequ', gen + dtype + la + n ],  # only diagonal elements (no uplo)
     [ 'posv_mixed', gen + dtype_double + la + n + he_matrix ],
     [ 'posv_mixed_gmres',  gen + dtype_double + la + n + ' --nrhs 1' + he_matrix ],
+    [ 'posv_mixed_gmres',  gen + dtype_double + la + n + ' --nrhs 1 --tile-prec fp16,bf16' + he_matrix ],
     [ 'trtri', gen + dtype + la + n + uplo + diag ],
     ]
 
@@ -478,6 +504,7 @@ if (opts.hesv):
     cmds += [
     # todo: nb, uplo
     [ 'hesv',  gen_no_nb + ' --nb 50' + dtype + la + n ],
+    [ 'hesv_rbt', gen + dtype + la + n + uplo ],
     [ 'hetrf', gen_no_nb + ' --nb 50' + dtype + la + n ],
     [ 'hetrs', gen_no_nb + ' --nb 50' + dtype + la + n ],
     #[ 'hetri', gen + dtype + la + n + uplo ],
@@ -502,6 +529,9 @@ if (opts.least_squares):
 if (opts.qr):
     cmds += [
     [ 'cholqr', gen + dtype + la + n + tall ],  # not wide
+    [ 'cholqr', gen + dtype + la + n + tall + ' --method-cholQR cholQR2' ],
+    # Shifted CholeskyQR3 is stable up to kappa(A) ~ 1/eps.
+    [ 'cholqr', gen + dtype + la + n + tall + ' --method-cholQR sCholQR3 --matrix svd --cond 1e5' ],
     [ 'geqrf', gen + dtype + la + mn ],
     [ 'unmqr', gen + dtype + la + mn ],
     #[ 'ggqrf', gen + dtype + la + mnk ],
@@ -549,6 +579,12 @@ if (opts.syev):
     if ('v' in jobz):
         cmds += [[ 'heev', gen + dtype + la + n + ' --jobz v --method-eig dc' ]]
         cmds += [[ 'heev', gen + dtype + la + n + ' --jobz v --method-eig qr' ]]
+        cmds += [[ 'heev', gen + dtype + la + n + ' --jobz v --method-eig qdwh' ]]
+
+    cmds += [
+    [ 'polar', gen + dtype + n + tall ],  # not wide
+    [ 'polar', gen + dtype + n + tall + ' --matrix svd --cond 1e5' ],
+    ]
 
     cmds += [
     # heev uses only side=l, no-trans. side=r and trans don't yet work
@@ -590,6 +626,7 @@ if (opts.sygv):
 if (opts.geev):
     cmds += [
     #[ 'geev',  gen + dtype + la + n + jobvl + jobvr ],
+    [ 'ge2hb', gen + dtype + n ],
     #[ 'ggev',  gen + dtype + la + n + jobvl + jobvr ],
     #[ 'geevx', gen + dtype + la + n + balanc + jobvl + jobvr + sense ],
     #[ 'gehrd', gen + dtype + la + n ],
@@ -610,6 +647,8 @@ if (opts.svd):
         cmds += [[ 'svd', gen + dtype + la + mn + ' --jobu a --jobvt a' + ge_matrix ]]
 
     cmds += [
+    [ 'rsvd',  gen + dtype + la + mnk + ' --matrix svd_geo' + ge_matrix ],
+
     # todo: mn (wide), nb, jobu, jobvt
     [ 'ge2tb', gen + dtype + n + tall + ' --jobu v --jobvt v' ],
     # tb2bd, bdsqr don't take origin, target
@@ -637,10 +676,13 @@ if (opts.norms):
 if (opts.condest):
     cmds += [
     [ 'gecondest', gen + dtype + n ],
+    [ 'gecondest', gen + dtype + n + ' --normest-cols 2,4' ],
     [ 'pocondest', gen + dtype + n + uplo ],
+    [ 'pocondest', gen + dtype + n + uplo + ' --normest-cols 2' ],
 
     # Triangle
     [ 'trcondest', gen + dtype + n ],
+    [ 'trcondest', gen + dtype + n + ' --normest-cols 2' ],
 
     #[ 'gbcon', gen + dtype + la + n  + kl + ku ],
     #[ 'pbcon', gen + dtype + la + n + kd + uplo ],
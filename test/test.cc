@@ -58,6 +58,7 @@ using slate::MethodTrsm,   slate::MethodTrsm_help;
 using slate::NormScope,    slate::NormScope_help;
 using slate::Origin,       slate::Origin_help;
 using slate::Target,       slate::Target_help;
+using slate::TilePrecision, slate::TilePrecision_help;
 
 const ParamType PT_Value = ParamType::Value;
 const ParamType PT_List  = ParamType::List;
@@ -207,6 +208,7 @@ std::vector< testsweeper::routines_t > routines = {
     // -----
     // Hermitian indefinite
     { "hesv",                test_hesv,         Section::hesv },
+    { "hesv_rbt",            test_hesv,         Section::hesv },
     { "",                    nullptr,           Section::newline },
 
     { "hetrf",               test_hesv,         Section::hesv },
@@ -264,6 +266,9 @@ std::vector< testsweeper::routines_t > routines = {
     { "unmtr_hb2st",        test_unmtr_hb2st,  Section::heev },
     { "",                   nullptr,           Section::newline },
 
+    { "polar",              test_polar,        Section::heev },
+    { "",                   nullptr,           Section::newline },
+
     // -----
     // generalized symmetric/Hermitian eigenvalues
     { "hegv",               test_hegv,         Section::sygv },
@@ -272,10 +277,14 @@ std::vector< testsweeper::routines_t > routines = {
 
     // -----
     // non-symmetric eigenvalues
+    //{ "geev",               test_geev,         Section::geev },
+    { "ge2hb",              test_ge2hb,        Section::geev },
+    { "",                   nullptr,           Section::newline },
 
     // -----
     // SVD
     { "svd",                test_svd,          Section::svd },
+    { "rsvd",               test_rsvd,         Section::svd },
     { "ge2tb",              test_ge2tb,        Section::svd },
     { "tb2bd",              test_tb2bd,        Section::svd },
     { "bdsqr",              test_bdsqr,        Section::svd },
@@ -390,7 +399,7 @@ Params::Params():
     hold_local_workspace( "hold-local-workspace",
                               0, PT_List, 'n', "ny", "do not erase tiles in local workspace" ),
 
-    method_cholqr( "cholQR",  6, PT_List, MethodCholQR::Auto, MethodCholQR_help ),
+    method_cholqr( "cholQR",  8, PT_List, MethodCholQR::Auto, MethodCholQR_help ),
     method_eig   ( "eig",     3, PT_List, MethodEig::DC, MethodEig_help ),
     method_gels  ( "gels",    6, PT_List, MethodGels::QR, MethodGels_help ),
     method_gemm  ( "gemm",    4, PT_List, MethodGemm::Auto, MethodGemm_help ),
@@ -463,7 +472,13 @@ Params::Params():
                 " to deflate, e.g., --deflate '1 2/4 3/5'" ),
     itermax   ( "itermax",    7,    PT_List, 30,     -1, 1e6, "Maximum number of iterations for refinement" ),
     fallback  ( "fallback",   0,    PT_List, 'y',  "ny",      "If refinement fails, fallback to a robust solver" ),
+    tile_prec ( "tile-prec",  9,    PT_List, TilePrecision::Working, TilePrecision_help ),
     depth     ( "depth",      5,    PT_List,  2,      0, 1e3, "Number of butterflies to apply" ),
+    oversample( "oversample", 5,    PT_List, 10,      0, 1e6, "Number of extra columns in randomized sketch" ),
+    power_iters( "power-iters",
+                              5,    PT_List,  2,      0, 1e3, "Number of power iterations in randomized sketch" ),
+    normest_cols( "normest-cols",
+                              5,    PT_List,  1,      1, 1e3, "Number of columns t in block 1-norm estimator" ),
 
     //----- output parameters
     // min, max are ignored
@@ -308,7 +308,11 @@ public:
     testsweeper::ParamString  deflate;
     testsweeper::ParamInt     itermax;
     testsweeper::ParamChar    fallback;
+    testsweeper::ParamEnum< slate::TilePrecision > tile_prec;
     testsweeper::ParamInt     depth;
+    testsweeper::ParamInt     oversample;
+    testsweeper::ParamInt     power_iters;
+    testsweeper::ParamInt     normest_cols;
 
     //----- output parameters
     testsweeper::ParamScientific value;
@@ -425,12 +429,18 @@ void test_hb2st       (Params& params, bool run);
 void test_unmtr_he2hb (Params& params, bool run);
 void test_unmtr_hb2st (Params& params, bool run);
 
+void test_polar       (Params& params, bool run);
+
 // generalized symmetric/Hermitian eigenvalues
 void test_hegv   (Params& params, bool run);
 void test_hegst  (Params& params, bool run);
 
+// non-symmetric eigenvalues
+void test_ge2hb  (Params& params, bool run);
+
 // SVD
 void test_svd    (Params& params, bool run);
+void test_rsvd   (Params& params, bool run);
 void test_ge2tb  (Params& params, bool run);
 void test_tb2bd  (Params& params, bool run);
 void test_bdsqr  (Params& params, bool run);
@@ -0,0 +1,178 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+#include "print_matrix.hh"
+#include "matrix_utils.hh"
+#include "test_utils.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+
+//------------------------------------------------------------------------------
+// Copies the band Hessenberg matrix H, with nb subdiagonals, out of A as
+// returned by ge2hb, dropping the Householder vectors below the band.
+// Tiles must be nb-by-nb, so the band is tiles A(i, j) with i <= j + 1,
+// where tiles A(j+1, j) are upper triangular.
+template <typename scalar_t>
+void copy_ge2hb_band(
+    slate::Matrix<scalar_t>& A,
+    slate::Matrix<scalar_t>& H )
+{
+    const scalar_t zero = 0;
+
+    slate::set( zero, zero, H );
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        for (int64_t i = 0; i <= std::min( j+1, A.mt()-1 ); ++i) {
+            if (A.tileIsLocal( i, j )) {
+                A.tileGetForReading( i, j, slate::LayoutConvert::ColMajor );
+                H.tileGetForWriting( i, j, slate::LayoutConvert::ColMajor );
+                auto Hij = H( i, j );
+                slate::tile::gecopy( A( i, j ), Hij );
+                if (i == j+1) {
+                    for (int64_t jj = 0; jj < Hij.nb(); ++jj)
+                        for (int64_t ii = jj+1; ii < Hij.mb(); ++ii)
+                            Hij.at( ii, jj ) = zero;
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void test_ge2hb_work( Params& params, bool run )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const scalar_t one = 1;
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t p = params.grid.m();
+    int64_t q = params.grid.n();
+    int64_t ib = params.ib();
+    int64_t panel_threads = params.panel_threads();
+    int64_t lookahead = params.lookahead();
+    bool check = params.check() == 'y';
+    bool trace = params.trace() == 'y';
+    slate::Target target = params.target();
+    params.matrix.mark();
+
+    mark_params_for_test_Matrix( params );
+
+    // mark non-standard output values
+    params.time();
+
+    if (! run)
+        return;
+
+    // Check for common invalid combinations
+    if (is_invalid_parameters( params )) {
+        return;
+    }
+
+    if (p != q) {
+        params.msg() = "skipping: requires square process grid (p == q).";
+        return;
+    }
+
+    slate::Options const opts =  {
+        {slate::Option::Lookahead, lookahead},
+        {slate::Option::Target, target},
+        {slate::Option::MaxPanelThreads, panel_threads},
+        {slate::Option::InnerBlocking, ib},
+    };
+
+    auto A_alloc = allocate_test_Matrix<scalar_t>( check, true, n, n, params );
+    auto& A    = A_alloc.A;
+    auto& Aref = A_alloc.Aref;
+
+    slate::generate_matrix( params.matrix, A );
+    if (check)
+        slate::copy( A, Aref );
+    print_matrix( "A", A, params );
+
+    slate::TriangularFactors<scalar_t> T;
+
+    if (trace) slate::trace::Trace::on();
+    else slate::trace::Trace::off();
+
+    double time = barrier_get_wtime( MPI_COMM_WORLD );
+
+    //==================================================
+    // Run SLATE test.
+    //==================================================
+    slate::ge2hb( A, T, opts );
+
+    time = barrier_get_wtime( MPI_COMM_WORLD ) - time;
+
+    if (trace) slate::trace::Trace::finish();
+
+    // compute and save timing/performance
+    params.time() = time;
+
+    print_matrix( "A_factored", A, params );
+
+    if (check) {
+        //==================================================
+        // Test results by checking backwards error
+        //
+        //      || Q H Q^H - A ||_1
+        //     --------------------- < tol * epsilon
+        //       || A ||_1 * n
+        //
+        //==================================================
+        real_t A_norm = slate::norm( slate::Norm::One, Aref );
+
+        auto H = Aref.emptyLike();
+        H.insertLocalTiles();
+        copy_ge2hb_band( A, H );
+        print_matrix( "H", H, params );
+
+        slate::unmhr_ge2hb( slate::Side::Left, slate::Op::NoTrans,
+                            A, T, H, opts );
+        slate::unmhr_ge2hb( slate::Side::Right, slate::Op::ConjTrans,
+                            A, T, H, opts );
+        print_matrix( "Q H Q^H", H, params );
+
+        slate::add( -one, Aref, one, H, opts );
+        print_matrix( "Q H Q^H - A", H, params );
+
+        params.error() = slate::norm( slate::Norm::One, H ) / (n * A_norm);
+        real_t tol = params.tol() * std::numeric_limits<real_t>::epsilon()/2;
+        params.okay() = (params.error() <= tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_ge2hb( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_ge2hb_work<float>( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_ge2hb_work<double>( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_ge2hb_work<std::complex<float>>( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_ge2hb_work<std::complex<double>>( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -52,6 +52,8 @@ void test_geqrf_work(Params& params, bool run)
     params.gflops();
     params.ref_time();
     params.ref_gflops();
+    if (params.routine == "cholqr")
+        params.ortho();
 
     if (! run)
         return;
@@ -214,6 +216,29 @@ void test_geqrf_work(Params& params, bool run)
         params.error() = residual;
         real_t tol = params.tol() * 0.5 * std::numeric_limits<real_t>::epsilon();
         params.okay() = (params.error() <= tol);
+
+        if (params.routine == "cholqr") {
+            //==================================================
+            // Test orthogonality of Q, which is in A
+            //
+            //      || I - Q^H Q ||_1
+            //     ------------------- < tol * epsilon
+            //             n
+            //
+            //==================================================
+            slate::Matrix<scalar_t> Iden( n, n, nb, p, q, MPI_COMM_WORLD );
+            Iden.insertLocalTiles();
+            slate::set( zero, one, Iden );
+            auto QH = conj_transpose( A );
+            slate::gemm( -one, QH, A, one, Iden );
+            params.ortho() = slate::norm( slate::Norm::One, Iden ) / n;
+            // A single pass loses orthogonality as kappa(A)^2,
+            // so only the multi-pass methods are held to tol.
+            if (method_cholqr == slate::MethodCholQR::CholQR2
+                || method_cholqr == slate::MethodCholQR::ShiftCholQR3) {
+                params.okay() = params.okay() && (params.ortho() <= tol);
+            }
+        }
     }
 
     if (ref) {
@@ -143,6 +143,11 @@ void test_gesv_work(Params& params, bool run)
         itermax = params.itermax();
     }
 
+    slate::TilePrecision tile_prec = slate::TilePrecision::Working;
+    if (params.routine == "gesv_mixed_gmres") {
+        tile_prec = params.tile_prec();
+    }
+
     int64_t depth = 0;
     if (params.routine == "gesv_rbt") {
         depth = params.depth();
@@ -174,6 +179,7 @@ void test_gesv_work(Params& params, bool run)
         {slate::Option::Depth, depth},
         {slate::Option::MaxIterations, itermax},
         {slate::Option::UseFallbackSolver, fallback},
+        {slate::Option::TilePrecision, tile_prec},
     };
 
     int64_t info = 0;
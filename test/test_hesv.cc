@@ -69,20 +69,23 @@ void test_hesv_work(Params& params, bool run)
         params.msg() = "skipping: currently target=devices is not supported";
         return;
     }
-    if (n % nb != 0) {
+    if (n % nb != 0 && params.routine != "hesv_rbt") {
         params.msg() = "skipping: currently only (n %% nb == 0) is supported";
         return;
     }
-    if (uplo != slate::Uplo::Lower) {
+    if (uplo != slate::Uplo::Lower && params.routine != "hesv_rbt") {
         params.msg() = "skipping: currently only uplo=lower is supported";
         return;
     }
 
-    slate::Options const opts =  {
+    slate::Options opts =  {
         {slate::Option::Lookahead, lookahead},
         {slate::Option::Target, target},
         {slate::Option::MaxPanelThreads, panel_threads}
     };
+    if (params.routine == "hesv_rbt") {
+        opts[ slate::Option::MethodHesv ] = slate::MethodHesv::RBT;
+    }
 
     // MPI variables
     int mpi_rank, myrow, mycol;
@@ -267,14 +270,14 @@ void test_hesv_work(Params& params, bool run)
             std::vector<real_t> work( blas::max( mlocA, nlocA, mlocB, nlocB ) );
 
             // Norm of the orig matrix: || A ||
-            A_norm = scalapack::lange(
-                Norm::One, n, n, &Aref_data[0], 1, 1, Aref_desc, &work[0] );
+            // Only the uplo triangle of Aref is set, so use SLATE's norm.
+            A_norm = slate::norm( Norm::One, Aref );
             // norm of updated rhs matrix: || X ||
             X_norm = scalapack::lange(
                 Norm::One, n, nrhs, &B_data[0], 1, 1, B_desc, &work[0] );
 
             // Bref_data -= Aref*B_data
-            scalapack::hemm( Side::Left, Uplo::Lower, n, nrhs,
+            scalapack::hemm( Side::Left, uplo, n, nrhs,
                              -one, &Aref_data[0], 1, 1, Aref_desc,
                                    &B_data[0],    1, 1, B_desc,
                              one,  &Bref_data[0], 1, 1, Bref_desc );
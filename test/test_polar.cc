@@ -0,0 +1,165 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+#include "print_matrix.hh"
+#include "matrix_utils.hh"
+#include "test_utils.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void test_polar_work( Params& params, bool run )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t ib = params.ib();
+    int64_t panel_threads = params.panel_threads();
+    int64_t lookahead = params.lookahead();
+    int64_t itermax = params.itermax();
+    bool check = params.check() == 'y';
+    bool trace = params.trace() == 'y';
+    slate::Target target = params.target();
+    params.matrix.mark();
+
+    mark_params_for_test_Matrix( params );
+
+    // mark non-standard output values
+    params.time();
+    params.iters();
+    params.ortho();
+
+    if (! run)
+        return;
+
+    if (m < n) {
+        params.msg() = "skipping: polar requires m >= n";
+        return;
+    }
+
+    if (params.nonuniform_nb() == 'y') {
+        params.msg() = "skipping: polar requires square tiles";
+        return;
+    }
+
+    // Check for common invalid combinations
+    if (is_invalid_parameters( params )) {
+        return;
+    }
+
+    slate::Options const opts =  {
+        {slate::Option::Lookahead, lookahead},
+        {slate::Option::Target, target},
+        {slate::Option::MaxPanelThreads, panel_threads},
+        {slate::Option::InnerBlocking, ib},
+        {slate::Option::MaxIterations, itermax},
+    };
+
+    auto A_alloc = allocate_test_Matrix<scalar_t>( false, true, m, n, params );
+    auto& A = A_alloc.A;
+    auto U = A.emptyLike();
+    U.insertLocalTiles();
+    auto H_alloc = allocate_test_Matrix<scalar_t>( false, true, n, n, params );
+    auto& H = H_alloc.A;
+
+    slate::generate_matrix( params.matrix, A );
+    print_matrix( "A", A, params );
+
+    if (trace) slate::trace::Trace::on();
+    else slate::trace::Trace::off();
+
+    double time = barrier_get_wtime( MPI_COMM_WORLD );
+
+    //==================================================
+    // Run SLATE test.
+    //==================================================
+    params.iters() = slate::polar( A, U, H, opts );
+
+    time = barrier_get_wtime( MPI_COMM_WORLD ) - time;
+
+    if (trace) slate::trace::Trace::finish();
+
+    // compute and save timing/performance
+    params.time() = time;
+
+    print_matrix( "U", U, params );
+    print_matrix( "H", H, params );
+
+    if (check) {
+        //==================================================
+        // Test results by checking backwards error
+        //
+        //      || A - U H ||_1
+        //     ----------------- < tol * epsilon
+        //       || A ||_1 * n
+        //
+        //==================================================
+        real_t A_norm = slate::norm( slate::Norm::One, A );
+
+        auto R = A.emptyLike();
+        R.insertLocalTiles();
+        slate::copy( A, R );
+        slate::gemm( -one, U, H, one, R, opts );
+        print_matrix( "A - U H", R, params );
+
+        params.error() = slate::norm( slate::Norm::One, R ) / (n * A_norm);
+        real_t tol = params.tol() * std::numeric_limits<real_t>::epsilon()/2;
+        params.okay() = (params.error() <= tol);
+
+        //==================================================
+        // Test orthogonality of U
+        //
+        //      || I - U^H U ||_1
+        //     ------------------- < tol * epsilon
+        //             n
+        //
+        //==================================================
+        auto Iden = H.emptyLike();
+        Iden.insertLocalTiles();
+        slate::set( zero, one, Iden );
+        auto UH = conj_transpose( U );
+        slate::gemm( -one, UH, U, one, Iden, opts );
+        params.ortho() = slate::norm( slate::Norm::One, Iden ) / n;
+        params.okay() = params.okay() && (params.ortho() <= tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_polar( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_polar_work<float>( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_polar_work<double>( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_polar_work<std::complex<float>>( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_polar_work<std::complex<double>>( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
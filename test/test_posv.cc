@@ -120,6 +120,11 @@ void test_posv_work(Params& params, bool run)
         itermax = params.itermax();
     }
 
+    slate::TilePrecision tile_prec = slate::TilePrecision::Working;
+    if (params.routine == "posv_mixed_gmres") {
+        tile_prec = params.tile_prec();
+    }
+
     if (! run) {
         params.matrix.kind.set_default( "rand_dominant" );
         return;
@@ -138,6 +143,7 @@ void test_posv_work(Params& params, bool run)
         {slate::Option::MethodHemm, method_hemm},
         {slate::Option::MaxIterations, itermax},
         {slate::Option::UseFallbackSolver, fallback},
+        {slate::Option::TilePrecision, tile_prec},
     };
 
     if ((params.routine == "posv_mixed" || params.routine == "posv_mixed_gmres")
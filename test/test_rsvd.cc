@@ -0,0 +1,235 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "test.hh"
+#include "blas/flops.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "matrix_utils.hh"
+#include "test_utils.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <utility>
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void test_rsvd_work( Params& params, bool run )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Constants
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t k = params.dim.k();
+    int64_t oversample = params.oversample();
+    int64_t power_iters = params.power_iters();
+    int64_t panel_threads = params.panel_threads();
+    int64_t lookahead = params.lookahead();
+    bool check = params.check() == 'y';
+    bool trace = params.trace() == 'y';
+    int verbose = params.verbose();
+    int timer_level = params.timer_level();
+    slate::Target target = params.target();
+    params.matrix.mark();
+
+    mark_params_for_test_Matrix( params );
+
+    params.time();
+    params.gflops();
+    params.ortho_U();
+    params.ortho_V();
+    params.error.name( "S - Sref" );
+
+    if (timer_level >= 2) {
+        params.time2();
+        params.time3();
+        params.time4();
+        params.time5();
+        params.time6();
+        params.time2.name( "sketch (s)" );
+        params.time3.name( "power (s)" );
+        params.time4.name( "project (s)" );
+        params.time5.name( "svd (s)" );
+        params.time6.name( "vectors (s)" );
+    }
+
+    if (! run)
+        return;
+
+    // Check for common invalid combinations
+    if (is_invalid_parameters( params )) {
+        return;
+    }
+
+    int64_t min_mn = std::min( m, n );
+    k = std::min( k, min_mn );
+    int64_t l = std::min( k + oversample, min_mn );
+
+    // MPI variables
+    int mpi_rank;
+    MPI_Comm_rank( MPI_COMM_WORLD, &mpi_rank );
+
+    slate::Options const opts =  {
+        {slate::Option::Lookahead, lookahead},
+        {slate::Option::Target, target},
+        {slate::Option::MaxPanelThreads, panel_threads}
+    };
+
+    std::vector<real_t> Sigma;
+
+    auto A_alloc = allocate_test_Matrix<scalar_t>( false, true, m, n, params );
+    auto U_alloc = allocate_test_Matrix<scalar_t>( false, true, m, k, params );
+    auto VT_alloc = allocate_test_Matrix<scalar_t>( false, true, k, n, params );
+
+    auto& A  = A_alloc.A;
+    auto& U  = U_alloc.A;
+    auto& VT = VT_alloc.A;
+
+    if (verbose >= 1) {
+        printf( "%% A   %6lld-by-%6lld\n", llong(   A.m() ), llong(   A.n() ) );
+        printf( "%% U   %6lld-by-%6lld\n", llong(   U.m() ), llong(   U.n() ) );
+        printf( "%% VT  %6lld-by-%6lld\n", llong(  VT.m() ), llong(  VT.n() ) );
+    }
+
+    // Generate A, keeping its singular values when the matrix kind has them.
+    std::vector<real_t> Sigma_ref( min_mn );
+    slate::MatgenParams mg_params;
+    mg_params.kind         = params.matrix.kind();
+    mg_params.cond_request = params.matrix.cond_request();
+    mg_params.condD        = params.matrix.condD();
+    mg_params.seed         = params.matrix.seed();
+    slate::generate_matrix( mg_params, A, Sigma_ref );
+    params.matrix.cond_actual() = mg_params.cond_actual;
+    if (params.matrix.marked())
+        params.matrix.generate_label();
+    print_matrix( "A",  A, params );
+
+    if (check) {
+        if (min_mn > 0 && std::isnan( Sigma_ref[ 0 ] )) {
+            // Singular values of this kind are unknown; compute them.
+            auto Acpy = A.emptyLike();
+            Acpy.insertLocalTiles();
+            slate::copy( A, Acpy );
+            slate::svd_vals( Acpy, Sigma_ref, opts );
+        }
+        for (auto& s : Sigma_ref)
+            s = std::abs( s );
+        std::sort( Sigma_ref.begin(), Sigma_ref.end(), std::greater<real_t>() );
+    }
+
+    if (trace) slate::trace::Trace::on();
+    else slate::trace::Trace::off();
+
+    double time = barrier_get_wtime( MPI_COMM_WORLD );
+
+    //==================================================
+    // Run SLATE test.
+    //==================================================
+    slate::rsvd( A, k, oversample, power_iters, Sigma, U, VT, opts );
+
+    time = barrier_get_wtime( MPI_COMM_WORLD ) - time;
+
+    if (trace) slate::trace::Trace::finish();
+
+    // compute and save timing/performance
+    // Products with A dominate: 2 q + 2 gemms of m-by-n by n-by-l.
+    double gflop = (2*power_iters + 2) * blas::Gflop<scalar_t>::gemm( m, l, n );
+    params.time() = time;
+    params.gflops() = gflop / time;
+    if (timer_level >= 2) {
+        params.time2() = slate::timers[ "rsvd::sketch" ];
+        params.time3() = slate::timers[ "rsvd::power" ];
+        params.time4() = slate::timers[ "rsvd::project" ];
+        params.time5() = slate::timers[ "rsvd::svd" ];
+        params.time6() = slate::timers[ "rsvd::vectors" ];
+    }
+
+    if (mpi_rank == 0) {
+        print_vector( "Sigma", Sigma, params );
+    }
+    print_matrix( "U",  U, params );
+    print_matrix( "VT", VT, params );
+
+    if (check) {
+        real_t tol = params.tol() * 0.5 * std::numeric_limits<real_t>::epsilon();
+        params.okay() = true;
+
+        auto R_alloc = allocate_test_Matrix<scalar_t>( false, true, k, k, params );
+        auto& R = R_alloc.A;
+
+        //==================================================
+        // Test results by checking orthogonality of U and V
+        //
+        //      || I - U^H U ||_1
+        //     ------------------- < tol * epsilon
+        //              N
+        //==================================================
+        slate::set( zero, one, R ); // identity
+        auto UH = conj_transpose( U );
+        slate::gemm( -one, UH, U, one, R );
+        params.ortho_U() = slate::norm( slate::Norm::One, R ) / n;
+        params.okay() = params.okay() && (params.ortho_U() <= tol);
+
+        slate::set( zero, one, R ); // identity
+        auto V = conj_transpose( VT );
+        slate::gemm( -one, VT, V, one, R );
+        params.ortho_V() = slate::norm( slate::Norm::One, R ) / n;
+        params.okay() = params.okay() && (params.ortho_V() <= tol);
+
+        //==================================================
+        // Test singular values. Since Sigma are the singular values of a
+        // projection of A, each is accurate to within the largest
+        // singular value not captured, Sigma_ref[ k ].
+        //
+        //      max_i | Sigma_i - Sigma_ref_i |
+        //     --------------------------------- < Sigma_ref_k / Sigma_ref_0
+        //               Sigma_ref_0                 + tol * epsilon
+        //==================================================
+        real_t error = 0;
+        for (int64_t i = 0; i < k; ++i) {
+            error = std::max( error, std::abs( Sigma[ i ] - Sigma_ref[ i ] ) );
+        }
+        real_t Sigma_ref_0 = (k > 0 ? Sigma_ref[ 0 ] : 1);
+        real_t Sigma_ref_k = (k < min_mn ? Sigma_ref[ k ] : 0);
+        params.error() = error / Sigma_ref_0;
+        params.okay() = params.okay()
+                        && (params.error() <= Sigma_ref_k / Sigma_ref_0 + tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_rsvd( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_rsvd_work<float>( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_rsvd_work<double>( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_rsvd_work<std::complex<float>>( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_rsvd_work<std::complex<double>>( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
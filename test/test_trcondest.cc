@@ -42,6 +42,7 @@ void test_trcondest_work(Params& params, bool run)
     int64_t ib = params.ib();
     int64_t lookahead = params.lookahead();
     int64_t panel_threads = params.panel_threads();
+    int64_t normest_cols = params.normest_cols();
     bool ref_only = params.ref() == 'o';
     bool ref = params.ref() == 'y' || ref_only;
     bool check = params.check() == 'y' && ! ref_only;
@@ -89,6 +90,7 @@ void test_trcondest_work(Params& params, bool run)
         {slate::Option::Target, target},
         {slate::Option::MaxPanelThreads, panel_threads},
         {slate::Option::InnerBlocking, ib},
+        {slate::Option::NormEstColumns, normest_cols},
     };
 
     // Matrix A: figure out local size.
@@ -62,9 +62,13 @@ opts = parser.parse_args()
 # ------------------------------------------------------------------------------
 cmds = [
     'test_BandMatrix',
+    'test_CompactBandMatrix',
     'test_HermitianMatrix',
     'test_LockGuard',
     'test_OmpSetMaxActiveLevels',
+    'test_MpiProgress',
+    'test_PanelTeam',
+    'test_Perf',
     'test_Matrix',
     'test_Memory',
     'test_SymmetricMatrix',
@@ -85,6 +89,10 @@ cmds = [
     'test_util',
 ]
 
+# ScaLAPACK API tests are compiled only if ScaLAPACK was found.
+if (os.path.exists( 'test_scalapack_api' )):
+    cmds.append( 'test_scalapack_api' )
+
 # ------------------------------------------------------------------------------
 # when output is redirected to file instead of TTY console,
 # print extra messages to stderr on TTY console.
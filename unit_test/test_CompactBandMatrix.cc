@@ -0,0 +1,272 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+
+#include "unit_test.hh"
+
+#include <cmath>
+#include <limits>
+
+namespace test {
+
+//------------------------------------------------------------------------------
+// global variables
+int mpi_rank;
+int mpi_size;
+
+//------------------------------------------------------------------------------
+/// Deterministic entries in [-0.5, 0.5), the same on all ranks.
+template <typename scalar_t>
+scalar_t entry(int64_t i, int64_t j)
+{
+    using real_t = blas::real_type<scalar_t>;
+    real_t re = ((i*37 + j*101) % 97) / real_t( 97 ) - real_t( 0.5 );
+    real_t im = ((i*13 + j*61)  % 89) / real_t( 89 ) - real_t( 0.5 );
+    return blas::make_scalar<scalar_t>( re, im );
+}
+
+//------------------------------------------------------------------------------
+/// Returns all of B on every rank, as an n-by-nrhs column-major array.
+/// Assumes B has one block column, i.e., nrhs <= nb.
+template <typename scalar_t>
+std::vector<scalar_t> gather_rhs(slate::Matrix<scalar_t>& B)
+{
+    int64_t n = B.m();
+    int64_t nrhs = B.n();
+    int64_t nb = B.tileMb( 0 );
+    std::vector<scalar_t> X( n*nrhs ), local( nb*nrhs );
+    int64_t i = mpi_rank;
+    if (i < B.mt()) {
+        auto Bi = B( i, 0 );
+        for (int64_t k = 0; k < nrhs; ++k)
+            for (int64_t ii = 0; ii < Bi.mb(); ++ii)
+                local[ ii + k*nb ] = Bi( ii, k );
+    }
+    std::vector<scalar_t> all( nb*nrhs*mpi_size );
+    MPI_Allgather( local.data(), nb*nrhs, slate::mpi_type<scalar_t>::value,
+                   all.data(), nb*nrhs, slate::mpi_type<scalar_t>::value,
+                   MPI_COMM_WORLD );
+    for (int64_t k = 0; k < nrhs; ++k)
+        for (int64_t r = 0; r < n; ++r)
+            X[ r + k*n ] = all[ (r / nb)*nb*nrhs + (r % nb) + k*nb ];
+    return X;
+}
+
+//------------------------------------------------------------------------------
+/// Sets B( i, k ) = entry( i, n + k ) for the local block row.
+template <typename scalar_t>
+void fill_rhs(slate::Matrix<scalar_t>& B)
+{
+    B.insertLocalTiles();
+    for (int64_t i = 0; i < B.mt(); ++i) {
+        for (int64_t j = 0; j < B.nt(); ++j) {
+            if (B.tileIsLocal( i, j )) {
+                auto Bij = B( i, j );
+                for (int64_t jj = 0; jj < Bij.nb(); ++jj)
+                    for (int64_t ii = 0; ii < Bij.mb(); ++ii)
+                        Bij.at( ii, jj ) = entry<scalar_t>(
+                            i*B.tileMb( 0 ) + ii, B.m() + j*B.tileNb( 0 ) + jj );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Tests the distribution and indexing of compact band matrices.
+void test_layout()
+{
+    int64_t kl = 2, ku = 3, nb = 10;
+    int64_t n = nb*mpi_size - 4;
+    slate::CompactBandMatrix<double> A( n, kl, ku, nb, MPI_COMM_WORLD );
+
+    test_assert( A.stride() == 2*kl + ku + 1 );
+    test_assert( A.numRanks() == mpi_size );
+    test_assert( A.colBegin() == mpi_rank*nb );
+    test_assert( A.colEnd() == std::min( (mpi_rank + 1)*nb, n ) );
+    test_assert( A.haloEnd() == std::min( A.colEnd() + kl + ku, n ) );
+    test_assert( A.colRank( n - 1 ) == mpi_size - 1 );
+
+    int64_t j = A.colBegin();
+    A.at( j, j ) = 1.0;
+    A.at( j + kl, j ) = 2.0;
+    test_assert( A.data()[ kl + ku ] == 1.0 );
+    test_assert( A.data()[ 2*kl + ku ] == 2.0 );
+
+    slate::CompactHermitianBandMatrix<double> H( n, kl, nb, MPI_COMM_WORLD );
+    test_assert( H.stride() == kl + 1 );
+    test_assert( H.haloEnd() == std::min( H.colEnd() + kl, n ) );
+    H.at( j + 1, j ) = 3.0;
+    test_assert( H.data()[ 1 ] == 3.0 );
+
+    auto B = A.emptyRHS( 3 );
+    test_assert( B.m() == n );
+    test_assert( B.mt() == mpi_size );
+    for (int64_t i = 0; i < B.mt(); ++i)
+        test_assert( B.tileRank( i, 0 ) == i );
+}
+
+//------------------------------------------------------------------------------
+/// Tests gbsv or gbsv_spike in compact band storage against the residual
+/// || A X - B ||, for diagonally dominant A.
+template <typename scalar_t>
+void test_gbsv_work(bool spike)
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    int64_t kl = 3, ku = 2, nb = 12, nrhs = 2;
+    int64_t n = nb*mpi_size - 5;
+    auto a = [kl, ku](int64_t i, int64_t j) {
+        return entry<scalar_t>( i, j ) + scalar_t( i == j ? kl + ku + 1 : 0 );
+    };
+
+    slate::CompactBandMatrix<scalar_t> A( n, kl, ku, nb, MPI_COMM_WORLD );
+    for (int64_t j = A.colBegin(); j < A.colEnd(); ++j) {
+        for (int64_t i = std::max( j - ku, int64_t( 0 ) );
+             i <= std::min( j + kl, n - 1 ); ++i)
+            A.at( i, j ) = a( i, j );
+    }
+
+    auto B = A.emptyRHS( nrhs );
+    fill_rhs( B );
+
+    int64_t info;
+    if (spike) {
+        info = slate::gbsv_spike( A, B );
+    }
+    else {
+        std::vector<int64_t> pivots;
+        info = slate::gbsv( A, pivots, B );
+    }
+    test_assert( info == 0 );
+
+    // All ranks check the whole residual.
+    std::vector<scalar_t> X = gather_rhs( B );
+    real_t err = 0;
+    for (int64_t k = 0; k < nrhs; ++k) {
+        for (int64_t i = 0; i < n; ++i) {
+            scalar_t r = -entry<scalar_t>( i, n + k );
+            for (int64_t j = std::max( i - kl, int64_t( 0 ) );
+                 j <= std::min( i + ku, n - 1 ); ++j)
+                r += a( i, j ) * X[ j + k*n ];
+            err = std::max( err, std::abs( r ) );
+        }
+    }
+    test_assert( err < 1e3 * std::numeric_limits<real_t>::epsilon() );
+}
+
+void test_gbsv()
+{
+    test_gbsv_work<double>( false );
+    test_gbsv_work< std::complex<double> >( false );
+}
+
+void test_gbsv_spike()
+{
+    test_gbsv_work<double>( true );
+    test_gbsv_work< std::complex<double> >( true );
+}
+
+//------------------------------------------------------------------------------
+/// Tests pbsv or pbsv_spike in compact band storage against the residual
+/// || A X - B ||, for diagonally dominant A.
+template <typename scalar_t>
+void test_pbsv_work(bool spike)
+{
+    using real_t = blas::real_type<scalar_t>;
+    using blas::conj;
+
+    int64_t kd = 3, nb = 12, nrhs = 2;
+    int64_t n = nb*mpi_size - 5;
+    auto a = [kd](int64_t i, int64_t j) {
+        if (i == j)
+            return scalar_t( 2*kd + 1 );
+        else if (i > j)
+            return entry<scalar_t>( i, j );
+        else
+            return conj( entry<scalar_t>( j, i ) );
+    };
+
+    slate::CompactHermitianBandMatrix<scalar_t> A( n, kd, nb, MPI_COMM_WORLD );
+    for (int64_t j = A.colBegin(); j < A.colEnd(); ++j) {
+        for (int64_t i = j; i <= std::min( j + kd, n - 1 ); ++i)
+            A.at( i, j ) = a( i, j );
+    }
+
+    auto B = A.emptyRHS( nrhs );
+    fill_rhs( B );
+
+    int64_t info = spike ? slate::pbsv_spike( A, B ) : slate::pbsv( A, B );
+    test_assert( info == 0 );
+
+    std::vector<scalar_t> X = gather_rhs( B );
+    real_t err = 0;
+    for (int64_t k = 0; k < nrhs; ++k) {
+        for (int64_t i = 0; i < n; ++i) {
+            scalar_t r = -entry<scalar_t>( i, n + k );
+            for (int64_t j = std::max( i - kd, int64_t( 0 ) );
+                 j <= std::min( i + kd, n - 1 ); ++j)
+                r += a( i, j ) * X[ j + k*n ];
+            err = std::max( err, std::abs( r ) );
+        }
+    }
+    test_assert( err < 1e3 * std::numeric_limits<real_t>::epsilon() );
+}
+
+void test_pbsv()
+{
+    test_pbsv_work<double>( false );
+    test_pbsv_work< std::complex<double> >( false );
+}
+
+void test_pbsv_spike()
+{
+    test_pbsv_work<double>( true );
+    test_pbsv_work< std::complex<double> >( true );
+}
+
+//------------------------------------------------------------------------------
+/// Tests that pbtrf reports a matrix that is not positive definite,
+/// with the same info on all ranks.
+void test_pbtrf_indefinite()
+{
+    int64_t kd = 2, nb = 8;
+    int64_t n = nb*mpi_size;
+    slate::CompactHermitianBandMatrix<double> A( n, kd, nb, MPI_COMM_WORLD );
+    for (int64_t j = A.colBegin(); j < A.colEnd(); ++j)
+        A.at( j, j ) = (j == n - 2 ? -1.0 : 1.0);
+
+    int64_t info = slate::pbtrf( A );
+    test_assert( info == n - 1 );
+}
+
+//------------------------------------------------------------------------------
+/// Runs all tests. Called by unit test main().
+void run_tests()
+{
+    run_test(test_layout,           "CompactBandMatrix layout", MPI_COMM_WORLD);
+    run_test(test_gbsv,             "gbsv compact",             MPI_COMM_WORLD);
+    run_test(test_gbsv_spike,       "gbsv_spike",               MPI_COMM_WORLD);
+    run_test(test_pbsv,             "pbsv compact",             MPI_COMM_WORLD);
+    run_test(test_pbsv_spike,       "pbsv_spike",               MPI_COMM_WORLD);
+    run_test(test_pbtrf_indefinite, "pbtrf compact indefinite", MPI_COMM_WORLD);
+}
+
+}  // namespace test
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    using namespace test;  // for globals mpi_rank, etc.
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+
+    int err = unit_test_main(MPI_COMM_WORLD);  // which calls run_tests()
+
+    MPI_Finalize();
+    return err;
+}
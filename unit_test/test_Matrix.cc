@@ -1066,6 +1066,111 @@ void test_Matrix_insertLocalTiles_dev()
     }
 }
 
+//------------------------------------------------------------------------------
+/// Tests insertLocalTiles( TileAlloc::Slab ) and
+/// insertLocalTiles( TileAlloc::ScaLAPACK ) on host.
+void test_Matrix_insertLocalTiles_slab()
+{
+    // Slab: tiles contiguous, in column-major tile order.
+    slate::Matrix<double> A(m, n, mb, nb, p, q, mpi_comm);
+    A.insertLocalTiles( slate::TileAlloc::Slab );
+    test_assert(A.hostSlab() != nullptr);
+    test_assert(A.hostSlabStride() == 0);
+
+    double* prev_end = A.hostSlab();
+    for (int j = 0; j < A.nt(); ++j) {
+        for (int i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal(i, j)) {
+                auto T = A(i, j);
+                test_assert(T.mb() == A.tileMb(i));
+                test_assert(T.nb() == A.tileNb(j));
+                test_assert(T.stride() == A.tileMb(i));
+                test_assert(T.data() >= prev_end);
+                test_assert(T.kind() == slate::TileKind::UserOwned);
+                prev_end = T.data() + T.mb()*T.nb();
+                T.at(T.mb()-1, T.nb()-1) = i + j*1000;
+            }
+        }
+    }
+
+    // ScaLAPACK: the slab is the local array, as for fromScaLAPACK.
+    slate::Matrix<double> B(m, n, mb, nb, p, q, mpi_comm);
+    B.insertLocalTiles( slate::TileAlloc::ScaLAPACK );
+    double* slab = B.hostSlab();
+    int64_t lld = B.hostSlabStride();
+    test_assert(slab != nullptr);
+
+    // GridOrder::Col: rank = myrow + mycol*p.
+    int myrow = mpi_rank % p;
+    int mycol = mpi_rank / p;
+    int64_t mlocal = 0;
+    for (int i = myrow; i < B.mt(); i += p)
+        mlocal += B.tileMb(i);
+    test_assert(lld == std::max(mlocal, int64_t(1)));
+
+    for (int j = 0; j < B.nt(); ++j) {
+        for (int i = 0; i < B.mt(); ++i) {
+            if (B.tileIsLocal(i, j)) {
+                auto T = B(i, j);
+                test_assert(T.mb() == B.tileMb(i));
+                test_assert(T.nb() == B.tileNb(j));
+                test_assert(T.stride() == lld);
+                test_assert(i % p == myrow);
+                test_assert(j % q == mycol);
+                test_assert(T.data() == &slab[ (i/p)*mb + (j/q)*nb*lld ]);
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Test tileNumaDomain, setTileNumaDomain, and NUMA first touch in
+/// insertLocalTiles.
+///
+void test_Matrix_insertLocalTiles_numa()
+{
+    // Default: one domain.
+    slate::Matrix<double> A(m, n, mb, nb, p, q, mpi_comm);
+    test_assert(A.numNumaDomains() == slate::numa_domains());
+
+    // Two domains, cycling by local block column.
+    int save = slate::numa_domains();
+    slate::numa_domains( 2 );
+    slate::Matrix<double> B(m, n, mb, nb, p, q, mpi_comm);
+    auto C = B.emptyLike();
+    slate::numa_domains( save );
+
+    test_assert(B.numNumaDomains() == 2);
+    test_assert(C.numNumaDomains() == 2);
+    B.insertLocalTiles();
+    C.insertLocalTiles();
+    for (int j = 0; j < B.nt(); ++j) {
+        for (int i = 0; i < B.mt(); ++i) {
+            test_assert(B.tileNumaDomain(i, j) == (j / q) % 2);
+            test_assert(C.tileNumaDomain(i, j) == (j / q) % 2);
+            if (B.tileIsLocal(i, j)) {
+                auto T = B(i, j);
+                for (int jj = 0; jj < T.nb(); ++jj)
+                    for (int ii = 0; ii < T.mb(); ++ii)
+                        test_assert(T(ii, jj) == 0.0);
+            }
+        }
+    }
+
+    // Sub-matrix uses the parent's domains.
+    auto Bsub = B.sub(1, B.mt()-1, 1, B.nt()-1);
+    test_assert(Bsub.tileNumaDomain(0, 0) == B.tileNumaDomain(1, 1));
+
+    // User-defined domains.
+    slate::Matrix<double> D(m, n, mb, nb, p, q, mpi_comm);
+    D.setTileNumaDomain( 3, []( std::tuple<int64_t, int64_t> ij ) {
+        return int( std::get<0>( ij ) % 3 );
+    } );
+    test_assert(D.numNumaDomains() == 3);
+    for (int i = 0; i < D.mt(); ++i)
+        test_assert(D.tileNumaDomain(i, 0) == i % 3);
+}
+
 //------------------------------------------------------------------------------
 /// Test allocateBatchArrays, clearBatchArrays, batchArraySize.
 ///
@@ -1635,6 +1740,51 @@ void test_tileSend_tileRecv()
     }
 }
 
+//------------------------------------------------------------------------------
+void test_tileFetch()
+{
+    int lda = roundup(m, nb);
+    std::vector<double> Ad( lda*n );
+
+    auto A = slate::Matrix<double>::fromLAPACK(
+        m, n, Ad.data(), lda, nb, p, q, mpi_comm );
+
+    for (int j = 0; j < A.nt(); ++j) {
+        for (int i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal(i, j)) {
+                auto T = A(i, j);
+                T.at(0, 0) = i + j/1000. + 1000*mpi_rank;
+                T.at(T.mb()-1, T.nb()-1) = -(i + j/1000.);
+            }
+        }
+    }
+
+    A.tileWindowCreate();
+    test_assert( A.tileWindowIsOpen() );
+
+    // Every rank pulls every remote tile; owners don't participate.
+    for (int j = 0; j < A.nt(); ++j) {
+        for (int i = 0; i < A.mt(); ++i) {
+            A.tileFetch(i, j);
+            auto T = A(i, j);
+            test_assert( T(0, 0) == i + j/1000. + 1000*A.tileRank(i, j) );
+            test_assert( T(T.mb()-1, T.nb()-1) == -(i + j/1000.) );
+        }
+    }
+
+    // Transposed view fetches the same tiles.
+    auto AT = transpose( A );
+    for (int i = 0; i < AT.mt(); ++i) {
+        AT.tileFetch(i, 0);
+        test_assert( AT(i, 0)(0, 0) == i/1000. + 1000*A.tileRank(0, i) );
+    }
+
+    // Owners must not free the window while others are still fetching.
+    MPI_Barrier( mpi_comm );
+    A.tileWindowFree();
+    test_assert( ! A.tileWindowIsOpen() );
+}
+
 //------------------------------------------------------------------------------
 void test_releaseRemoteWorkspace()
 {
@@ -2133,6 +2283,8 @@ void run_tests()
     run_test(test_Matrix_tileReduceFromSet,    "Matrix::tileReduceFromSet(i, j, set,...)", mpi_comm);
     run_test(test_Matrix_insertLocalTiles,     "Matrix::insertLocalTiles()",               mpi_comm);
     run_test(test_Matrix_insertLocalTiles_dev, "Matrix::insertLocalTiles(on_devices)",     mpi_comm);
+    run_test(test_Matrix_insertLocalTiles_slab, "Matrix::insertLocalTiles(TileAlloc)",    mpi_comm);
+    run_test(test_Matrix_insertLocalTiles_numa, "Matrix::tileNumaDomain",                 mpi_comm);
     run_test(test_Matrix_allocateBatchArrays,  "Matrix::allocateBatchArrays",              mpi_comm);
     run_test(test_Matrix_MOSI,                 "Matrix::tileMOSI",                         mpi_comm);
     run_test(test_Matrix_tileLayoutConvert,    "Matrix::tileLayoutConvert",                mpi_comm);
@@ -2147,6 +2299,7 @@ void run_tests()
     if (mpi_rank == 0)
         printf("\nCommunication\n");
     run_test(test_tileSend_tileRecv, "tileSend, tileRecv", mpi_comm);
+    run_test(test_tileFetch, "tileFetch", mpi_comm);
     run_test(test_releaseRemoteWorkspace, "releaseRemoteWorkspace", mpi_comm);
 }
 
@@ -281,6 +281,61 @@ void test_clearDeviceBlocks()
         delete dev_queues[dev];
 }
 
+//------------------------------------------------------------------------------
+/// Tests allocating and freeing host blocks from the out-of-core pool,
+/// and that data survives eviction.
+void test_alloc_host_outOfCore()
+{
+    slate::Memory mem(sizeof(double) * nb * nb);
+    mem.setOutOfCore( "/tmp" );
+    test_assert( mem.outOfCore() );
+
+    const int cnt = 9;
+    mem.addHostBlocks(cnt);
+    test_assert( int( mem.available( HostNum ) ) == cnt );
+    test_assert( int( mem.capacity(  HostNum ) ) == cnt );
+
+    // Allocate 2*cnt blocks.
+    // First cnt blocks come from reserve, next cnt blocks from a new segment.
+    double* hx[ 2*cnt ];
+    for (int i = 0; i < 2*cnt; ++i) {
+        hx[i] = (double*) mem.alloc( HostNum, sizeof(double) * nb * nb, nullptr );
+        test_assert(hx[i] != nullptr);
+        test_assert( int( mem.allocated( HostNum ) ) == i+1 );
+
+        // Touch memory to verify it is valid.
+        for (int j = 0; j < nb*nb; ++j) {
+            hx[i][j] = i*1000000 + j;
+        }
+    }
+
+    // Evict all, then verify data is read back.
+    for (int i = 0; i < 2*cnt; ++i) {
+        mem.evictHost( hx[i], sizeof(double) * nb * nb, true );
+    }
+    for (int i = 0; i < 2*cnt; ++i) {
+        mem.prefetchHost( hx[i], sizeof(double) * nb * nb );
+        for (int j = 0; j < nb*nb; ++j) {
+            test_assert( hx[i][j] == i*1000000 + j );
+        }
+    }
+
+    // Larger than a block is allocated outside the pool.
+    double* big = (double*) mem.alloc( HostNum, 2 * sizeof(double) * nb * nb, nullptr );
+    test_assert( int( mem.allocated( HostNum ) ) == 2*cnt );
+    mem.free( big, HostNum );
+
+    for (int i = 0; i < 2*cnt; ++i) {
+        mem.free( hx[i], HostNum );
+    }
+    test_assert( int( mem.allocated( HostNum ) ) == 0 );
+
+    mem.clearHostBlocks();
+    test_assert( int( mem.available( HostNum ) ) == 0 );
+    test_assert( int( mem.capacity(  HostNum ) ) == 0 );
+    test_assert( mem.outOfCore() );
+}
+
 //------------------------------------------------------------------------------
 /// Runs all tests. Called by unit test main().
 void run_tests()
@@ -290,6 +345,8 @@ void run_tests()
     run_test(test_addDeviceBlocks,   "addDeviceBlocks");
     run_test(test_alloc_host,        "alloc and free (alloc_host)");
     run_test(test_alloc_device,      "alloc and free (alloc_device)");
+    run_test(test_alloc_host_outOfCore,
+             "alloc and free out-of-core (alloc_host_outOfCore)");
     run_test(test_clearHostBlocks,   "clearHostBlocks");
     run_test(test_clearDeviceBlocks, "clearDeviceBlocks");
 }
@@ -0,0 +1,159 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/internal/MpiProgress.hh"
+#include "slate/internal/comm.hh"
+#include "slate/internal/openmp.hh"
+#include "slate/config.hh"
+#include "slate/internal/mpi.hh"
+
+#include "unit_test.hh"
+
+namespace test {
+
+//------------------------------------------------------------------------------
+// global variables
+int mpi_rank;
+int mpi_size;
+
+//------------------------------------------------------------------------------
+/// Sends tag + rank around a ring and completes it with waitAll.
+void ring( int tag, MPI_Comm comm )
+{
+    int next = (mpi_rank + 1) % mpi_size;
+    int prev = (mpi_rank + mpi_size - 1) % mpi_size;
+    int send = tag*1000 + mpi_rank;
+    int recv = -1;
+
+    std::vector<MPI_Request> requests( 2 );
+    MPI_Irecv( &recv, 1, MPI_INT, prev, tag, comm, &requests[ 0 ] );
+    MPI_Isend( &send, 1, MPI_INT, next, tag, comm, &requests[ 1 ] );
+    slate::internal::waitAll( requests );
+
+    test_assert( recv == tag*1000 + prev );
+    test_assert( requests[ 0 ] == MPI_REQUEST_NULL );
+    test_assert( requests[ 1 ] == MPI_REQUEST_NULL );
+}
+
+//------------------------------------------------------------------------------
+/// Without the progress engine, waitAll falls back to MPI_Waitall.
+void test_waitAll_off()
+{
+    bool save = slate::mpi_progress();
+    slate::mpi_progress( false );
+
+    test_assert( slate::internal::MpiProgress::engine() == nullptr );
+    for (int tag = 0; tag < 10; ++tag)
+        ring( tag, MPI_COMM_WORLD );
+
+    // Null requests are skipped.
+    std::vector<MPI_Request> requests( 3, MPI_REQUEST_NULL );
+    slate::internal::waitAll( requests );
+
+    slate::mpi_progress( save );
+}
+
+//------------------------------------------------------------------------------
+/// With the progress engine, waitAll completes groups posted concurrently
+/// from many OpenMP tasks.
+void test_waitAll_on()
+{
+    bool save = slate::mpi_progress();
+    slate::mpi_progress( true );
+
+    auto engine = slate::internal::MpiProgress::engine();
+    if (engine == nullptr) {
+        slate::mpi_progress( save );
+        test_skip( "requires MPI_THREAD_MULTIPLE" );
+    }
+    // The engine is cached.
+    test_assert( slate::internal::MpiProgress::engine() == engine );
+
+    std::vector<MPI_Request> requests( 3, MPI_REQUEST_NULL );
+    slate::internal::waitAll( requests );
+
+    int ntasks = 16;
+    #pragma omp parallel
+    #pragma omp master
+    {
+        for (int tag = 0; tag < ntasks; ++tag) {
+            #pragma omp task firstprivate( tag )
+            ring( tag, MPI_COMM_WORLD );
+        }
+    }
+
+    slate::mpi_progress( save );
+}
+
+//------------------------------------------------------------------------------
+/// A failed request makes its waitAll throw, without affecting later
+/// waits. Truncating a receive fails the receive request. Some MPI
+/// implementations don't detect truncation of messages to self,
+/// so this requires 2 ranks.
+void test_waitAll_error()
+{
+    if (mpi_size < 2)
+        test_skip( "requires 2 ranks" );
+
+    bool save = slate::mpi_progress();
+    slate::mpi_progress( true );
+
+    if (slate::internal::MpiProgress::engine() == nullptr) {
+        slate::mpi_progress( save );
+        test_skip( "requires MPI_THREAD_MULTIPLE" );
+    }
+
+    MPI_Comm comm;
+    MPI_Comm_dup( MPI_COMM_WORLD, &comm );
+    MPI_Comm_set_errhandler( comm, MPI_ERRORS_RETURN );
+
+    // Send 2 ints to the next rank, which receives into a 1-int buffer.
+    int next = (mpi_rank + 1) % mpi_size;
+    int prev = (mpi_rank + mpi_size - 1) % mpi_size;
+    int send[ 2 ] = { 1, 2 };
+    int recv[ 2 ] = { 0, 0 };
+    MPI_Request send_request;
+    MPI_Isend( send, 2, MPI_INT, next, 0, comm, &send_request );
+    std::vector<MPI_Request> requests( 1 );
+    MPI_Irecv( recv, 1, MPI_INT, prev, 0, comm, &requests[ 0 ] );
+    test_assert_throw( slate::internal::waitAll( requests ),
+                       slate::MpiException );
+    MPI_Wait( &send_request, MPI_STATUS_IGNORE );
+
+    // Subsequent waits succeed.
+    for (int tag = 1; tag < 5; ++tag)
+        ring( tag, comm );
+
+    MPI_Barrier( comm );
+    MPI_Comm_free( &comm );
+    slate::mpi_progress( save );
+}
+
+//------------------------------------------------------------------------------
+/// Runs all tests. Called by unit test main().
+void run_tests()
+{
+    run_test(test_waitAll_off,   "waitAll, progress off", MPI_COMM_WORLD);
+    run_test(test_waitAll_on,    "waitAll, progress on",  MPI_COMM_WORLD);
+    run_test(test_waitAll_error, "waitAll, error",        MPI_COMM_WORLD);
+}
+
+}  // namespace test
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    using namespace test;  // for globals mpi_rank, etc.
+
+    int provided = 0;
+    MPI_Init_thread( &argc, &argv, MPI_THREAD_MULTIPLE, &provided );
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+
+    int err = unit_test_main(MPI_COMM_WORLD);  // which calls run_tests()
+
+    MPI_Finalize();
+    return err;
+}
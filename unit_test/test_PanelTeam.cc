@@ -0,0 +1,179 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/internal/PanelTeam.hh"
+#include "slate/internal/util.hh"
+#include "slate/internal/openmp.hh"
+
+#include "unit_test.hh"
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+#include <sched.h>
+#include <unistd.h>
+
+namespace test {
+
+//------------------------------------------------------------------------------
+/// Each thread rank runs once per run(), on distinct threads,
+/// with rank 0 on the caller.
+void test_PanelTeam_run()
+{
+    int size = 4;
+    slate::internal::PanelTeam team( size );
+    test_assert( team.size() == size );
+
+    std::vector<int> count( size );
+    std::vector<std::thread::id> ids( size );
+    for (int num_threads = 1; num_threads <= size; ++num_threads) {
+        std::fill( count.begin(), count.end(), 0 );
+        team.run( num_threads, [&]( int thread_rank ) {
+            ++count[ thread_rank ];
+            ids[ thread_rank ] = std::this_thread::get_id();
+        } );
+        for (int i = 0; i < size; ++i)
+            test_assert( count[ i ] == (i < num_threads ? 1 : 0) );
+        test_assert( ids[ 0 ] == std::this_thread::get_id() );
+        for (int i = 1; i < num_threads; ++i)
+            test_assert( ids[ i ] != ids[ 0 ] );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Threads synchronize with a ThreadBarrier, across many runs,
+/// including after the workers went to sleep between runs.
+void test_PanelTeam_barrier()
+{
+    int size = 4;
+    slate::internal::PanelTeam team( size );
+
+    for (int iter = 0; iter < 100; ++iter) {
+        if (iter % 25 == 0)
+            usleep( 10000 );
+
+        slate::ThreadBarrier barrier;
+        std::vector<int> values( size, 0 ), seen( size, 0 );
+        int sum = 0;
+        team.run( size, [&]( int thread_rank ) {
+            values[ thread_rank ] = thread_rank + iter;
+            barrier.wait( size, thread_rank, [&] {
+                for (int v : values)
+                    sum += v;
+            } );
+            seen[ thread_rank ] = sum;
+            barrier.wait( size );
+        } );
+        // All threads saw sum after the barrier.
+        for (int i = 0; i < size; ++i)
+            test_assert( seen[ i ] == size*(size - 1)/2 + size*iter );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// An exception thrown by a worker is rethrown by run(),
+/// and the team remains usable.
+void test_PanelTeam_exception()
+{
+    slate::internal::PanelTeam team( 3 );
+
+    bool caught = false;
+    try {
+        team.run( 3, []( int thread_rank ) {
+            if (thread_rank == 2)
+                throw std::runtime_error( "panel error" );
+        } );
+    }
+    catch (std::runtime_error const&) {
+        caught = true;
+    }
+    test_assert( caught );
+
+    int count = 0;
+    team.run( 3, [&]( int thread_rank ) {
+        #pragma omp atomic
+        ++count;
+    } );
+    test_assert( count == 3 );
+}
+
+//------------------------------------------------------------------------------
+/// The team runs panels from OpenMP tasks, as in getrf and geqrf.
+void test_PanelTeam_task()
+{
+    int size = 3;
+    slate::internal::PanelTeam team( size );
+    int n = 10;
+    int sum = 0;
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        std::vector<uint8_t> dep( 1 );
+        uint8_t* column = dep.data();
+        SLATE_UNUSED( column ); // Used only by OpenMP
+        for (int k = 0; k < n; ++k) {
+            #pragma omp task depend( inout:column[ 0 ] ) \
+                shared( team, sum ) firstprivate( k, size )
+            {
+                team.run( size, [&]( int thread_rank ) {
+                    #pragma omp atomic
+                    sum += k;
+                } );
+            }
+        }
+    }
+    test_assert( sum == size * n*(n - 1)/2 );
+}
+
+//------------------------------------------------------------------------------
+/// Workers don't start nested OpenMP threads, e.g., in threaded BLAS.
+/// With OpenMP places, worker thread_rank runs on the place thread_rank
+/// after the creating thread's place.
+void test_PanelTeam_binding()
+{
+    int size = 4;
+    int num_places = omp_get_num_places();
+    int first_place = omp_get_place_num();
+    slate::internal::PanelTeam team( size );
+
+    std::vector<int> max_threads( size ), cpu( size );
+    team.run( size, [&]( int thread_rank ) {
+        max_threads[ thread_rank ] = omp_get_max_threads();
+        cpu[ thread_rank ] = sched_getcpu();
+    } );
+    for (int i = 1; i < size; ++i)
+        test_assert( max_threads[ i ] == 1 );
+
+    if (num_places > 0 && first_place >= 0) {
+        for (int i = 1; i < size; ++i) {
+            int place = (first_place + i) % num_places;
+            std::vector<int> procs( omp_get_place_num_procs( place ) );
+            omp_get_place_proc_ids( place, procs.data() );
+            test_assert( std::find( procs.begin(), procs.end(), cpu[ i ] )
+                         != procs.end() );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Runs all tests. Called by unit test main().
+void run_tests()
+{
+    run_test(test_PanelTeam_run,       "PanelTeam::run");
+    run_test(test_PanelTeam_barrier,   "PanelTeam::run with ThreadBarrier");
+    run_test(test_PanelTeam_exception, "PanelTeam::run exception");
+    run_test(test_PanelTeam_task,      "PanelTeam::run in tasks");
+    run_test(test_PanelTeam_binding,   "PanelTeam thread binding");
+}
+
+}  // namespace test
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    return unit_test_main();  // which calls run_tests()
+}
@@ -0,0 +1,303 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/internal/Perf.hh"
+#include "slate/internal/Memory.hh"
+#include "slate/internal/openmp.hh"
+
+#include "unit_test.hh"
+
+#include <memory>
+
+using slate::perf::Perf;
+using slate::perf::Region;
+using slate::perf::Report;
+
+namespace test {
+
+//------------------------------------------------------------------------------
+// global variables
+int mpi_rank;
+int mpi_size;
+
+//------------------------------------------------------------------------------
+/// Tests that nothing is recorded while disabled.
+void test_off()
+{
+    Perf::off();
+    Perf::clear();
+    {
+        Region region( "off" );
+        region.flops( 10 );
+        Perf::flops( 10 );
+        Perf::send( 8 );
+    }
+    test_assert( Perf::report().empty() );
+}
+
+//------------------------------------------------------------------------------
+/// Tests that nested regions make paths, and counters go to the
+/// innermost open region.
+void test_nested()
+{
+    Perf::on();
+    Perf::clear();
+    for (int iter = 0; iter < 2; ++iter) {
+        Region outer( "outer" );
+        Perf::send( 8 );
+        {
+            Region inner( "inner" );
+            inner.flops( 10 );
+            Perf::flops( 5 );
+            Perf::recv( 16 );
+        }
+        Perf::mpiWait( 1.0 );
+    }
+    Perf::off();
+
+    Report report = Perf::report();
+    test_assert( report.size() == 2 );
+
+    auto const& outer = report.at( "outer" );
+    test_assert( outer.calls      == 2 );
+    test_assert( outer.flops      == 0 );
+    test_assert( outer.bytes_sent == 16 );
+    test_assert( outer.msgs_sent  == 2 );
+    test_assert( outer.msgs_recv  == 0 );
+    test_assert( outer.mpi_wait   == 2.0 );
+
+    auto const& inner = report.at( "outer::inner" );
+    test_assert( inner.calls      == 2 );
+    test_assert( inner.flops      == 30 );
+    test_assert( inner.bytes_recv == 32 );
+    test_assert( inner.msgs_recv  == 2 );
+    test_assert( inner.time <= outer.time );
+}
+
+//------------------------------------------------------------------------------
+/// Tests that tasks on other threads record into the open region,
+/// and regions they open nest under it, without races.
+void test_tasks()
+{
+    int n = 100;
+
+    Perf::on();
+    Perf::clear();
+    {
+        Region region( "tasks" );
+
+        #pragma omp parallel
+        #pragma omp master
+        {
+            for (int i = 0; i < n; ++i) {
+                #pragma omp task
+                {
+                    Perf::flops( 1 );
+                    Region kernel( "kernel" );
+                    kernel.flops( 2 );
+                }
+            }
+        }
+    }
+    Perf::off();
+
+    Report report = Perf::report();
+    test_assert( report.at( "tasks" ).calls == 1 );
+    test_assert( report.at( "tasks" ).flops == n );
+    test_assert( report.at( "tasks::kernel" ).calls == n );
+    test_assert( report.at( "tasks::kernel" ).flops == 2*n );
+}
+
+//------------------------------------------------------------------------------
+/// Tests the workspace high-water mark.
+void test_workspace()
+{
+    Perf::on();
+    Perf::clear();
+    {
+        Region region( "workspace" );
+        Perf::memoryAlloc( 1000 );
+        Perf::memoryAlloc( 500 );
+        Perf::memoryFree( 1000 );
+        Perf::memoryAlloc( 200 );
+        Perf::memoryFree( 500 );
+        Perf::memoryFree( 200 );
+    }
+    Perf::off();
+
+    // Other memory may be in use, so check relative to the peak.
+    Report report = Perf::report();
+    test_assert( report.at( "workspace" ).workspace_hwm >= 1500 );
+}
+
+//------------------------------------------------------------------------------
+/// Tests that a nested region's peak starts from the use when it opens,
+/// and the enclosing region's peak includes it.
+void test_workspace_nested()
+{
+    Perf::on();
+    Perf::clear();
+    {
+        Region outer( "outer" );
+        Perf::memoryAlloc( 1000 );
+        Perf::memoryFree( 1000 );
+        Perf::memoryAlloc( 200 );
+        {
+            Region inner( "inner" );
+            Perf::memoryAlloc( 100 );
+            Perf::memoryFree( 100 );
+        }
+        Perf::memoryFree( 200 );
+    }
+    Perf::off();
+
+    // Nothing else uses Memory in this tester, so peaks are exact.
+    Report report = Perf::report();
+    test_assert( report.at( "outer" ).workspace_hwm == 1000 );
+    test_assert( report.at( "outer::inner" ).workspace_hwm == 300 );
+}
+
+//------------------------------------------------------------------------------
+/// Tests regions that close out of order on 2 threads: "a" closes while
+/// "b", opened after it, is still open. Tasks at a deeper level then record
+/// into "b", and each region keeps its own workspace peak.
+void test_out_of_order()
+{
+    if (omp_get_max_threads() < 2)
+        test_skip( "requires 2 OpenMP threads" );
+
+    int num_threads = 0;
+    Perf::on();
+    Perf::clear();
+    #pragma omp parallel num_threads( 2 )
+    {
+        int thread = omp_get_thread_num();
+        #pragma omp single
+        num_threads = omp_get_num_threads();
+
+        std::unique_ptr<Region> region;
+        if (num_threads == 2 && thread == 0) {
+            region.reset( new Region( "a" ) );
+            Perf::memoryAlloc( 500 );
+            Perf::memoryFree( 500 );
+        }
+        #pragma omp barrier
+        if (num_threads == 2 && thread == 1) {
+            region.reset( new Region( "b" ) );
+            Perf::memoryAlloc( 10 );
+        }
+        #pragma omp barrier
+        if (num_threads == 2 && thread == 0) {
+            region.reset();
+            // A nested level records into the region still open.
+            #pragma omp parallel num_threads( 1 )
+            Perf::flops( 1 );
+        }
+        #pragma omp barrier
+        if (num_threads == 2 && thread == 1) {
+            Perf::memoryFree( 10 );
+            region.reset();
+        }
+    }
+    Perf::off();
+
+    if (num_threads < 2)
+        test_skip( "requires 2 OpenMP threads" );
+
+    // Nothing else uses Memory in this tester, so peaks are exact.
+    Report report = Perf::report();
+    test_assert( report.at( "a" ).workspace_hwm == 500 );
+    test_assert( report.at( "b" ).workspace_hwm == 10 );
+    test_assert( report.at( "b" ).flops == 1 );
+    test_assert( report.count( "" ) == 0 );
+}
+
+//------------------------------------------------------------------------------
+/// Tests that Memory counts the bytes requested, not its block size,
+/// and only blocks allocated while enabled.
+void test_memory()
+{
+    slate::Memory memory( 1000 );
+
+    Perf::off();
+    void* before = memory.alloc( slate::HostNum, 500, nullptr );
+
+    Perf::on();
+    Perf::clear();
+    {
+        Region region( "memory" );
+        void* block = memory.alloc( slate::HostNum, 300, nullptr );
+        // Freeing a block allocated while disabled doesn't count.
+        memory.free( before, slate::HostNum );
+        memory.free( block, slate::HostNum );
+    }
+    {
+        Region region( "after" );
+    }
+    Perf::off();
+
+    Report report = Perf::report();
+    test_assert( report.at( "memory" ).workspace_hwm == 300 );
+    test_assert( report.at( "after" ).workspace_hwm == 0 );
+}
+
+//------------------------------------------------------------------------------
+/// Tests reducing reports across ranks, including regions on only some ranks.
+void test_reduce()
+{
+    Perf::on();
+    Perf::clear();
+    {
+        Region region( "all" );
+        Perf::send( mpi_rank + 1 );
+    }
+    if (mpi_rank == 0) {
+        Region region( "root" );
+    }
+    Perf::off();
+
+    Report report = Perf::reduce( Perf::report(), MPI_COMM_WORLD, 0 );
+    if (mpi_rank == 0) {
+        test_assert( report.at( "all" ).calls == mpi_size );
+        test_assert( report.at( "all" ).msgs_sent == mpi_size );
+        test_assert( report.at( "all" ).bytes_sent
+                     == mpi_size*(mpi_size + 1)/2 );
+        test_assert( report.at( "root" ).calls == 1 );
+    }
+    else {
+        test_assert( report.empty() );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Runs all tests. Called by unit test main().
+void run_tests()
+{
+    run_test(test_off,       "Perf off",           MPI_COMM_WORLD);
+    run_test(test_nested,    "Region nested",      MPI_COMM_WORLD);
+    run_test(test_tasks,     "Region tasks",       MPI_COMM_WORLD);
+    run_test(test_workspace, "workspace",          MPI_COMM_WORLD);
+    run_test(test_workspace_nested, "workspace nested", MPI_COMM_WORLD);
+    run_test(test_out_of_order, "out of order",   MPI_COMM_WORLD);
+    run_test(test_memory,    "Memory",             MPI_COMM_WORLD);
+    run_test(test_reduce,    "reduce",             MPI_COMM_WORLD);
+}
+
+}  // namespace test
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    using namespace test;  // for globals mpi_rank, etc.
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+
+    int err = unit_test_main(MPI_COMM_WORLD);  // which calls run_tests()
+
+    MPI_Finalize();
+    return err;
+}
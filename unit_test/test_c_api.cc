@@ -42,6 +42,7 @@ void test_enums()
     assert( slate_Option_PrintWidth          == int( slate::Option::PrintWidth          ) );
     assert( slate_Option_PrintPrecision      == int( slate::Option::PrintPrecision      ) );
     assert( slate_Option_PivotThreshold      == int( slate::Option::PivotThreshold      ) );
+    assert( slate_Option_NormEstColumns      == int( slate::Option::NormEstColumns      ) );
 
     assert( slate_Option_MethodCholQR        == int( slate::Option::MethodCholQR        ) );
     assert( slate_Option_MethodEig           == int( slate::Option::MethodEig           ) );
@@ -3,7 +3,9 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
+#include "slate/slate.hh"
 #include "slate/Tile.hh"
+#include "internal/internal.hh"
 #include "internal/Tile_lapack.hh"
 #include "internal/Tile_synorm.hh"
 #include "slate/internal/device.hh"
@@ -967,6 +969,103 @@ void test_trnorm_dev_fro_upper_unit()
 void test_trnorm_dev_fro_upper_nonunit()
     { test_trnorm_dev(Norm::Fro, Uplo::Upper, Diag::NonUnit); }
 
+//------------------------------------------------------------------------------
+/// Estimates the 1-norm of a distributed n-by-n matrix with t columns.
+/// For a nonnegative matrix, the estimate is exact: the first iteration
+/// finds the column with the largest sum. For a matrix of mixed signs,
+/// checks est <= ||A||_1, and est >= ||A||_1 / 3, which Higham and Tisseur
+/// report nearly always holds for t >= 2.
+void test_norm1est_block(int64_t t, bool nonnegative)
+{
+    using scalar_t = double;
+    double eps = std::numeric_limits<double>::epsilon();
+    const scalar_t zero = 0.0, one = 1.0;
+
+    int64_t n = 50;
+    int64_t nb = 8;
+    int p = mpi_size;
+    int q = 1;
+
+    slate::Matrix<scalar_t> A( n, n, nb, p, q, MPI_COMM_WORLD );
+    A.insertLocalTiles();
+    int64_t row = 0;
+    for (int64_t i = 0; i < A.mt(); ++i) {
+        int64_t col = 0;
+        for (int64_t j = 0; j < A.nt(); ++j) {
+            if (A.tileIsLocal( i, j )) {
+                auto Aij = A( i, j );
+                for (int64_t jj = 0; jj < Aij.nb(); ++jj) {
+                    for (int64_t ii = 0; ii < Aij.mb(); ++ii) {
+                        int64_t gi = row + ii, gj = col + jj;
+                        // Column 17 has the largest sum.
+                        double a = 1 + ((3*gi + 7*gj) % 11) + (gj == 17 ? 5 : 0);
+                        if (! nonnegative && (gi + 2*gj) % 3 == 0)
+                            a = -a;
+                        Aij.at( ii, jj ) = a;
+                    }
+                }
+            }
+            col += A.tileNb( j );
+        }
+        row += A.tileMb( i );
+    }
+    double Anorm = slate::norm( Norm::One, A );
+
+    auto tileMb = A.tileMbFunc();
+    auto tileNb = slate::func::uniform_blocksize( t, t );
+    auto tileRank = A.tileRankFunc();
+    auto tileDevice = A.tileDeviceFunc();
+    slate::Matrix<scalar_t> X( n, t, tileMb, tileNb, tileRank, tileDevice,
+                               MPI_COMM_WORLD );
+    X.insertLocalTiles();
+    slate::Matrix<scalar_t> S = X.emptyLike();
+    S.insertLocalTiles();
+    slate::Matrix<scalar_t> Y = X.emptyLike();
+    Y.insertLocalTiles();
+
+    std::vector<int64_t> isave( 3 + t );
+    std::vector<int64_t> ind_hist;
+    double est = 0;
+    int kase = 0;
+    int iters = 0;
+    do {
+        slate::internal::norm1est_block( X, S, &est, &kase, isave, ind_hist );
+        if (kase == 1) {
+            slate::gemm( one, A, X, zero, Y );
+            slate::copy( Y, X );
+        }
+        else if (kase == 2) {
+            auto AH = conj_transpose( A );
+            slate::gemm( one, AH, X, zero, Y );
+            slate::copy( Y, X );
+        }
+        ++iters;
+    } while (kase != 0 && iters < 100);
+
+    if (verbose) {
+        printf( "rank %d, t %lld, est %.4e, norm %.4e, iters %d\n",
+                mpi_rank, llong( t ), est, Anorm, iters );
+    }
+    test_assert( kase == 0 );
+    test_assert( est <= Anorm * (1 + n*eps) );
+    if (nonnegative)
+        test_assert( std::abs( est - Anorm ) <= Anorm * n*eps );
+    else
+        test_assert( est >= Anorm / 3 );
+}
+
+void test_norm1est_block_t1()
+    { test_norm1est_block( 1, true ); }
+
+void test_norm1est_block_t2()
+    { test_norm1est_block( 2, true ); }
+
+void test_norm1est_block_t2_signed()
+    { test_norm1est_block( 2, false ); }
+
+void test_norm1est_block_t4_signed()
+    { test_norm1est_block( 4, false ); }
+
 //------------------------------------------------------------------------------
 /// Runs all tests. Called by unit test main().
 void run_tests()
@@ -1111,6 +1210,16 @@ void run_tests()
         run_test(
             test_trnorm_dev_fro_upper_nonunit, "trnorm_dev( fro, upper, nonunit )");
     }
+
+    //-------------------- norm1est_block
+    run_test(
+        test_norm1est_block_t1,        "norm1est_block( t=1 )", MPI_COMM_WORLD);
+    run_test(
+        test_norm1est_block_t2,        "norm1est_block( t=2 )", MPI_COMM_WORLD);
+    run_test(
+        test_norm1est_block_t2_signed, "norm1est_block( t=2, signed )", MPI_COMM_WORLD);
+    run_test(
+        test_norm1est_block_t4_signed, "norm1est_block( t=4, signed )", MPI_COMM_WORLD);
 }
 
 }  // namespace test
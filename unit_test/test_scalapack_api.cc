@@ -0,0 +1,260 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "scalapack_slate.hh"
+
+#include "unit_test.hh"
+
+extern "C" void Cblacs_gridmap(int* icontxt, int* usermap, int ldumap, int nprow, int npcol);
+extern "C" void Cblacs_gridexit(int icontxt);
+
+using slate::scalapack_api::scalapack_numroc;
+
+namespace test {
+
+//------------------------------------------------------------------------------
+// global variables
+int mpi_rank;
+int mpi_size;
+int verbose;
+
+//------------------------------------------------------------------------------
+/// @return p, q with p*q = size and p <= q, as square as possible.
+void grid_size( int size, int* p, int* q )
+{
+    *p = 1;
+    for (int i = 1; i*i <= size; ++i)
+        if (size % i == 0)
+            *p = i;
+    *q = size / *p;
+}
+
+//------------------------------------------------------------------------------
+/// Value of global entry (i, j) for tests.
+double entry( int64_t i, int64_t j )
+{
+    return i + j/1000.;
+}
+
+//------------------------------------------------------------------------------
+/// Re-blocks the submatrix A(ia:ia+m-1, ja:ja+n-1) of a ScaLAPACK matrix
+/// with small mb-by-nb blocks into nb_b blocks, checks every entry,
+/// then negates the copy and copies it back, which must change only the
+/// submatrix.
+void test_reblock_copy( slate::GridOrder grid_order )
+{
+    int nprow, npcol;
+    grid_size( mpi_size, &nprow, &npcol );
+    int myprow, mypcol;
+    if (grid_order == slate::GridOrder::Col) {
+        myprow = mpi_rank % nprow;
+        mypcol = mpi_rank / nprow;
+    }
+    else {
+        myprow = mpi_rank / npcol;
+        mypcol = mpi_rank % npcol;
+    }
+
+    int64_t m = 37, n = 29, ia = 5, ja = 4;
+    int64_t mb = 3, nb = 2, nb_b = 8;
+    int64_t M = m + ia - 1, N = n + ja - 1;
+
+    // ScaLAPACK layout.
+    int64_t mloc_a = scalapack_numroc( M, mb, myprow, 0, nprow );
+    int64_t nloc_a = scalapack_numroc( N, nb, mypcol, 0, npcol );
+    int64_t lda = std::max( mloc_a, int64_t( 1 ) );
+    std::vector<double> a( lda * nloc_a );
+    for (int64_t jj = 0; jj < nloc_a; ++jj) {
+        int64_t j = ((jj / nb)*npcol + mypcol)*nb + jj % nb;
+        for (int64_t ii = 0; ii < mloc_a; ++ii) {
+            int64_t i = ((ii / mb)*nprow + myprow)*mb + ii % mb;
+            a[ ii + jj*lda ] = entry( i, j );
+        }
+    }
+
+    // Re-blocked layout of the submatrix.
+    int64_t mloc_b = scalapack_numroc( m, nb_b, myprow, 0, nprow );
+    int64_t nloc_b = scalapack_numroc( n, nb_b, mypcol, 0, npcol );
+    int64_t ldb = std::max( mloc_b, int64_t( 1 ) );
+    std::vector<double> b( ldb * nloc_b, -1.0 );
+
+    slate::scalapack_api::slate_scalapack_reblock_copy(
+        m, n, a.data(), lda, ia, ja, mb, nb, b.data(), ldb, nb_b,
+        grid_order, nprow, npcol, myprow, mypcol, MPI_COMM_WORLD, true );
+
+    for (int64_t jj = 0; jj < nloc_b; ++jj) {
+        int64_t j = ((jj / nb_b)*npcol + mypcol)*nb_b + jj % nb_b;
+        for (int64_t ii = 0; ii < mloc_b; ++ii) {
+            int64_t i = ((ii / nb_b)*nprow + myprow)*nb_b + ii % nb_b;
+            test_assert( b[ ii + jj*ldb ] == entry( i + ia-1, j + ja-1 ) );
+        }
+    }
+
+    for (auto& x : b)
+        x = -x;
+
+    slate::scalapack_api::slate_scalapack_reblock_copy(
+        m, n, a.data(), lda, ia, ja, mb, nb, b.data(), ldb, nb_b,
+        grid_order, nprow, npcol, myprow, mypcol, MPI_COMM_WORLD, false );
+
+    for (int64_t jj = 0; jj < nloc_a; ++jj) {
+        int64_t j = ((jj / nb)*npcol + mypcol)*nb + jj % nb;
+        for (int64_t ii = 0; ii < mloc_a; ++ii) {
+            int64_t i = ((ii / mb)*nprow + myprow)*mb + ii % mb;
+            bool in_sub = i >= ia-1 && i < ia-1 + m
+                          && j >= ja-1 && j < ja-1 + n;
+            double expect = in_sub ? -entry( i, j ) : entry( i, j );
+            test_assert( a[ ii + jj*lda ] == expect );
+        }
+    }
+}
+
+void test_reblock_copy_col()
+    { test_reblock_copy( slate::GridOrder::Col ); }
+
+void test_reblock_copy_row()
+    { test_reblock_copy( slate::GridOrder::Row ); }
+
+//------------------------------------------------------------------------------
+/// Converts pivots relative to re-blocked tiles of 8 rows into the local
+/// ipiv of a ScaLAPACK layout with 3-row blocks.
+void test_pivots_to_ipiv()
+{
+    int nprow, npcol;
+    grid_size( mpi_size, &nprow, &npcol );
+    int myprow = mpi_rank % nprow;
+
+    int64_t n = 30, pivot_nb = 8;
+    int mb = 3;
+    int desca[ 9 ] = { 1, 0, int( n ), int( n ), mb, mb, 0, 0, 1 };
+
+    // Row i swaps with global row piv( i ) = min( n-1, 2 i + 1 ),
+    // stored relative to the tile of row i.
+    auto swap_row = [&]( int64_t i ) {
+        return std::min( n-1, 2*i + 1 );
+    };
+    slate::Pivots pivots;
+    for (int64_t k = 0; k*pivot_nb < n; ++k) {
+        int64_t kb = std::min( pivot_nb, n - k*pivot_nb );
+        std::vector<slate::Pivot> tile_pivots;
+        for (int64_t r = 0; r < kb; ++r) {
+            int64_t g = swap_row( k*pivot_nb + r );
+            tile_pivots.push_back(
+                slate::Pivot( g / pivot_nb - k, g % pivot_nb ) );
+        }
+        pivots.push_back( tile_pivots );
+    }
+
+    int64_t mloc = scalapack_numroc( n, mb, myprow, 0, nprow );
+    std::vector<int> ipiv( mloc + mb );
+    slate::scalapack_api::slate_scalapack_pivots_to_ipiv(
+        n, pivots, pivot_nb, desca, myprow, nprow, ipiv.data() );
+
+    for (int64_t ii = 0; ii < mloc; ++ii) {
+        int64_t i = ((ii / mb)*nprow + myprow)*mb + ii % mb;
+        test_assert( ipiv[ ii ] == swap_row( i ) + 1 );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Splits the processes into two BLACS sub-grids, each mapping its
+/// processes in reverse order, and checks that the communicator of each
+/// sub-grid contains exactly its processes, in column-major grid order.
+/// Both sub-grids create their communicators concurrently.
+void test_blacs_comm_subgrid()
+{
+    int ngrids = std::min( mpi_size, 2 );
+    int half = mpi_size / ngrids;
+    int my_grid = std::min( mpi_rank / half, ngrids - 1 );
+
+    int my_context = -1;
+    int my_first = 0, my_size = 0;
+    for (int g = 0; g < ngrids; ++g) {
+        int first = g*half;
+        int size = (g == ngrids - 1 ? mpi_size - first : half);
+        int p, q;
+        grid_size( size, &p, &q );
+        std::vector<int> usermap( size );
+        for (int k = 0; k < size; ++k)
+            usermap[ k ] = first + size-1 - k;
+
+        // Every process calls gridmap for every grid.
+        int context;
+        Cblacs_get( -1, 0, &context );
+        Cblacs_gridmap( &context, usermap.data(), p, p, q );
+        if (g == my_grid) {
+            my_context = context;
+            my_first = first;
+            my_size = size;
+        }
+    }
+
+    int nprow, npcol, myprow, mypcol;
+    Cblacs_gridinfo( my_context, &nprow, &npcol, &myprow, &mypcol );
+    test_assert( nprow * npcol == my_size );
+    // usermap is in reverse order.
+    test_assert( my_first + my_size-1 - (myprow + mypcol*nprow) == mpi_rank );
+
+    MPI_Comm comm = slate::scalapack_api::slate_scalapack_blacs_comm(
+                        my_context );
+    test_assert( slate::scalapack_api::slate_scalapack_blacs_grid_order(
+                     my_context ) == slate::GridOrder::Col );
+
+    int comm_size, comm_rank;
+    MPI_Comm_size( comm, &comm_size );
+    MPI_Comm_rank( comm, &comm_rank );
+    test_assert( comm_size == my_size );
+    test_assert( comm_rank == myprow + mypcol*nprow );
+
+    // A reduction over the communicator involves only this sub-grid.
+    int sum = 0;
+    MPI_Allreduce( &mpi_rank, &sum, 1, MPI_INT, MPI_SUM, comm );
+    test_assert( sum == my_size*my_first + my_size*(my_size - 1)/2 );
+
+    // A second call returns the cached communicator.
+    MPI_Comm comm2 = slate::scalapack_api::slate_scalapack_blacs_comm(
+                         my_context );
+    int result;
+    MPI_Comm_compare( comm, comm2, &result );
+    test_assert( result == MPI_IDENT );
+
+    Cblacs_gridexit( my_context );
+}
+
+//------------------------------------------------------------------------------
+/// Runs all tests. Called by unit test main().
+void run_tests()
+{
+    run_test(
+        test_reblock_copy_col, "slate_scalapack_reblock_copy( col )", MPI_COMM_WORLD);
+    run_test(
+        test_reblock_copy_row, "slate_scalapack_reblock_copy( row )", MPI_COMM_WORLD);
+    run_test(
+        test_pivots_to_ipiv,   "slate_scalapack_pivots_to_ipiv",      MPI_COMM_WORLD);
+    run_test(
+        test_blacs_comm_subgrid, "slate_scalapack_blacs_comm( sub-grid )", MPI_COMM_WORLD);
+}
+
+}  // namespace test
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    using namespace test;  // for globals mpi_rank, etc.
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+
+    verbose = 0;
+    for (int i = 1; i < argc; ++i)
+        if (argv[i] == std::string("-v"))
+            verbose += 1;
+
+    int err = unit_test_main(MPI_COMM_WORLD);  // which calls run_tests()
+
+    MPI_Finalize();
+    return err;
+}
@@ -4,6 +4,7 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "slate/slate.hh"
+#include "internal/internal_util.hh"
 
 #include "unit_test.hh"
 
@@ -30,6 +31,58 @@ void test_gpu_aware_mpi()
     test_assert( ! slate::gpu_aware_mpi() );
 }
 
+//------------------------------------------------------------------------------
+void test_morton_index()
+{
+    using slate::internal::morton_index;
+
+    // Bits of i and j interleave, with i in the odd bits.
+    test_assert( morton_index( 0, 0 ) == 0 );
+    test_assert( morton_index( 0, 1 ) == 1 );
+    test_assert( morton_index( 1, 0 ) == 2 );
+    test_assert( morton_index( 1, 1 ) == 3 );
+    test_assert( morton_index( 0, 2 ) == 4 );
+    test_assert( morton_index( 2, 0 ) == 8 );
+    test_assert( morton_index( 3, 3 ) == 15 );
+    test_assert( morton_index( 0xffffffff, 0 ) == 0xaaaaaaaaaaaaaaaaull );
+    test_assert( morton_index( 0, 0xffffffff ) == 0x5555555555555555ull );
+}
+
+//------------------------------------------------------------------------------
+void test_morton_local_tiles()
+{
+    // 2x2 grid, or 1x1 for fewer ranks; other ranks have no tiles.
+    int p = (mpi_size >= 4 ? 2 : 1);
+    int q = (mpi_size >= 4 ? 2 : 1);
+
+    int64_t nb = 4;
+    slate::Matrix<double> A( 8*nb, 8*nb, nb, p, q, MPI_COMM_WORLD );
+
+    auto tiles = slate::internal::morton_local_tiles( A );
+
+    // Every local tile, once.
+    int64_t num_local = 0;
+    for (int64_t i = 0; i < A.mt(); ++i)
+        for (int64_t j = 0; j < A.nt(); ++j)
+            if (A.tileIsLocal( i, j ))
+                ++num_local;
+    test_assert( int64_t( tiles.size() ) == num_local );
+
+    // Each 4 consecutive tiles form a 2x2 block of local tiles:
+    // 2 distinct block rows and 2 distinct block cols.
+    for (size_t k = 0; k < tiles.size(); k += 4) {
+        std::set<int64_t> rows, cols;
+        for (size_t kk = k; kk < k + 4; ++kk) {
+            auto [ i, j ] = tiles[ kk ];
+            test_assert( A.tileIsLocal( i, j ) );
+            rows.insert( i );
+            cols.insert( j );
+        }
+        test_assert( rows.size() == 2 );
+        test_assert( cols.size() == 2 );
+    }
+}
+
 //------------------------------------------------------------------------------
 /// Runs all tests. Called by unit test main().
 void run_tests()
@@ -37,7 +90,11 @@ void run_tests()
     if (mpi_rank == 0) {
         run_test(
             test_gpu_aware_mpi, "gpu_aware_mpi()");
+        run_test(
+            test_morton_index, "morton_index");
     }
+    run_test(
+        test_morton_local_tiles, "morton_local_tiles", MPI_COMM_WORLD);
 }
 
 }  // namespace test